@@ -0,0 +1,245 @@
+/**
+ * \file AnnuaireBanc.cpp
+ * \brief Bancs d'essai de la classe Annuaire, pour 10, 10 000 et 1 000 000 de membres
+ * \author David Jalbert Ross
+ * \version 1.0
+ * \date 16 avril 2020
+ */
+
+#include <benchmark/benchmark.h>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+#include "Annuaire.h"
+#include "Joueur.h"
+#include "GenerateurMembres.h"
+#include "Horloge.h"
+#include "validationFormat.h"
+
+/**
+ * \brief Tailles d'annuaire mesurées
+ */
+static void tailles(benchmark::internal::Benchmark* p_banc)
+{
+	p_banc->ArgName("membres")->Arg(10)->Arg(10000)->Arg(1000000)->Unit(benchmark::kMicrosecond);
+}
+
+/**
+ * \brief Remplissage d'un annuaire vide avec ajouterPersonne()
+ */
+static void BM_AnnuaireAjouterPersonne(benchmark::State& p_etat)
+{
+	const std::vector<banc::DonneesMembre> membres = banc::genererMembres(p_etat.range(0));
+	for (auto _ : p_etat)
+	{
+		hockey::Annuaire annuaire("Club");
+		banc::ajouterMembres(membres, annuaire);
+		benchmark::DoNotOptimize(annuaire);
+	}
+	p_etat.SetItemsProcessed(p_etat.iterations() * p_etat.range(0));
+}
+BENCHMARK(BM_AnnuaireAjouterPersonne)->Apply(tailles);
+
+/**
+ * \brief Copie d'un annuaire, qui partage ses membres avec l'original
+ */
+static void BM_AnnuaireCopie(benchmark::State& p_etat)
+{
+	const hockey::Annuaire& annuaire = banc::annuaireSynthetique(p_etat.range(0));
+	for (auto _ : p_etat)
+	{
+		hockey::Annuaire copie(annuaire);
+		benchmark::DoNotOptimize(copie);
+	}
+}
+BENCHMARK(BM_AnnuaireCopie)->Apply(tailles);
+
+/**
+ * \brief Copie d'un annuaire suivie d'un ajout, qui copie tous les membres
+ */
+static void BM_AnnuaireCopieModifiee(benchmark::State& p_etat)
+{
+	const hockey::Annuaire& annuaire = banc::annuaireSynthetique(p_etat.range(0));
+	const banc::DonneesMembre nouveau = banc::genererMembres(p_etat.range(0) + 2).back();
+	hockey::Joueur joueur(nouveau.m_nom, nouveau.m_prenom, nouveau.m_dateNaissance, nouveau.m_telephone, nouveau.m_position);
+	for (auto _ : p_etat)
+	{
+		hockey::Annuaire copie(annuaire);
+		copie.ajouterPersonne(joueur);
+		benchmark::DoNotOptimize(copie);
+	}
+}
+BENCHMARK(BM_AnnuaireCopieModifiee)->Apply(tailles);
+
+/**
+ * \brief Retrait du premier membre d'un annuaire qui ne partage pas son registre, puis ajout du
+ * 		  même membre pour garder la taille constante : le membre retiré laisse une case vide, et
+ * 		  le coût des compactages du registre est réparti sur les itérations
+ */
+static void BM_AnnuaireRetirerPersonne(benchmark::State& p_etat)
+{
+	hockey::Annuaire annuaire(banc::annuaireSynthetique(p_etat.range(0)));
+	std::unique_ptr<hockey::Personne> membre(annuaire.reqMembre(0).clone());
+	annuaire.retirerPersonne(*membre);
+	annuaire.ajouterPersonne(*membre);
+	for (auto _ : p_etat)
+	{
+		membre.reset(annuaire.reqMembre(0).clone());
+		annuaire.retirerPersonne(*membre);
+		annuaire.ajouterPersonne(*membre);
+	}
+	benchmark::DoNotOptimize(annuaire);
+}
+BENCHMARK(BM_AnnuaireRetirerPersonne)->Apply(tailles);
+
+/**
+ * \brief Formatage de tout l'annuaire avec reqAnnuaireFormate()
+ */
+static void BM_AnnuaireFormate(benchmark::State& p_etat)
+{
+	const hockey::Annuaire& annuaire = banc::annuaireSynthetique(p_etat.range(0));
+	std::size_t nbOctets = 0;
+	for (auto _ : p_etat)
+	{
+		std::string formate = annuaire.reqAnnuaireFormate();
+		nbOctets = formate.size();
+		benchmark::DoNotOptimize(formate);
+	}
+	p_etat.SetBytesProcessed(p_etat.iterations() * nbOctets);
+	p_etat.SetItemsProcessed(p_etat.iterations() * p_etat.range(0));
+}
+BENCHMARK(BM_AnnuaireFormate)->Apply(tailles);
+
+/**
+ * \brief Fichier d'instantané écrit puis relu par les bancs de sauvegarder() et de charger()
+ */
+static const char* const FICHIER_INSTANTANE = "AnnuaireBanc.instantane";
+
+/**
+ * \brief Écriture d'un annuaire dans un fichier d'instantané
+ */
+static void BM_AnnuaireSauvegarder(benchmark::State& p_etat)
+{
+	const hockey::Annuaire& annuaire = banc::annuaireSynthetique(p_etat.range(0));
+	for (auto _ : p_etat)
+	{
+		benchmark::DoNotOptimize(annuaire.sauvegarder(FICHIER_INSTANTANE));
+	}
+	std::remove(FICHIER_INSTANTANE);
+	p_etat.SetItemsProcessed(p_etat.iterations() * p_etat.range(0));
+}
+BENCHMARK(BM_AnnuaireSauvegarder)->Apply(tailles);
+
+/**
+ * \brief Chargement d'un fichier d'instantané dans un annuaire, index compris ; le registre
+ * 		  chargé à l'itération précédente est détruit par le chargement suivant
+ */
+static void BM_AnnuaireCharger(benchmark::State& p_etat)
+{
+	banc::annuaireSynthetique(p_etat.range(0)).sauvegarder(FICHIER_INSTANTANE);
+	hockey::Annuaire annuaire("Club");
+	for (auto _ : p_etat)
+	{
+		benchmark::DoNotOptimize(annuaire.charger(FICHIER_INSTANTANE));
+	}
+	std::remove(FICHIER_INSTANTANE);
+	p_etat.SetItemsProcessed(p_etat.iterations() * p_etat.range(0));
+}
+BENCHMARK(BM_AnnuaireCharger)->Apply(tailles);
+
+/**
+ * \brief Intervalle de 30 jours de dates de naissance, qui contient environ un joueur généré sur dix
+ */
+static void intervalleNaissance(util::Date& p_debut, util::Date& p_fin)
+{
+	long aujourdhui = util::Horloge::reqAujourdhui().reqJoursEpoque();
+	p_debut = util::Date::dateDepuisJoursEpoque(aujourdhui - 16 * 365 - 150);
+	p_fin = util::Date::dateDepuisJoursEpoque(aujourdhui - 16 * 365 - 121);
+}
+
+/**
+ * \brief Recherche des membres nés dans un intervalle de 30 jours avec l'index des dates de naissance
+ */
+static void BM_AnnuaireParNaissance(benchmark::State& p_etat)
+{
+	const hockey::Annuaire& annuaire = banc::annuaireSynthetique(p_etat.range(0));
+	util::Date debut, fin;
+	intervalleNaissance(debut, fin);
+	for (auto _ : p_etat)
+	{
+		std::vector<const hockey::Personne*> vTrouves = annuaire.trouverParNaissance(debut, fin);
+		benchmark::DoNotOptimize(vTrouves);
+	}
+}
+BENCHMARK(BM_AnnuaireParNaissance)->Apply(tailles);
+
+/**
+ * \brief Même recherche par un balayage de tous les membres, la référence de BM_AnnuaireParNaissance
+ */
+static void BM_AnnuaireParNaissanceBalayage(benchmark::State& p_etat)
+{
+	const hockey::Annuaire& annuaire = banc::annuaireSynthetique(p_etat.range(0));
+	util::Date debut, fin;
+	intervalleNaissance(debut, fin);
+	for (auto _ : p_etat)
+	{
+		std::vector<const hockey::Personne*> vTrouves;
+		for (unsigned int i = 0; i < annuaire.reqNbMembres(); i++)
+		{
+			const hockey::Personne& membre = annuaire.reqMembre(i);
+			if (!(membre.reqDateNaissance() < debut) && !(fin < membre.reqDateNaissance()))
+			{
+				vTrouves.push_back(&membre);
+			}
+		}
+		benchmark::DoNotOptimize(vTrouves);
+	}
+}
+BENCHMARK(BM_AnnuaireParNaissanceBalayage)->Apply(tailles);
+
+/**
+ * \brief Préfixe d'autocomplétion saisi avec un accent, qui correspond au prénom d'environ un
+ * 		  membre généré sur huit (Hélène)
+ */
+static const char* const PREFIXE_NOM = "H\xC3\xA9l";
+
+/**
+ * \brief Recherche des dix premiers membres dont le nom ou le prénom commence par un préfixe,
+ * 		  avec l'index des noms
+ */
+static void BM_AnnuaireParPrefixe(benchmark::State& p_etat)
+{
+	const hockey::Annuaire& annuaire = banc::annuaireSynthetique(p_etat.range(0));
+	for (auto _ : p_etat)
+	{
+		std::vector<const hockey::Personne*> vTrouves = annuaire.trouverParPrefixe(PREFIXE_NOM, 10);
+		benchmark::DoNotOptimize(vTrouves);
+	}
+}
+BENCHMARK(BM_AnnuaireParPrefixe)->Apply(tailles);
+
+/**
+ * \brief Même recherche par un balayage de tous les membres, la référence de BM_AnnuaireParPrefixe.
+ * 		  Le balayage ne fait que collecter les membres qui correspondent, sans les ordonner pour
+ * 		  en garder les dix premiers : il mesure une borne inférieure du coût sans index.
+ */
+static void BM_AnnuaireParPrefixeBalayage(benchmark::State& p_etat)
+{
+	const hockey::Annuaire& annuaire = banc::annuaireSynthetique(p_etat.range(0));
+	const std::string prefixe = util::normaliserNom(PREFIXE_NOM);
+	for (auto _ : p_etat)
+	{
+		std::vector<const hockey::Personne*> vTrouves;
+		for (unsigned int i = 0; i < annuaire.reqNbMembres(); i++)
+		{
+			const hockey::Personne& membre = annuaire.reqMembre(i);
+			if (util::nomCommencePar(membre.reqNom(), prefixe) || util::nomCommencePar(membre.reqPrenom(), prefixe))
+			{
+				vTrouves.push_back(&membre);
+			}
+		}
+		benchmark::DoNotOptimize(vTrouves);
+	}
+}
+BENCHMARK(BM_AnnuaireParPrefixeBalayage)->Apply(tailles);
@@ -0,0 +1,81 @@
+/**
+ * \file DateBanc.cpp
+ * \brief Bancs d'essai de la classe Date et de l'horloge
+ * \author David Jalbert Ross
+ * \version 1.0
+ * \date 16 avril 2020
+ */
+
+#include <benchmark/benchmark.h>
+#include "Date.h"
+#include "Horloge.h"
+
+/**
+ * \brief Construction d'une date à partir du jour, du mois et de l'année
+ */
+static void BM_DateConstruction(benchmark::State& p_etat)
+{
+	long jour = 1;
+	for (auto _ : p_etat)
+	{
+		util::Date date(jour, 4, 2004);
+		benchmark::DoNotOptimize(date);
+		jour = jour % 28 + 1;
+	}
+}
+BENCHMARK(BM_DateConstruction);
+
+/**
+ * \brief Construction de la date du système, avec time() et localtime()
+ */
+static void BM_DateSysteme(benchmark::State& p_etat)
+{
+	for (auto _ : p_etat)
+	{
+		util::Date date;
+		benchmark::DoNotOptimize(date);
+	}
+}
+BENCHMARK(BM_DateSysteme);
+
+/**
+ * \brief Date du jour gardée par util::Horloge
+ */
+static void BM_HorlogeAujourdhui(benchmark::State& p_etat)
+{
+	for (auto _ : p_etat)
+	{
+		util::Date date = util::Horloge::reqAujourdhui();
+		benchmark::DoNotOptimize(date);
+	}
+}
+BENCHMARK(BM_HorlogeAujourdhui);
+
+/**
+ * \brief Lecture du jour, du mois, de l'année et du jour de l'année
+ */
+static void BM_DateAccesseurs(benchmark::State& p_etat)
+{
+	util::Date date(25, 8, 2004);
+	for (auto _ : p_etat)
+	{
+		benchmark::DoNotOptimize(date);
+		long somme = date.reqJour() + date.reqMois() + date.reqAnnee() + date.reqJourAnnee();
+		benchmark::DoNotOptimize(somme);
+	}
+}
+BENCHMARK(BM_DateAccesseurs);
+
+/**
+ * \brief Formatage d'une date, par exemple « Mercredi le 25 aout 2004 »
+ */
+static void BM_DateFormatee(benchmark::State& p_etat)
+{
+	util::Date date(25, 8, 2004);
+	for (auto _ : p_etat)
+	{
+		std::string formatee = date.reqDateFormatee();
+		benchmark::DoNotOptimize(formatee);
+	}
+}
+BENCHMARK(BM_DateFormatee);
@@ -0,0 +1,163 @@
+/**
+ * \file GenerateurMembres.cpp
+ * \brief Fichier d'implementation du générateur de membres synthétiques des bancs d'essai
+ * \author David Jalbert Ross
+ * \version 1.0
+ * \date 16 avril 2020
+ */
+
+#include "GenerateurMembres.h"
+#include <cctype>
+#include <map>
+#include <memory>
+#include <random>
+#include "Horloge.h"
+#include "Joueur.h"
+#include "Entraineur.h"
+
+namespace
+{
+const char* const PRENOMS[] = { "Jean", "Marie", "Luc", "Sophie", "Hélène", "Mathieu", "Chloé", "Olivier" };
+const char* const POSITIONS[] = { "ailier", "centre", "défenseur", "gardien" };
+const char* const CODES_REGIONAUX[] = { "418", "581", "450", "514", "819", "438", "873" };
+
+// Germe fixe : les mêmes membres sont générés à chaque exécution
+const unsigned int GERME = 2020;
+
+// Un membre sur NB_MEMBRES_PAR_ENTRAINEUR est un entraineur
+const unsigned int NB_MEMBRES_PAR_ENTRAINEUR = 10;
+
+/**
+ * \brief Construit un nom unique à partir d'un indice, en base 26 : Baaa, Caaa, ..., Abaa...
+ * \param[in] p_indice est l'indice du membre
+ * \return un nom d'au moins quatre lettres, la première en majuscule
+ */
+std::string nomDepuisIndice(unsigned int p_indice)
+{
+	std::string nom;
+	do
+	{
+		nom += static_cast<char>('a' + p_indice % 26);
+		p_indice /= 26;
+	}
+	while (p_indice > 0 || nom.length() < 4);
+
+	nom[0] = static_cast<char>(nom[0] - 'a' + 'A');
+	return nom;
+}
+
+/**
+ * \brief Construit le numéro de RAMQ attendu par util::validerNumRAMQ()
+ * \return un numéro de RAMQ valide, suivi de deux chiffres quelconques
+ */
+std::string numRAMQ(const std::string& p_nom, const std::string& p_prenom, const util::Date& p_dateNaissance, char p_sexe,
+					unsigned int p_suffixe)
+{
+	long mois = p_dateNaissance.reqMois() + (p_sexe == 'F' ? 50 : 0);
+	long annee = p_dateNaissance.reqAnnee() % 100;
+	char numero[15];
+	numero[0] = static_cast<char>(std::toupper(static_cast<unsigned char>(p_nom[0])));
+	numero[1] = static_cast<char>(std::toupper(static_cast<unsigned char>(p_nom[1])));
+	numero[2] = static_cast<char>(std::toupper(static_cast<unsigned char>(p_nom[2])));
+	numero[3] = static_cast<char>(std::toupper(static_cast<unsigned char>(p_prenom[0])));
+	numero[4] = ' ';
+	numero[5] = static_cast<char>('0' + annee / 10);
+	numero[6] = static_cast<char>('0' + annee % 10);
+	numero[7] = static_cast<char>('0' + mois / 10);
+	numero[8] = static_cast<char>('0' + mois % 10);
+	numero[9] = ' ';
+	numero[10] = static_cast<char>('0' + p_dateNaissance.reqJour() / 10);
+	numero[11] = static_cast<char>('0' + p_dateNaissance.reqJour() % 10);
+	numero[12] = static_cast<char>('0' + p_suffixe / 10 % 10);
+	numero[13] = static_cast<char>('0' + p_suffixe % 10);
+	return std::string(numero, 14);
+}
+}
+
+namespace banc
+{
+
+/**
+ * \brief Génère des membres synthétiques, tous différents et valides à la date du jour de util::Horloge
+ * 		  Les joueurs ont entre 15 et 16 ans, les entraineurs entre 30 et 40 ans. La génération
+ * 		  est déterministe pour une même date du jour.
+ * \param[in] p_nbMembres est le nombre de membres à générer
+ * \return les champs des membres générés
+ */
+std::vector<DonneesMembre> genererMembres(unsigned int p_nbMembres)
+{
+	std::mt19937 generateur(GERME);
+	const long aujourdhui = util::Horloge::reqAujourdhui().reqJoursEpoque();
+
+	std::vector<DonneesMembre> membres;
+	membres.reserve(p_nbMembres);
+	for (unsigned int i = 0; i < p_nbMembres; i++)
+	{
+		DonneesMembre membre;
+		membre.m_estJoueur = i % NB_MEMBRES_PAR_ENTRAINEUR != 0;
+		membre.m_nom = nomDepuisIndice(i);
+		membre.m_prenom = PRENOMS[generateur() % (sizeof(PRENOMS) / sizeof(PRENOMS[0]))];
+
+		std::string telephone = CODES_REGIONAUX[generateur() % (sizeof(CODES_REGIONAUX) / sizeof(CODES_REGIONAUX[0]))];
+		std::string chiffres = std::to_string(10000000 + generateur() % 10000000);
+		membre.m_telephone = telephone + ' ' + chiffres.substr(1, 3) + '-' + chiffres.substr(4, 4);
+
+		if (membre.m_estJoueur)
+		{
+			membre.m_dateNaissance = util::Date::dateDepuisJoursEpoque(aujourdhui - 16 * 365 - generateur() % 300);
+			membre.m_position = POSITIONS[generateur() % (sizeof(POSITIONS) / sizeof(POSITIONS[0]))];
+			membre.m_sexe = '\0';
+		}
+		else
+		{
+			membre.m_dateNaissance = util::Date::dateDepuisJoursEpoque(aujourdhui - 30 * 365 - generateur() % 3650);
+			membre.m_sexe = generateur() % 2 == 0 ? 'M' : 'F';
+			membre.m_numRAMQ = numRAMQ(membre.m_nom, membre.m_prenom, membre.m_dateNaissance, membre.m_sexe, generateur());
+		}
+		membres.push_back(std::move(membre));
+	}
+	return membres;
+}
+
+/**
+ * \brief Ajoute des membres générés à un annuaire
+ * \param[in] p_membres sont les membres générés par genererMembres()
+ * \param[in,out] p_annuaire est l'annuaire auquel les membres sont ajoutés
+ */
+void ajouterMembres(const std::vector<DonneesMembre>& p_membres, hockey::Annuaire& p_annuaire)
+{
+	for (const DonneesMembre& membre : p_membres)
+	{
+		if (membre.m_estJoueur)
+		{
+			p_annuaire.ajouterPersonne(hockey::Joueur(membre.m_nom, membre.m_prenom, membre.m_dateNaissance,
+													  membre.m_telephone, membre.m_position));
+		}
+		else
+		{
+			p_annuaire.ajouterPersonne(hockey::Entraineur(membre.m_nom, membre.m_prenom, membre.m_dateNaissance,
+														  membre.m_telephone, membre.m_numRAMQ, membre.m_sexe));
+		}
+	}
+}
+
+/**
+ * \brief Retourne un annuaire de membres générés, construit au premier appel pour chaque taille
+ * 		  puis conservé jusqu'à la fin du programme
+ * \param[in] p_nbMembres est le nombre de membres de l'annuaire
+ * \return une référence constante vers l'annuaire
+ */
+const hockey::Annuaire& annuaireSynthetique(unsigned int p_nbMembres)
+{
+	static std::map<unsigned int, std::unique_ptr<hockey::Annuaire>> annuaires;
+
+	std::unique_ptr<hockey::Annuaire>& annuaire = annuaires[p_nbMembres];
+	if (!annuaire)
+	{
+		annuaire.reset(new hockey::Annuaire("Club synthétique"));
+		ajouterMembres(genererMembres(p_nbMembres), *annuaire);
+	}
+	return *annuaire;
+}
+
+}
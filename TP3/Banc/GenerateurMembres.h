@@ -0,0 +1,51 @@
+/**
+ * \file GenerateurMembres.h
+ * \brief Fichier contenant l'interface du générateur de membres synthétiques des bancs d'essai
+ * \author David Jalbert Ross
+ * \version 1.0
+ * \date 16 avril 2020
+ */
+
+#ifndef GENERATEURMEMBRES_H_
+#define GENERATEURMEMBRES_H_
+
+#include <string>
+#include <vector>
+#include "Date.h"
+#include "Annuaire.h"
+
+/**
+ * \namespace banc
+ * \brief Ce namespace contient les outils communs aux bancs d'essai
+ *
+ * 		Les bancs d'essai utilisent Google Benchmark et se compilent en configuration Release,
+ * 		avec la bibliothèque source/Release. Pour conserver les résultats d'une version :
+ * 		Banc --benchmark_out=banc.json --benchmark_out_format=json
+ * 		--benchmark_filter=Annuaire limite l'exécution aux bancs de l'annuaire.
+ */
+namespace banc
+{
+
+/**
+ * \struct DonneesMembre
+ * \brief Les champs d'un membre synthétique, valides pour la date du jour de util::Horloge
+ */
+struct DonneesMembre
+{
+	bool m_estJoueur;
+	std::string m_nom;
+	std::string m_prenom;
+	util::Date m_dateNaissance;
+	std::string m_telephone;
+	std::string m_position;		// vide pour un entraineur
+	std::string m_numRAMQ;		// vide pour un joueur
+	char m_sexe;				// '\0' pour un joueur
+};
+
+std::vector<DonneesMembre> genererMembres(unsigned int p_nbMembres);
+void ajouterMembres(const std::vector<DonneesMembre>& p_membres, hockey::Annuaire& p_annuaire);
+const hockey::Annuaire& annuaireSynthetique(unsigned int p_nbMembres);
+
+}
+
+#endif
@@ -0,0 +1,100 @@
+/**
+ * \file ImportateurAnnuaireBanc.cpp
+ * \brief Bancs d'essai de la classe ImportateurAnnuaire, séquentielle et sur plusieurs fils
+ * \author David Jalbert Ross
+ * \version 1.0
+ * \date 16 avril 2020
+ */
+
+#include <benchmark/benchmark.h>
+#include <map>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Annuaire.h"
+#include "ImportateurAnnuaire.h"
+#include "GenerateurMembres.h"
+
+namespace
+{
+/**
+ * \brief Retourne le fichier CSV décrivant p_nbMembres membres générés, construit une seule fois par taille
+ */
+const std::string& fichierCSV(unsigned int p_nbMembres)
+{
+	static std::map<unsigned int, std::string> fichiers;
+	std::string& fichier = fichiers[p_nbMembres];
+	if (fichier.empty())
+	{
+		std::ostringstream os;
+		for (const banc::DonneesMembre& m : banc::genererMembres(p_nbMembres))
+		{
+			os << (m.m_estJoueur ? 'J' : 'E') << ',' << m.m_nom << ',' << m.m_prenom << ','
+			   << m.m_dateNaissance.reqJour() << '/' << m.m_dateNaissance.reqMois() << '/' << m.m_dateNaissance.reqAnnee()
+			   << ',' << m.m_telephone << ',';
+			if (m.m_estJoueur)
+			{
+				os << m.m_position << '\n';
+			}
+			else
+			{
+				os << m.m_numRAMQ << ',' << m.m_sexe << '\n';
+			}
+		}
+		fichier = os.str();
+	}
+	return fichier;
+}
+
+/**
+ * \brief Tailles de fichier et nombres de fils mesurés ; 0 fil désigne le nombre de coeurs
+ */
+void taillesEtFils(benchmark::internal::Benchmark* p_banc)
+{
+	p_banc->ArgNames({ "membres", "fils" })->Unit(benchmark::kMillisecond);
+	for (int nbMembres : { 10000, 1000000 })
+	{
+		for (int nbFils : { 1, 2, 4, 0 })
+		{
+			p_banc->Args({ nbMembres, nbFils });
+		}
+	}
+}
+}
+
+/**
+ * \brief Importation séquentielle d'un fichier CSV dans un annuaire vide
+ */
+static void BM_Importer(benchmark::State& p_etat)
+{
+	const std::string& fichier = fichierCSV(p_etat.range(0));
+	hockey::ImportateurAnnuaire importateur;
+	for (auto _ : p_etat)
+	{
+		std::istringstream entree(fichier);
+		hockey::Annuaire annuaire("Club");
+		benchmark::DoNotOptimize(importateur.importer(entree, annuaire));
+	}
+	p_etat.SetItemsProcessed(p_etat.iterations() * p_etat.range(0));
+}
+BENCHMARK(BM_Importer)->ArgName("membres")->Arg(10000)->Arg(1000000)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+/**
+ * \brief Importation du même fichier avec importerParallele(), sur 1, 2, 4 fils puis le nombre de
+ * 		  coeurs, rapporté dans le compteur « coeurs »
+ */
+static void BM_ImporterParallele(benchmark::State& p_etat)
+{
+	const std::string& fichier = fichierCSV(p_etat.range(0));
+	hockey::ImportateurAnnuaire importateur;
+	for (auto _ : p_etat)
+	{
+		std::istringstream entree(fichier);
+		hockey::Annuaire annuaire("Club");
+		benchmark::DoNotOptimize(importateur.importerParallele(entree, annuaire, p_etat.range(1)));
+	}
+	p_etat.SetItemsProcessed(p_etat.iterations() * p_etat.range(0));
+	p_etat.counters["coeurs"] = std::thread::hardware_concurrency();
+}
+BENCHMARK(BM_ImporterParallele)->Apply(taillesEtFils)->UseRealTime();
@@ -0,0 +1,104 @@
+/**
+ * \file MembreBanc.cpp
+ * \brief Bancs d'essai de la construction des classes Joueur et Entraineur
+ * \author David Jalbert Ross
+ * \version 1.0
+ * \date 16 avril 2020
+ */
+
+#include <benchmark/benchmark.h>
+#include <vector>
+#include "Joueur.h"
+#include "Entraineur.h"
+#include "GenerateurMembres.h"
+
+namespace
+{
+/**
+ * \brief Retourne le premier joueur ou le premier entraineur généré
+ */
+const banc::DonneesMembre& premierMembre(bool p_joueur)
+{
+	static const std::vector<banc::DonneesMembre> membres = banc::genererMembres(2);
+	return p_joueur ? membres[1] : membres[0];
+}
+}
+
+/**
+ * \brief Construction d'un joueur valide par le constructeur
+ */
+static void BM_JoueurConstruction(benchmark::State& p_etat)
+{
+	const banc::DonneesMembre& m = premierMembre(true);
+	for (auto _ : p_etat)
+	{
+		hockey::Joueur joueur(m.m_nom, m.m_prenom, m.m_dateNaissance, m.m_telephone, m.m_position);
+		benchmark::DoNotOptimize(joueur);
+	}
+}
+BENCHMARK(BM_JoueurConstruction);
+
+/**
+ * \brief Construction d'un entraineur valide par le constructeur
+ */
+static void BM_EntraineurConstruction(benchmark::State& p_etat)
+{
+	const banc::DonneesMembre& m = premierMembre(false);
+	for (auto _ : p_etat)
+	{
+		hockey::Entraineur entraineur(m.m_nom, m.m_prenom, m.m_dateNaissance, m.m_telephone, m.m_numRAMQ, m.m_sexe);
+		benchmark::DoNotOptimize(entraineur);
+	}
+}
+BENCHMARK(BM_EntraineurConstruction);
+
+/**
+ * \brief Construction d'un joueur valide par la fabrique Joueur::creer()
+ */
+static void BM_JoueurCreer(benchmark::State& p_etat)
+{
+	const banc::DonneesMembre& m = premierMembre(true);
+	for (auto _ : p_etat)
+	{
+		hockey::Resultat<hockey::Joueur> joueur = hockey::Joueur::creer(m.m_nom, m.m_prenom, m.m_dateNaissance, m.m_telephone,
+																		 m.m_position);
+		benchmark::DoNotOptimize(joueur);
+	}
+}
+BENCHMARK(BM_JoueurCreer);
+
+/**
+ * \brief Rejet d'un joueur à la position invalide par le constructeur, qui lance une exception
+ */
+static void BM_JoueurRejetException(benchmark::State& p_etat)
+{
+	const banc::DonneesMembre& m = premierMembre(true);
+	for (auto _ : p_etat)
+	{
+		try
+		{
+			hockey::Joueur joueur(m.m_nom, m.m_prenom, m.m_dateNaissance, m.m_telephone, "arbitre");
+			benchmark::DoNotOptimize(joueur);
+		}
+		catch (PreconditionException& e)
+		{
+			benchmark::DoNotOptimize(e);
+		}
+	}
+}
+BENCHMARK(BM_JoueurRejetException);
+
+/**
+ * \brief Rejet d'un joueur à la position invalide par la fabrique Joueur::creer()
+ */
+static void BM_JoueurRejetCreer(benchmark::State& p_etat)
+{
+	const banc::DonneesMembre& m = premierMembre(true);
+	for (auto _ : p_etat)
+	{
+		hockey::Resultat<hockey::Joueur> joueur = hockey::Joueur::creer(m.m_nom, m.m_prenom, m.m_dateNaissance, m.m_telephone,
+																		 "arbitre");
+		benchmark::DoNotOptimize(joueur);
+	}
+}
+BENCHMARK(BM_JoueurRejetCreer);
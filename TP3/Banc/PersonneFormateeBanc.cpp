@@ -0,0 +1,174 @@
+/**
+ * \file PersonneFormateeBanc.cpp
+ * \brief Bancs d'essai du formatage d'un membre, comparé à l'ancien formatage par std::ostringstream
+ * \author David Jalbert Ross
+ * \version 1.0
+ * \date 16 avril 2020
+ */
+
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "Entraineur.h"
+#include "GenerateurMembres.h"
+#include "Joueur.h"
+#include "TamponFormatage.h"
+
+namespace
+{
+const unsigned int NB_MEMBRES = 1000;
+
+const char* const JOURS_SEMAINE[] = { "Dimanche", "Lundi", "Mardi", "Mercredi", "Jeudi", "Vendredi", "Samedi" };
+const char* const NOMS_MOIS[] = { "janvier", "fevrier", "mars", "avril", "mai", "juin", "juillet", "aout", "septembre",
+		"octobre", "novembre", "decembre" };
+
+/**
+ * \struct MembreFormate
+ * \brief Un membre construit et son type, pour que la référence n'ait pas à le deviner
+ */
+struct MembreFormate
+{
+	std::unique_ptr<hockey::Personne> m_personne;
+	bool m_estJoueur;
+};
+
+/**
+ * \brief Retourne NB_MEMBRES membres générés, construits une seule fois
+ */
+const std::vector<MembreFormate>& membres()
+{
+	static std::vector<MembreFormate> vMembres;
+	if (vMembres.empty())
+	{
+		for (const banc::DonneesMembre& m : banc::genererMembres(NB_MEMBRES))
+		{
+			std::unique_ptr<hockey::Personne> personne;
+			if (m.m_estJoueur)
+			{
+				personne.reset(new hockey::Joueur(m.m_nom, m.m_prenom, m.m_dateNaissance, m.m_telephone, m.m_position));
+			}
+			else
+			{
+				personne.reset(new hockey::Entraineur(m.m_nom, m.m_prenom, m.m_dateNaissance, m.m_telephone, m.m_numRAMQ,
+													  m.m_sexe));
+			}
+			vMembres.push_back(MembreFormate { std::move(personne), m.m_estJoueur });
+		}
+	}
+	return vMembres;
+}
+
+/**
+ * \brief Référence : l'ancien reqPersonneFormate(), qui écrivait chaque champ dans un
+ * 		  std::ostringstream neuf, la date comprise, avec operator<<
+ * \param[in] p_membre est le membre à formater
+ * \return le texte du membre, identique à celui de reqPersonneFormate()
+ */
+std::string formaterReference(const MembreFormate& p_membre)
+{
+	const hockey::Personne& personne = *p_membre.m_personne;
+	const util::Date& date = personne.reqDateNaissance();
+	std::ostringstream os;
+
+	os << "Nom               : " << personne.reqNom() << '\n';
+	os << "Prenom            : " << personne.reqPrenom() << '\n';
+	os << "Date de naissance : ";
+	// Le 1er janvier 1970 était un jeudi
+	os << JOURS_SEMAINE[(date.reqJoursEpoque() + 4) % 7] << " le ";
+	if (date.reqJour() < 10)
+	{
+		os << '0';
+	}
+	os << date.reqJour() << ' ' << NOMS_MOIS[date.reqMois() - 1] << ' ' << date.reqAnnee();
+	os << '\n';
+	os << "Telephone         : " << personne.reqTelephone() << '\n';
+	if (p_membre.m_estJoueur)
+	{
+		os << "Position          : " << static_cast<const hockey::Joueur&>(personne).reqPosition() << '\n';
+	}
+	else
+	{
+		os << "Numero de RAMQ    : " << static_cast<const hockey::Entraineur&>(personne).reqNumRAMQ() << '\n';
+	}
+	os << "---------------------\n";
+	return os.str();
+}
+
+/**
+ * \brief Vérifie une fois que la référence et formaterPersonne() produisent le même texte,
+ * 		  sans quoi la comparaison des bancs n'aurait pas de sens
+ * \return vrai si les textes de tous les membres sont identiques
+ */
+bool formatsIdentiques()
+{
+	util::TamponFormatage tampon;
+	bool identiques = true;
+	for (const MembreFormate& membre : membres())
+	{
+		tampon.vider();
+		membre.m_personne->formaterPersonne(tampon);
+		identiques = identiques && tampon.reqTexte() == formaterReference(membre);
+	}
+	return identiques;
+}
+}
+
+/**
+ * \brief Référence : formatage de chaque membre dans un std::ostringstream neuf
+ */
+static void BM_PersonneFormateeOstringstream(benchmark::State& p_etat)
+{
+	if (!formatsIdentiques())
+	{
+		p_etat.SkipWithError("la référence ne produit pas le texte de formaterPersonne()");
+	}
+	for (auto _ : p_etat)
+	{
+		for (const MembreFormate& membre : membres())
+		{
+			std::string texte = formaterReference(membre);
+			benchmark::DoNotOptimize(texte);
+		}
+	}
+	p_etat.SetItemsProcessed(p_etat.iterations() * NB_MEMBRES);
+}
+BENCHMARK(BM_PersonneFormateeOstringstream);
+
+/**
+ * \brief reqPersonneFormate() : formatage dans un tampon neuf, copié dans une std::string par membre
+ */
+static void BM_PersonneFormatee(benchmark::State& p_etat)
+{
+	for (auto _ : p_etat)
+	{
+		for (const MembreFormate& membre : membres())
+		{
+			std::string texte = membre.m_personne->reqPersonneFormate();
+			benchmark::DoNotOptimize(texte);
+		}
+	}
+	p_etat.SetItemsProcessed(p_etat.iterations() * NB_MEMBRES);
+}
+BENCHMARK(BM_PersonneFormatee);
+
+/**
+ * \brief formaterPersonne() dans un même tampon vidé à chaque membre, comme le fait l'annuaire
+ */
+static void BM_FormaterPersonne(benchmark::State& p_etat)
+{
+	util::TamponFormatage tampon;
+	for (auto _ : p_etat)
+	{
+		for (const MembreFormate& membre : membres())
+		{
+			tampon.vider();
+			membre.m_personne->formaterPersonne(tampon);
+			benchmark::DoNotOptimize(tampon.reqDonnees());
+		}
+	}
+	p_etat.SetItemsProcessed(p_etat.iterations() * NB_MEMBRES);
+}
+BENCHMARK(BM_FormaterPersonne);
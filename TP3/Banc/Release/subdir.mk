@@ -0,0 +1,41 @@
+################################################################################
+# Automatically-generated file. Do not edit!
+################################################################################
+
+# Add inputs and outputs from these tool invocations to the build variables 
+CPP_SRCS += \
+../AnnuaireBanc.cpp \
+../DateBanc.cpp \
+../GenerateurMembres.cpp \
+../ImportateurAnnuaireBanc.cpp \
+../MembreBanc.cpp \
+../PersonneFormateeBanc.cpp \
+../ValidationFormatBanc.cpp 
+
+OBJS += \
+./AnnuaireBanc.o \
+./DateBanc.o \
+./GenerateurMembres.o \
+./ImportateurAnnuaireBanc.o \
+./MembreBanc.o \
+./PersonneFormateeBanc.o \
+./ValidationFormatBanc.o 
+
+CPP_DEPS += \
+./AnnuaireBanc.d \
+./DateBanc.d \
+./GenerateurMembres.d \
+./ImportateurAnnuaireBanc.d \
+./MembreBanc.d \
+./PersonneFormateeBanc.d \
+./ValidationFormatBanc.d 
+
+
+# Each subdirectory must supply rules for building sources it contributes
+%.o: ../%.cpp
+	@echo 'Building file: $<'
+	@echo 'Invoking: GCC C++ Compiler'
+	g++ -std=c++1y -I"/mnt/hgfs/C++/Sauvegarde TP3 2/TP3/source" -O3 -Wall -c -fmessage-length=0 -MMD -MP -MF"$(@:%.o=%.d)" -MT"$(@)" -o "$@" "$<"
+	@echo 'Finished building: $<'
+	@echo ' '
+
@@ -0,0 +1,161 @@
+/**
+ * \file ValidationFormatBanc.cpp
+ * \brief Bancs d'essai des fonctions de validation de validationFormat
+ * \author David Jalbert Ross
+ * \version 1.0
+ * \date 16 avril 2020
+ */
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "validationFormat.h"
+#include "GenerateurMembres.h"
+
+namespace
+{
+const unsigned int NB_DONNEES = 1024;
+
+/**
+ * \struct ColonnesValidation
+ * \brief Champs de membres générés rangés en colonnes, comme les attendent les validations en lot
+ */
+struct ColonnesValidation
+{
+	ColonnesValidation()
+	{
+		for (const banc::DonneesMembre& membre : banc::genererMembres(NB_DONNEES * 10))
+		{
+			m_noms.push_back(membre.m_nom);
+			m_prenoms.push_back(membre.m_prenom);
+			m_telephones.push_back(membre.m_telephone);
+			if (!membre.m_estJoueur)
+			{
+				m_numerosRAMQ.push_back(membre.m_numRAMQ);
+				m_nomsRAMQ.push_back(membre.m_nom);
+				m_prenomsRAMQ.push_back(membre.m_prenom);
+				m_datesRAMQ.push_back(static_cast<std::uint32_t>(membre.m_dateNaissance.reqAnnee() << 9 |
+										membre.m_dateNaissance.reqMois() << 5 | membre.m_dateNaissance.reqJour()));
+				m_joursRAMQ.push_back(membre.m_dateNaissance);
+				m_sexesRAMQ.push_back(membre.m_sexe);
+			}
+		}
+	}
+
+	std::vector<std::string> m_noms;
+	std::vector<std::string> m_prenoms;
+	std::vector<std::string> m_telephones;
+	std::vector<std::string> m_numerosRAMQ;
+	std::vector<std::string> m_nomsRAMQ;
+	std::vector<std::string> m_prenomsRAMQ;
+	std::vector<std::uint32_t> m_datesRAMQ;
+	std::vector<util::Date> m_joursRAMQ;
+	std::vector<char> m_sexesRAMQ;
+};
+
+const ColonnesValidation& colonnes()
+{
+	static const ColonnesValidation colonnes;
+	return colonnes;
+}
+}
+
+/**
+ * \brief Validation d'un numéro de téléphone à la fois
+ */
+static void BM_validerTelephone(benchmark::State& p_etat)
+{
+	const std::vector<std::string>& telephones = colonnes().m_telephones;
+	std::size_t i = 0;
+	for (auto _ : p_etat)
+	{
+		benchmark::DoNotOptimize(util::validerTelephone(telephones[i]));
+		i = (i + 1) % NB_DONNEES;
+	}
+	p_etat.SetItemsProcessed(p_etat.iterations());
+}
+BENCHMARK(BM_validerTelephone);
+
+/**
+ * \brief Validation d'une colonne de NB_DONNEES numéros de téléphone
+ */
+static void BM_validerTelephones(benchmark::State& p_etat)
+{
+	const std::vector<std::string>& telephones = colonnes().m_telephones;
+	std::unique_ptr<bool[]> valides(new bool[NB_DONNEES]);
+	for (auto _ : p_etat)
+	{
+		benchmark::DoNotOptimize(util::validerTelephones(telephones.data(), NB_DONNEES, valides.get()));
+	}
+	p_etat.SetItemsProcessed(p_etat.iterations() * NB_DONNEES);
+}
+BENCHMARK(BM_validerTelephones);
+
+/**
+ * \brief Validation d'un numéro de RAMQ à la fois
+ */
+static void BM_validerNumRAMQ(benchmark::State& p_etat)
+{
+	const ColonnesValidation& donnees = colonnes();
+	std::size_t i = 0;
+	for (auto _ : p_etat)
+	{
+		const util::Date& naissance = donnees.m_joursRAMQ[i];
+		benchmark::DoNotOptimize(util::validerNumRAMQ(donnees.m_numerosRAMQ[i], donnees.m_nomsRAMQ[i], donnees.m_prenomsRAMQ[i],
+													  naissance.reqJour(), naissance.reqMois(), naissance.reqAnnee(),
+													  donnees.m_sexesRAMQ[i]));
+		i = (i + 1) % NB_DONNEES;
+	}
+	p_etat.SetItemsProcessed(p_etat.iterations());
+}
+BENCHMARK(BM_validerNumRAMQ);
+
+/**
+ * \brief Validation d'une colonne de NB_DONNEES numéros de RAMQ
+ */
+static void BM_validerNumRAMQs(benchmark::State& p_etat)
+{
+	const ColonnesValidation& donnees = colonnes();
+	std::unique_ptr<bool[]> valides(new bool[NB_DONNEES]);
+	for (auto _ : p_etat)
+	{
+		benchmark::DoNotOptimize(util::validerNumRAMQs(donnees.m_numerosRAMQ.data(), donnees.m_nomsRAMQ.data(),
+													   donnees.m_prenomsRAMQ.data(), donnees.m_datesRAMQ.data(),
+													   donnees.m_sexesRAMQ.data(), NB_DONNEES, valides.get()));
+	}
+	p_etat.SetItemsProcessed(p_etat.iterations() * NB_DONNEES);
+}
+BENCHMARK(BM_validerNumRAMQs);
+
+/**
+ * \brief Validation d'un nom ou d'un prénom à la fois, les prénoms comptant des lettres accentuées
+ */
+static void BM_validerFormatNom(benchmark::State& p_etat)
+{
+	const std::vector<std::string>& noms = p_etat.range(0) == 0 ? colonnes().m_noms : colonnes().m_prenoms;
+	std::size_t i = 0;
+	for (auto _ : p_etat)
+	{
+		benchmark::DoNotOptimize(util::validerFormatNom(noms[i]));
+		i = (i + 1) % NB_DONNEES;
+	}
+	p_etat.SetItemsProcessed(p_etat.iterations());
+}
+BENCHMARK(BM_validerFormatNom)->ArgName("prenoms")->Arg(0)->Arg(1);
+
+/**
+ * \brief Validation d'une colonne de NB_DONNEES prénoms
+ */
+static void BM_validerFormatNoms(benchmark::State& p_etat)
+{
+	const std::vector<std::string>& prenoms = colonnes().m_prenoms;
+	std::unique_ptr<bool[]> valides(new bool[NB_DONNEES]);
+	for (auto _ : p_etat)
+	{
+		benchmark::DoNotOptimize(util::validerFormatNoms(prenoms.data(), NB_DONNEES, valides.get()));
+	}
+	p_etat.SetItemsProcessed(p_etat.iterations() * NB_DONNEES);
+}
+BENCHMARK(BM_validerFormatNoms);
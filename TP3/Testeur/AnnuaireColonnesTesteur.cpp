@@ -0,0 +1,123 @@
+/**
+ * \file AnnuaireColonnesTesteur.cpp
+ * \brief  Fichier de tests unitaires pour les classes AnnuaireColonnes et MembreVue
+ * \author David J Ross
+ * \version 1
+ * \date 16 avril 2020
+ */
+
+#include <gtest/gtest.h>
+#include "AnnuaireColonnes.h"
+#include "Annuaire.h"
+#include "Joueur.h"
+#include "Entraineur.h"
+#include "Date.h"
+
+/**
+ * \class AnnuaireColonnesBase
+ * \brief Fixture pour la création d'un objet AnnuaireColonnes à partir d'un Annuaire
+ * contenant un joueur et un entraineur
+ */
+class AnnuaireColonnesBase : public ::testing::Test
+{
+public:
+	AnnuaireColonnesBase():f_annuaire("Test"), f_colonnes("Vide")
+	{
+		f_annuaire.ajouterPersonne(hockey::Joueur("Nom", "Prenom", util::Date(25, 8, 2004), "418 498-4193", "centre"));
+		f_annuaire.ajouterPersonne(hockey::Entraineur("Jalbert", "David", util::Date(25, 8, 1999), "581 337-2278", "JALD 9908 2511", 'M'));
+		f_colonnes = hockey::AnnuaireColonnes(f_annuaire);
+	}
+
+	hockey::Annuaire f_annuaire;
+	hockey::AnnuaireColonnes f_colonnes;
+};
+
+/**
+ * \brief Test du Constructeur AnnuaireColonnes::AnnuaireColonnes(const Annuaire& p_annuaire)
+ * cas valide : <br>
+ * 	ConstructionDepuisAnnuaire : les membres sont repris dans le même ordre
+ * <br>
+ * cas invalide : <br>
+ * 	Aucun d'identifié
+ */
+TEST_F(AnnuaireColonnesBase, ConstructionDepuisAnnuaire)
+{
+	ASSERT_EQ("Test", f_colonnes.reqNomClub());
+	ASSERT_EQ(2u, f_colonnes.reqNbMembres());
+	ASSERT_TRUE(f_colonnes.reqMembre(0).estJoueur());
+	ASSERT_TRUE(f_colonnes.reqMembre(1).estEntraineur());
+}
+
+/**
+ * \brief Test des accesseurs de la classe MembreVue
+ * cas valide : <br>
+ * 	AccesseursJoueur : les attributs d'un joueur sont restitués
+ * 	AccesseursEntraineur : les attributs d'un entraineur sont restitués
+ * <br>
+ * cas invalide : <br>
+ * 	AccesseurRoleInvalide : demande de la position d'un entraineur
+ */
+TEST_F(AnnuaireColonnesBase, AccesseursJoueur)
+{
+	hockey::MembreVue vue = f_colonnes.reqMembre(0);
+	ASSERT_EQ("Nom", vue.reqNom());
+	ASSERT_EQ("Prenom", vue.reqPrenom());
+	ASSERT_EQ(util::Date(25, 8, 2004), vue.reqDateNaissance());
+	ASSERT_EQ("418 498-4193", vue.reqTelephone());
+	ASSERT_EQ("centre", vue.reqPosition());
+}
+
+TEST_F(AnnuaireColonnesBase, AccesseursEntraineur)
+{
+	hockey::MembreVue vue = f_colonnes.reqMembre(1);
+	ASSERT_EQ("Jalbert", vue.reqNom());
+	ASSERT_EQ(util::Date(25, 8, 1999), vue.reqDateNaissance());
+	ASSERT_EQ("581 337-2278", vue.reqTelephone());
+	ASSERT_EQ("JALD 9908 2511", vue.reqNumRAMQ());
+	ASSERT_EQ('M', vue.reqSexe());
+}
+
+TEST_F(AnnuaireColonnesBase, AccesseurRoleInvalide)
+{
+	ASSERT_THROW(f_colonnes.reqMembre(1).reqPosition(), PreconditionException);
+	ASSERT_THROW(f_colonnes.reqMembre(2), PreconditionException);
+}
+
+/**
+ * \brief Test des colonnes de balayage
+ * cas valide : <br>
+ * 	ColonnesOrdonnees : les dates compactées conservent l'ordre des dates et
+ * 						les téléphones sont encodés en entier
+ * <br>
+ * cas invalide : <br>
+ * 	Aucun d'identifié
+ */
+TEST_F(AnnuaireColonnesBase, ColonnesOrdonnees)
+{
+	const std::vector<std::uint32_t>& dates = f_colonnes.reqColonneDatesNaissance();
+	ASSERT_TRUE(dates[1] < dates[0]);
+	ASSERT_EQ(4184984193u, f_colonnes.reqColonneTelephones()[0]);
+	ASSERT_EQ(hockey::RoleMembre::Entraineur, f_colonnes.reqColonneRoles()[1]);
+}
+
+/**
+ * \brief Test de la table des chaînes internées
+ * cas valide : <br>
+ * 	ChainesInternees : une même chaîne n'est conservée qu'une fois, quelle que soit sa colonne,
+ * 					   et des chaînes distinctes restent distinctes
+ * <br>
+ * cas invalide : <br>
+ * 	Aucun d'identifié
+ */
+TEST_F(AnnuaireColonnesBase, ChainesInternees)
+{
+	f_colonnes.ajouterPersonne(hockey::Joueur("Prenom", "Nom", util::Date(25, 8, 2004), "418 498-4193", "centre"));
+	f_colonnes.ajouterPersonne(hockey::Joueur("Nom", "Prenoms", util::Date(25, 8, 2004), "418 498-4193", "ailier"));
+
+	ASSERT_EQ(&f_colonnes.reqMembre(0).reqNom(), &f_colonnes.reqMembre(2).reqPrenom());
+	ASSERT_EQ(&f_colonnes.reqMembre(0).reqPrenom(), &f_colonnes.reqMembre(2).reqNom());
+	ASSERT_EQ(&f_colonnes.reqMembre(0).reqPosition(), &f_colonnes.reqMembre(2).reqPosition());
+	ASSERT_EQ(&f_colonnes.reqMembre(0).reqNom(), &f_colonnes.reqMembre(3).reqNom());
+	ASSERT_EQ("Prenoms", f_colonnes.reqMembre(3).reqPrenom());
+	ASSERT_EQ("ailier", f_colonnes.reqMembre(3).reqPosition());
+}
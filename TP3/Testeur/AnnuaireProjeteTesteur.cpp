@@ -0,0 +1,152 @@
+/**
+ * \file AnnuaireProjeteTesteur.cpp
+ * \brief  Fichier de tests unitaires pour les classes AnnuaireProjete et MembreProjete
+ * \author David J Ross
+ * \version 1
+ * \date 16 avril 2020
+ */
+
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <string>
+#include "AnnuaireProjete.h"
+#include "Annuaire.h"
+#include "Joueur.h"
+#include "Entraineur.h"
+
+/**
+ * \class AnnuaireProjeteMembres
+ * \brief Fixture qui sauvegarde un annuaire de trois membres et en ouvre l'instantané en lecture seule
+ */
+class AnnuaireProjeteMembres : public ::testing::Test
+{
+public:
+	AnnuaireProjeteMembres():f_annuaire("Test"), f_chemin(::testing::TempDir() + "AnnuaireProjete.bin")
+	{
+		f_annuaire.ajouterPersonne(hockey::Joueur("Tremblay", "Luc", util::Date(25, 8, 2004), "581 337-2278", "centre"));
+		f_annuaire.ajouterPersonne(hockey::Entraineur("Jalbert", "David", util::Date(25, 8, 1999), "418 498-4193",
+													  "JALD 9908 2511", 'M'));
+		f_annuaire.ajouterPersonne(hockey::Joueur("Nom", "Prenom", util::Date(25, 8, 2004), "418 498-4193", "ailier"));
+		f_annuaire.sauvegarder(f_chemin);
+		f_projete.ouvrir(f_chemin);
+	}
+
+	~AnnuaireProjeteMembres()
+	{
+		std::remove(f_chemin.c_str());
+	}
+
+	hockey::Annuaire f_annuaire;
+	std::string f_chemin;
+	hockey::AnnuaireProjete f_projete;
+};
+
+/**
+ * \brief Test de la méthode bool ouvrir(const std::string& p_fichier)
+ * cas valide : <br>
+ * 	ouvrirValide :	Le club et les membres se lisent dans l'instantané projeté
+ * <br>
+ * cas invalide : <br>
+ * 	ouvrirAbsent :	Fichier inexistant, l'annuaire reste fermé
+ */
+TEST_F(AnnuaireProjeteMembres, ouvrirValide)
+{
+	ASSERT_TRUE(f_projete.estOuvert());
+	ASSERT_EQ("Test", f_projete.reqNomClub());
+	ASSERT_EQ(3u, f_projete.reqNbMembres());
+
+	hockey::MembreProjete entraineur = f_projete.reqMembre(1);
+	ASSERT_TRUE(entraineur.estEntraineur());
+	ASSERT_EQ("Jalbert", entraineur.reqNom().reqTexte());
+	ASSERT_EQ("David", entraineur.reqPrenom().reqTexte());
+	ASSERT_EQ(util::Date(25, 8, 1999), entraineur.reqDateNaissance());
+	ASSERT_EQ("418 498-4193", entraineur.reqTelephone());
+	ASSERT_EQ("JALD 9908 2511", entraineur.reqNumRAMQ().reqTexte());
+	ASSERT_EQ('M', entraineur.reqSexe());
+	ASSERT_THROW(entraineur.reqPosition(), PreconditionException);
+
+	ASSERT_EQ("ailier", f_projete.reqMembre(2).reqPosition().reqTexte());
+}
+
+TEST(AnnuaireProjete, ouvrirAbsent)
+{
+	hockey::AnnuaireProjete projete;
+	ASSERT_FALSE(projete.ouvrir(::testing::TempDir() + "AnnuaireProjeteAbsent.bin"));
+	ASSERT_FALSE(projete.estOuvert());
+	ASSERT_THROW(projete.trouverParNumRAMQ("JALD 9908 2511"), PreconditionException);
+}
+
+/**
+ * \brief Test de la méthode std::string reqAnnuaireFormate() const
+ * cas valide : <br>
+ * 	reqAnnuaireFormateIdentique : Même texte que l'annuaire sauvegardé
+ * <br>
+ * cas invalide : <br>
+ * 	Aucun d'identifié
+ */
+TEST_F(AnnuaireProjeteMembres, reqAnnuaireFormateIdentique)
+{
+	ASSERT_EQ(f_annuaire.reqAnnuaireFormate(), f_projete.reqAnnuaireFormate());
+}
+
+/**
+ * \brief Test des méthodes de recherche
+ * cas valide : <br>
+ * 	trouverPersonneValide :	Recherche par identité de chaque membre
+ * 	trouverParTelephoneValide : Numéro partagé par deux membres, retournés dans l'ordre d'ajout
+ * 	trouverParNumRAMQValide : Numéro présent, sans égard à la casse
+ * 	trouverParNumRAMQPlusieurs : Plusieurs entraineurs ajoutés dans le désordre, numéro partagé par deux entraineurs
+ * <br>
+ * cas invalide : <br>
+ * 	trouverAbsent : Identité, téléphone ou numéro de RAMQ absent ou mal formé
+ */
+TEST_F(AnnuaireProjeteMembres, trouverPersonneValide)
+{
+	ASSERT_EQ(0, f_projete.trouverPersonne("Tremblay", "Luc", util::Date(25, 8, 2004)));
+	ASSERT_EQ(1, f_projete.trouverPersonne("Jalbert", "David", util::Date(25, 8, 1999)));
+	ASSERT_EQ(2, f_projete.trouverPersonne("Nom", "Prenom", util::Date(25, 8, 2004)));
+}
+
+TEST_F(AnnuaireProjeteMembres, trouverParTelephoneValide)
+{
+	std::vector<unsigned int> vTrouves = f_projete.trouverParTelephone("418 498-4193");
+	ASSERT_EQ(2u, vTrouves.size());
+	ASSERT_EQ(1u, vTrouves[0]);
+	ASSERT_EQ(2u, vTrouves[1]);
+}
+
+TEST_F(AnnuaireProjeteMembres, trouverParNumRAMQValide)
+{
+	ASSERT_EQ(1, f_projete.trouverParNumRAMQ("jald 9908 2511"));
+}
+
+TEST_F(AnnuaireProjeteMembres, trouverParNumRAMQPlusieurs)
+{
+	f_annuaire.ajouterPersonne(hockey::Entraineur("Cote", "Anne", util::Date(1, 5, 1980), "418 555-1234",
+												  "cota 8055 0112", 'F'));
+	f_annuaire.ajouterPersonne(hockey::Entraineur("Jalbertte", "Dominique", util::Date(25, 8, 1999), "418 555-1234",
+												  "JALD 9908 2511", 'M'));
+	f_annuaire.ajouterPersonne(hockey::Entraineur("Roy", "Marc", util::Date(3, 3, 1975), "418 555-1234",
+												  "ROYM 7503 0345", 'M'));
+	std::string chemin = ::testing::TempDir() + "AnnuaireProjeteRAMQ.bin";
+	ASSERT_TRUE(f_annuaire.sauvegarder(chemin));
+	hockey::AnnuaireProjete projete;
+	ASSERT_TRUE(projete.ouvrir(chemin));
+	std::remove(chemin.c_str());
+
+	ASSERT_EQ(3, projete.trouverParNumRAMQ("COTA 8055 0112"));
+	ASSERT_EQ(1, projete.trouverParNumRAMQ("Jald 9908 2511"));
+	ASSERT_EQ(5, projete.trouverParNumRAMQ("roym 7503 0345"));
+	ASSERT_EQ(-1, projete.trouverParNumRAMQ("COTA 8055 011"));
+	ASSERT_EQ(-1, projete.trouverParNumRAMQ("ZZZZ 9999 9999"));
+}
+
+TEST_F(AnnuaireProjeteMembres, trouverAbsent)
+{
+	ASSERT_EQ(-1, f_projete.trouverPersonne("Nom", "Prenom", util::Date(26, 8, 2004)));
+	ASSERT_EQ(-1, f_projete.trouverPersonne("Absent", "Prenom", util::Date(25, 8, 2004)));
+	ASSERT_EQ(-1, f_projete.trouverPersonne("Nom", "David", util::Date(25, 8, 2004)));
+	ASSERT_TRUE(f_projete.trouverParTelephone("418 656-2131").empty());
+	ASSERT_TRUE(f_projete.trouverParTelephone("418").empty());
+	ASSERT_EQ(-1, f_projete.trouverParNumRAMQ("JALD 9908 2512"));
+}
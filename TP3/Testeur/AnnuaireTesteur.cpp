@@ -10,11 +10,105 @@
 #include <gtest/gtest.h>
 #include "Annuaire.h"
 #include "Joueur.h"
+#include "Entraineur.h"
 #include "Date.h"
 #include "validationFormat.h"
+#include <sstream>
+#include <utility>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <fstream>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <memory>
+#include <thread>
 
 
 
+/**
+ * Remplacement des opérateurs new et delete globaux de l'exécutable de test, pour compter les
+ * allocations faites pendant un test. Le compteur est atomique : d'autres tests allouent depuis
+ * plusieurs fils.
+ */
+static std::atomic<unsigned long> g_nbAllocations(0);
+
+void* operator new(std::size_t p_taille)
+{
+	g_nbAllocations++;
+	void* espace = std::malloc(p_taille == 0 ? 1 : p_taille);
+	if (espace == nullptr)
+	{
+		throw std::bad_alloc();
+	}
+	return espace;
+}
+
+void* operator new[](std::size_t p_taille)
+{
+	return ::operator new(p_taille);
+}
+
+void* operator new(std::size_t p_taille, const std::nothrow_t&) noexcept
+{
+	g_nbAllocations++;
+	return std::malloc(p_taille == 0 ? 1 : p_taille);
+}
+
+void* operator new[](std::size_t p_taille, const std::nothrow_t& p_nothrow) noexcept
+{
+	return ::operator new(p_taille, p_nothrow);
+}
+
+void operator delete(void* p_espace) noexcept
+{
+	std::free(p_espace);
+}
+
+void operator delete[](void* p_espace) noexcept
+{
+	std::free(p_espace);
+}
+
+void operator delete(void* p_espace, std::size_t) noexcept
+{
+	std::free(p_espace);
+}
+
+void operator delete[](void* p_espace, std::size_t) noexcept
+{
+	std::free(p_espace);
+}
+
+void operator delete(void* p_espace, const std::nothrow_t&) noexcept
+{
+	std::free(p_espace);
+}
+
+void operator delete[](void* p_espace, const std::nothrow_t&) noexcept
+{
+	std::free(p_espace);
+}
+
+/**
+ * \brief Ajoute à un annuaire des joueurs dont les noms de quatre lettres sont tous différents
+ * \param[in,out] p_annuaire est l'annuaire à remplir
+ * \param[in] p_nbMembres est le nombre de joueurs à ajouter
+ */
+static void remplirAnnuaire(hockey::Annuaire& p_annuaire, unsigned int p_nbMembres)
+{
+	for (unsigned int i = 0; i < p_nbMembres; i++)
+	{
+		std::string nom;
+		for (unsigned int reste = i; nom.length() < 4; reste /= 26)
+		{
+			nom += static_cast<char>('a' + reste % 26);
+		}
+		p_annuaire.ajouterPersonne(hockey::Joueur(nom, "Prenom", util::Date(25, 8, 2004), "418 498-4193", "centre"));
+	}
+}
+
 /**
  * \brief Test du Constructeur Annuaire::Annuaire(const std::string p_nomClub) et de
 								Annuaire::Annuaire(const Annuaire& p_annuaire)
@@ -28,7 +122,7 @@
 TEST(AnnuaireConstructeur, AnnuaireVideValide)
 {
 	hockey::Annuaire a("Test");
-	ASSERT_TRUE(a.m_vMembres.size() == 0);
+	ASSERT_TRUE(a.reqNbMembres() == 0);
 	ASSERT_TRUE(a.reqNomClub() == "Test");
 }
 
@@ -39,7 +133,7 @@ TEST(AnnuaireConstructeur, AnnuaireNonVideValide)
 	hockey::Annuaire a("Test");
 	a.ajouterPersonne(j);
 	hockey::Annuaire b(a);
-	ASSERT_TRUE(b.m_vMembres.size() == 1);
+	ASSERT_TRUE(b.reqNbMembres() == 1);
 	ASSERT_TRUE(b.reqNomClub() == "Test");
 }
 
@@ -82,13 +176,262 @@ TEST_F(AnnuaireBase, ajouterPersonneValide)
 	util::Date d(25, 8, 2004);
 	hockey::Joueur j("Nom", "Prenom", d, "418 498-4193", "centre");
 	f_annuaireBase.ajouterPersonne(j);
-	ASSERT_TRUE(f_annuaireBase.m_vMembres.size() == 1);
+	ASSERT_TRUE(f_annuaireBase.reqNbMembres() == 1);
+}
+
+/**
+ * \brief Test de la méthode void ajouterPersonne (const Personne& p_personne) avec un doublon
+ * cas valide : <br>
+ * 	Aucun d'identifié
+ * <br>
+ * cas invalide : <br>
+ * 	ajouterPersonneDejaPresente : Ajout d'une personne égale à un membre existant
+ */
+TEST_F(AnnuaireBase, ajouterPersonneDejaPresente)
+{
+	util::Date d(25, 8, 2004);
+	f_annuaireBase.ajouterPersonne(hockey::Joueur("Nom", "Prenom", d, "418 498-4193", "centre"));
+	ASSERT_THROW(f_annuaireBase.ajouterPersonne(hockey::Joueur("Nom", "Prenom", d, "581 337-2278", "ailier")), PreconditionException);
+}
+
+/**
+ * \brief Test des méthodes bool ajouterPersonneSiAbsente(const Personne& p_personne) et
+ * 		  bool ajouterPersonneSiAbsente(Personne&& p_personne)
+ * cas valide : <br>
+ * 	ajouterPersonneSiAbsenteValide : Ajout d'un joueur absent, retrouvé ensuite par identité
+ * 	ajouterPersonneSiAbsenteCopie : Une copie qui partage le registre n'est pas modifiée
+ * 	ajouterPersonneSiAbsenteConstante : Le membre passé par référence constante est copié et reste intact
+ * 	ajouterPersonneSiAbsenteDeplace : Le membre passé par déplacement cède ses chaînes sans qu'elles soient copiées
+ * <br>
+ * cas invalide : <br>
+ * 	ajouterPersonneSiAbsenteDejaPresente : Personne égale à un membre existant, l'annuaire est laissé intact
+ */
+TEST_F(AnnuaireBase, ajouterPersonneSiAbsenteValide)
+{
+	util::Date d(25, 8, 2004);
+	ASSERT_TRUE(f_annuaireBase.ajouterPersonneSiAbsente(hockey::Joueur("Nom", "Prenom", d, "418 498-4193", "centre")));
+	ASSERT_EQ(1u, f_annuaireBase.reqNbMembres());
+	ASSERT_TRUE(f_annuaireBase.trouverPersonne("Nom", "Prenom", d) != nullptr);
+}
+
+TEST_F(AnnuaireBase, ajouterPersonneSiAbsenteCopie)
+{
+	util::Date d(25, 8, 2004);
+	f_annuaireBase.ajouterPersonne(hockey::Joueur("Nom", "Prenom", d, "418 498-4193", "centre"));
+	hockey::Annuaire copie(f_annuaireBase);
+	ASSERT_TRUE(copie.ajouterPersonneSiAbsente(hockey::Joueur("Autre", "Prenom", d, "418 498-4193", "centre")));
+	ASSERT_EQ(2u, copie.reqNbMembres());
+	ASSERT_EQ(1u, f_annuaireBase.reqNbMembres());
+}
+
+TEST_F(AnnuaireBase, ajouterPersonneSiAbsenteConstante)
+{
+	const hockey::Joueur joueur("Nom", "Prenom", util::Date(25, 8, 2004), "418 498-4193", "centre");
+	ASSERT_TRUE(f_annuaireBase.ajouterPersonneSiAbsente(joueur));
+	ASSERT_EQ("Nom", joueur.reqNom());
+	ASSERT_NE(&joueur, &f_annuaireBase.reqMembre(0));
+	ASSERT_TRUE(f_annuaireBase.reqMembre(0) == joueur);
+}
+
+TEST_F(AnnuaireBase, ajouterPersonneSiAbsenteDeplace)
+{
+	util::Date d(25, 8, 2004);
+	hockey::Joueur joueur("Vaillancourtdesrosiers", "Prenom", d, "418 498-4193", "centre");
+	const char* nom = joueur.reqNom().data();
+
+	ASSERT_TRUE(f_annuaireBase.ajouterPersonneSiAbsente(std::move(joueur)));
+	ASSERT_EQ(1u, f_annuaireBase.reqNbMembres());
+	ASSERT_EQ(nom, f_annuaireBase.reqMembre(0).reqNom().data());
+	ASSERT_TRUE(f_annuaireBase.trouverPersonne("Vaillancourtdesrosiers", "Prenom", d) != nullptr);
+}
+
+TEST_F(AnnuaireBase, ajouterPersonneSiAbsenteDejaPresente)
+{
+	util::Date d(25, 8, 2004);
+	f_annuaireBase.ajouterPersonne(hockey::Joueur("Nom", "Prenom", d, "418 498-4193", "centre"));
+	ASSERT_FALSE(f_annuaireBase.ajouterPersonneSiAbsente(hockey::Joueur("Nom", "Prenom", d, "581 337-2278", "ailier")));
+	ASSERT_EQ(1u, f_annuaireBase.reqNbMembres());
+	ASSERT_EQ("418 498-4193", f_annuaireBase.reqMembre(0).reqTelephone());
+}
+
+/**
+ * \class AnnuaireMembres
+ * \brief Fixture pour la création d'un objet Annuaire contenant un joueur et un entraineur
+ */
+class AnnuaireMembres : public ::testing::Test
+{
+public:
+	AnnuaireMembres():f_annuaire("Test"),
+		f_joueur("Nom", "Prenom", util::Date(25, 8, 2004), "418 498-4193", "centre"),
+		f_entraineur("Jalbert", "David", util::Date(25, 8, 1999), "418 498-4193", "JALD 9908 2511", 'M')
+	{
+		f_annuaire.ajouterPersonne(f_joueur);
+		f_annuaire.ajouterPersonne(f_entraineur);
+	}
+
+	hockey::Annuaire f_annuaire;
+	hockey::Joueur f_joueur;
+	hockey::Entraineur f_entraineur;
+};
+
+/**
+ * \brief Test de la méthode const Personne* trouverPersonne(...) const
+ * cas valide : <br>
+ * 	trouverPersonneValide :	Recherche d'un membre présent
+ * <br>
+ * cas invalide : <br>
+ * 	trouverPersonneAbsente : Recherche d'une personne absente de l'annuaire
+ */
+TEST_F(AnnuaireMembres, trouverPersonneValide)
+{
+	const hockey::Personne* p = f_annuaire.trouverPersonne("Nom", "Prenom", util::Date(25, 8, 2004));
+	ASSERT_TRUE(p != nullptr);
+	ASSERT_TRUE(*p == f_joueur);
+	ASSERT_TRUE(f_annuaire.personneEstDejaPresente(f_entraineur));
+}
+
+TEST_F(AnnuaireMembres, trouverPersonneAbsente)
+{
+	ASSERT_TRUE(f_annuaire.trouverPersonne("Nom", "Prenom", util::Date(26, 8, 2004)) == nullptr);
+	ASSERT_TRUE(f_annuaire.trouverPersonne("Autre", "Prenom", util::Date(25, 8, 2004)) == nullptr);
+}
+
+/**
+ * \brief Test de la méthode std::vector<const Personne*> trouverParTelephone(const std::string& p_telephone) const
+ * cas valide : <br>
+ * 	trouverParTelephoneValide :	Recherche d'un numéro partagé par deux membres
+ * <br>
+ * cas invalide : <br>
+ * 	trouverParTelephoneAbsent : Recherche d'un numéro qu'aucun membre n'a
+ */
+TEST_F(AnnuaireMembres, trouverParTelephoneValide)
+{
+	ASSERT_EQ(2u, f_annuaire.trouverParTelephone("418 498-4193").size());
+}
+
+TEST_F(AnnuaireMembres, trouverParTelephoneAbsent)
+{
+	ASSERT_TRUE(f_annuaire.trouverParTelephone("581 337-2278").empty());
+}
+
+/**
+ * \brief Test de la méthode const Entraineur* trouverParNumRAMQ(const std::string& p_numRAMQ) const
+ * cas valide : <br>
+ * 	trouverParNumRAMQValide : Recherche d'un numéro présent, sans égard à la casse
+ * <br>
+ * cas invalide : <br>
+ * 	trouverParNumRAMQAbsent : Recherche d'un numéro absent
+ */
+TEST_F(AnnuaireMembres, trouverParNumRAMQValide)
+{
+	const hockey::Entraineur* e = f_annuaire.trouverParNumRAMQ("jald 9908 2511");
+	ASSERT_TRUE(e != nullptr);
+	ASSERT_EQ("Jalbert", e->reqNom());
+}
+
+TEST_F(AnnuaireMembres, trouverParNumRAMQAbsent)
+{
+	ASSERT_TRUE(f_annuaire.trouverParNumRAMQ("JALD 9908 2512") == nullptr);
+}
+
+/**
+ * \brief Test de la méthode bool retirerPersonne(const Personne& p_personne)
+ * cas valide : <br>
+ * 	retirerPersonneValide :	Retrait d'un membre présent, les index sont mis à jour
+ * 	retirerPersonneGardeOrdre : Les autres membres gardent leur ordre d'ajout et restent trouvés par
+ * 								chacun des index, puis peuvent être retirés à leur tour
+ * 	retirerPersonneCompactage : Après assez de retraits pour compacter le registre, l'ordre d'ajout,
+ * 								les index et une copie faite avant le compactage restent cohérents
+ * <br>
+ * cas invalide : <br>
+ * 	retirerPersonneAbsente : Retrait d'une personne absente
+ */
+TEST_F(AnnuaireMembres, retirerPersonneValide)
+{
+	ASSERT_TRUE(f_annuaire.retirerPersonne(f_entraineur));
+	ASSERT_EQ(1u, f_annuaire.reqNbMembres());
+	ASSERT_TRUE(f_annuaire.trouverParNumRAMQ("JALD 9908 2511") == nullptr);
+	ASSERT_EQ(1u, f_annuaire.trouverParTelephone("418 498-4193").size());
+	ASSERT_TRUE(f_annuaire.reqMembre(0) == f_joueur);
+}
+
+TEST_F(AnnuaireMembres, retirerPersonneGardeOrdre)
+{
+	hockey::Joueur j("Autre", "Prenom", util::Date(25, 8, 2004), "418 555-1234", "centre");
+	f_annuaire.ajouterPersonne(j);
+
+	ASSERT_TRUE(f_annuaire.retirerPersonne(f_joueur));
+	ASSERT_EQ(2u, f_annuaire.reqNbMembres());
+	ASSERT_TRUE(f_annuaire.reqMembre(0) == f_entraineur);
+	ASSERT_TRUE(f_annuaire.reqMembre(1) == j);
+	ASSERT_TRUE(f_annuaire.trouverPersonne("Autre", "Prenom", util::Date(25, 8, 2004)) == &f_annuaire.reqMembre(1));
+	ASSERT_EQ(1u, f_annuaire.trouverParTelephone("418 555-1234").size());
+	ASSERT_EQ(1u, f_annuaire.trouverParTelephone("418 498-4193").size());
+	ASSERT_TRUE(f_annuaire.trouverParNumRAMQ("JALD 9908 2511") == &f_annuaire.reqMembre(0));
+
+	ASSERT_TRUE(f_annuaire.retirerPersonne(f_entraineur));
+	ASSERT_TRUE(f_annuaire.reqMembre(0) == j);
+	ASSERT_TRUE(f_annuaire.trouverParNumRAMQ("JALD 9908 2511") == nullptr);
+	ASSERT_TRUE(f_annuaire.retirerPersonne(j));
+	ASSERT_EQ(0u, f_annuaire.reqNbMembres());
+	ASSERT_TRUE(f_annuaire.trouverParTelephone("418 555-1234").empty());
+}
+
+TEST(Annuaire, retirerPersonneCompactage)
+{
+	hockey::Annuaire annuaire("Club");
+	std::vector<hockey::Joueur> vJoueurs;
+	for (int i = 0; i < 300; i++)
+	{
+		std::string nom = "Nom";
+		for (int reste = i; reste > 0 || nom.length() == 3; reste /= 26)
+		{
+			nom += static_cast<char>('a' + reste % 26);
+		}
+		vJoueurs.push_back(hockey::Joueur(nom, "Prenom", util::Date(25, 8, 2004), "418 555-1234", "centre"));
+		annuaire.ajouterPersonne(vJoueurs.back());
+	}
+
+	hockey::Annuaire copie("Copie");
+	for (int i = 0; i < 300; i += 3)
+	{
+		ASSERT_TRUE(annuaire.retirerPersonne(vJoueurs[i]));
+		if (i == 6)
+		{
+			copie = annuaire;
+			copie.ajouterPersonne(hockey::Joueur("Copie", "Prenom", util::Date(25, 8, 2004), "418 555-1234", "centre"));
+		}
+	}
+
+	ASSERT_EQ(200u, annuaire.reqNbMembres());
+	ASSERT_EQ(200u, annuaire.trouverParTelephone("418 555-1234").size());
+	for (unsigned int i = 0; i < 200; i++)
+	{
+		const hockey::Joueur& attendu = vJoueurs[i / 2 * 3 + 1 + i % 2];
+		ASSERT_TRUE(annuaire.reqMembre(i) == attendu) << i;
+		ASSERT_TRUE(annuaire.trouverPersonne(attendu.reqNom(), "Prenom", util::Date(25, 8, 2004)) == &annuaire.reqMembre(i));
+	}
+
+	ASSERT_EQ(298u, copie.reqNbMembres());
+	ASSERT_TRUE(copie.reqMembre(0) == vJoueurs[1]);
+	ASSERT_TRUE(copie.reqMembre(4) == vJoueurs[7]);
+	ASSERT_TRUE(copie.reqMembre(5) == vJoueurs[8]);
+	ASSERT_EQ("Copie", copie.reqMembre(297).reqNom());
+	ASSERT_TRUE(copie.trouverPersonne("Copie", "Prenom", util::Date(25, 8, 2004)) == &copie.reqMembre(297));
+}
+
+TEST_F(AnnuaireMembres, retirerPersonneAbsente)
+{
+	hockey::Joueur j("Autre", "Prenom", util::Date(25, 8, 2004), "418 498-4193", "centre");
+	ASSERT_FALSE(f_annuaire.retirerPersonne(j));
+	ASSERT_EQ(2u, f_annuaire.reqNbMembres());
 }
 
 /**
  * \brief Test de la méthode void operator=(const Annuaire& p_annuaire)
  * cas valide : <br>
  * 	ajouterPersonneValide :	Assignation d'un annuaire valide avec un opérateur =
+ * 	AssignerRemplaceMembres : Assignation qui remplace les membres existants, y compris à soi-même
  * <br>
  * cas invalide : <br>
  * 	Aucun d'identifié
@@ -100,3 +443,507 @@ TEST_F(AnnuaireBase, AssignerValide)
 
 }
 
+TEST_F(AnnuaireMembres, AssignerRemplaceMembres)
+{
+	hockey::Annuaire a("Autre");
+	a.ajouterPersonne(hockey::Joueur("Autre", "Prenom", util::Date(25, 8, 2004), "418 498-4193", "centre"));
+	a = f_annuaire;
+	ASSERT_EQ("Test", a.reqNomClub());
+	ASSERT_EQ(2u, a.reqNbMembres());
+	ASSERT_TRUE(a.trouverPersonne("Autre", "Prenom", util::Date(25, 8, 2004)) == nullptr);
+	ASSERT_TRUE(a.personneEstDejaPresente(f_joueur));
+	a = a;
+	ASSERT_EQ(2u, a.reqNbMembres());
+}
+
+
+/**
+ * \brief Test des méthodes const std::string reqAnnuaireFormate() const et
+ * 		  void ecrireAnnuaireFormate(std::ostream& p_os) const
+ * cas valide : <br>
+ * 	reqAnnuaireFormateValide :	Format attendu pour un joueur et un entraineur
+ * 	ecrireAnnuaireFormateIdentique : L'écriture dans un flux produit exactement le même texte
+ * <br>
+ * cas invalide : <br>
+ * 	Aucun d'identifié
+ */
+TEST_F(AnnuaireMembres, reqAnnuaireFormateValide)
+{
+	ASSERT_EQ("Club   : Test\n"
+			  "--------------------\n"
+			  "Nom               : Nom\n"
+			  "Prenom            : Prenom\n"
+			  "Date de naissance : Mercredi le 25 aout 2004\n"
+			  "Telephone         : 418 498-4193\n"
+			  "Position          : centre\n"
+			  "---------------------\n"
+			  "Nom               : Jalbert\n"
+			  "Prenom            : David\n"
+			  "Date de naissance : Mercredi le 25 aout 1999\n"
+			  "Telephone         : 418 498-4193\n"
+			  "Numero de RAMQ    : JALD 9908 2511\n"
+			  "---------------------\n", f_annuaire.reqAnnuaireFormate());
+}
+
+TEST_F(AnnuaireMembres, ecrireAnnuaireFormateIdentique)
+{
+	std::ostringstream os;
+	f_annuaire.ecrireAnnuaireFormate(os);
+	ASSERT_EQ(f_annuaire.reqAnnuaireFormate(), os.str());
+}
+
+/**
+ * \brief Test des méthodes bool sauvegarder(const std::string& p_fichier) const et
+ * 		  bool charger(const std::string& p_fichier)
+ * cas valide : <br>
+ * 	sauvegarderChargerValide : L'annuaire rechargé a le même club, les mêmes membres et les mêmes index
+ * 	sauvegarderChargerNomsLongs : Des noms qui ne diffèrent qu'après leurs huit premières lettres sont rechargés et ordonnés
+ * <br>
+ * cas invalide : <br>
+ * 	chargerFichierAbsent : Fichier inexistant, l'annuaire est laissé intact
+ * 	chargerFichierCorrompu : Fichier qui n'est pas un instantané, l'annuaire est laissé intact
+ */
+TEST_F(AnnuaireMembres, sauvegarderChargerValide)
+{
+	std::string chemin = ::testing::TempDir() + "AnnuaireInstantane.bin";
+	ASSERT_TRUE(f_annuaire.sauvegarder(chemin));
+
+	hockey::Annuaire a("Autre");
+	a.ajouterPersonne(hockey::Joueur("Autre", "Prenom", util::Date(25, 8, 2004), "418 498-4193", "centre"));
+	ASSERT_TRUE(a.charger(chemin));
+	std::remove(chemin.c_str());
+
+	ASSERT_EQ(f_annuaire.reqAnnuaireFormate(), a.reqAnnuaireFormate());
+	ASSERT_TRUE(a.personneEstDejaPresente(f_joueur));
+	ASSERT_TRUE(a.trouverPersonne("Autre", "Prenom", util::Date(25, 8, 2004)) == nullptr);
+	ASSERT_EQ(2u, a.trouverParTelephone("418 498-4193").size());
+	ASSERT_TRUE(a.trouverParNumRAMQ("JALD 9908 2511") != nullptr);
+	ASSERT_EQ('M', a.trouverParNumRAMQ("JALD 9908 2511")->reqSexe());
+}
+
+TEST_F(AnnuaireMembres, sauvegarderChargerNomsLongs)
+{
+	const char* const vNoms[] = { "Vaillancourtois", "Vaillancourt", "Vaillanc", "Vaillancourte", "Vaillancour" };
+	for (const char* nom : vNoms)
+	{
+		f_annuaire.ajouterPersonne(hockey::Joueur(nom, "Christophe", util::Date(1, 2, 2005), "418 555-1234", "centre"));
+	}
+	std::string chemin = ::testing::TempDir() + "AnnuaireNomsLongs.bin";
+	ASSERT_TRUE(f_annuaire.sauvegarder(chemin));
+
+	hockey::Annuaire a("Autre");
+	ASSERT_TRUE(a.charger(chemin));
+	std::remove(chemin.c_str());
+
+	ASSERT_EQ(f_annuaire.reqAnnuaireFormate(), a.reqAnnuaireFormate());
+	for (const char* nom : vNoms)
+	{
+		ASSERT_TRUE(a.trouverPersonne(nom, "Christophe", util::Date(1, 2, 2005)) != nullptr) << nom;
+	}
+	std::vector<const hockey::Personne*> vTrouves = a.trouverParPrefixe("vaillancour", 10);
+	ASSERT_EQ(4u, vTrouves.size());
+	ASSERT_EQ("Vaillancour", vTrouves[0]->reqNom());
+	ASSERT_EQ("Vaillancourt", vTrouves[1]->reqNom());
+	ASSERT_EQ("Vaillancourte", vTrouves[2]->reqNom());
+	ASSERT_EQ("Vaillancourtois", vTrouves[3]->reqNom());
+}
+
+TEST_F(AnnuaireMembres, chargerFichierAbsent)
+{
+	ASSERT_FALSE(f_annuaire.charger(::testing::TempDir() + "AnnuaireAbsent.bin"));
+	ASSERT_EQ(2u, f_annuaire.reqNbMembres());
+	ASSERT_EQ("Test", f_annuaire.reqNomClub());
+}
+
+TEST_F(AnnuaireMembres, chargerFichierCorrompu)
+{
+	std::string chemin = ::testing::TempDir() + "AnnuaireCorrompu.bin";
+	std::ofstream(chemin.c_str(), std::ios::binary) << std::string(200, 'x');
+
+	ASSERT_FALSE(f_annuaire.charger(chemin));
+	std::remove(chemin.c_str());
+	ASSERT_EQ(2u, f_annuaire.reqNbMembres());
+	ASSERT_TRUE(f_annuaire.personneEstDejaPresente(f_entraineur));
+}
+
+/**
+ * \brief Test du constructeur et de l'assignation par déplacement
+ * cas valide : <br>
+ * 	DeplacementValide :	L'annuaire repris a les membres et les index, l'annuaire d'origine est vide et utilisable
+ * 	DeplacementSansAllocation : Déplacer un annuaire de 100 000 membres ne fait aucune allocation
+ * <br>
+ * cas invalide : <br>
+ * 	Aucun d'identifié
+ */
+TEST_F(AnnuaireMembres, DeplacementValide)
+{
+	hockey::Annuaire repris(std::move(f_annuaire));
+	ASSERT_EQ(2u, repris.reqNbMembres());
+	ASSERT_TRUE(repris.personneEstDejaPresente(f_joueur));
+	ASSERT_TRUE(repris.trouverParNumRAMQ("JALD 9908 2511") != nullptr);
+
+	ASSERT_EQ(0u, f_annuaire.reqNbMembres());
+	ASSERT_FALSE(f_annuaire.personneEstDejaPresente(f_joueur));
+	f_annuaire.ajouterPersonne(f_joueur);
+	ASSERT_EQ(1u, f_annuaire.reqNbMembres());
+
+	f_annuaire = std::move(repris);
+	ASSERT_EQ(2u, f_annuaire.reqNbMembres());
+	ASSERT_EQ("Test", f_annuaire.reqNomClub());
+	ASSERT_EQ(2u, f_annuaire.trouverParTelephone("418 498-4193").size());
+	ASSERT_EQ(0u, repris.reqNbMembres());
+}
+
+TEST(AnnuaireDeplacement, DeplacementSansAllocation)
+{
+	const unsigned int NB_MEMBRES = 100000;
+	hockey::Annuaire a("Club des gagnants");
+	remplirAnnuaire(a, NB_MEMBRES);
+
+	unsigned long nbAllocations = g_nbAllocations.load();
+	hockey::Annuaire b(std::move(a));
+	hockey::Annuaire c("Autre");
+	c = std::move(b);
+	ASSERT_EQ(nbAllocations, g_nbAllocations.load());
+
+	ASSERT_EQ(NB_MEMBRES, c.reqNbMembres());
+	ASSERT_EQ(0u, a.reqNbMembres());
+	ASSERT_EQ(0u, b.reqNbMembres());
+	ASSERT_TRUE(c.trouverPersonne("aaaa", "Prenom", util::Date(25, 8, 2004)) != nullptr);
+}
+
+/**
+ * \brief Test du partage du registre des membres entre les copies d'un annuaire
+ * cas valide : <br>
+ * 	CopieDiverge :	Un ajout ou un retrait dans une copie ne change pas l'annuaire d'origine
+ * 	CopieGardeReferences : Les références vers les membres de l'original restent valides après la modification d'une copie
+ * 	CopieSansAllocation : Copier un annuaire de 100 000 membres ne fait aucune allocation
+ * <br>
+ * cas invalide : <br>
+ * 	Aucun d'identifié
+ */
+TEST_F(AnnuaireMembres, CopieDiverge)
+{
+	hockey::Annuaire copie(f_annuaire);
+	hockey::Joueur j("Autre", "Prenom", util::Date(25, 8, 2004), "581 337-2278", "ailier");
+	copie.ajouterPersonne(j);
+	ASSERT_TRUE(copie.retirerPersonne(f_entraineur));
+
+	ASSERT_EQ(2u, copie.reqNbMembres());
+	ASSERT_TRUE(copie.personneEstDejaPresente(j));
+	ASSERT_TRUE(copie.trouverParNumRAMQ("JALD 9908 2511") == nullptr);
+
+	ASSERT_EQ(2u, f_annuaire.reqNbMembres());
+	ASSERT_FALSE(f_annuaire.personneEstDejaPresente(j));
+	ASSERT_TRUE(f_annuaire.trouverParNumRAMQ("JALD 9908 2511") != nullptr);
+	ASSERT_TRUE(f_annuaire.trouverParTelephone("581 337-2278").empty());
+
+	hockey::Annuaire assignee("Autre");
+	assignee = f_annuaire;
+	f_annuaire.retirerPersonne(f_joueur);
+	ASSERT_EQ(2u, assignee.reqNbMembres());
+	ASSERT_TRUE(assignee.personneEstDejaPresente(f_joueur));
+}
+
+TEST_F(AnnuaireMembres, CopieGardeReferences)
+{
+	const hockey::Personne& joueur = f_annuaire.reqMembre(0);
+	{
+		hockey::Annuaire copie(f_annuaire);
+		f_annuaire.ajouterPersonne(hockey::Joueur("Autre", "Prenom", util::Date(25, 8, 2004), "581 337-2278", "ailier"));
+		ASSERT_TRUE(joueur == copie.reqMembre(0));
+		ASSERT_EQ(&joueur, &copie.reqMembre(0));
+	}
+	ASSERT_EQ(3u, f_annuaire.reqNbMembres());
+	ASSERT_TRUE(f_annuaire.reqMembre(0) == f_joueur);
+}
+
+TEST(AnnuaireCopie, CopieSansAllocation)
+{
+	const unsigned int NB_MEMBRES = 100000;
+	hockey::Annuaire a("Club");
+	remplirAnnuaire(a, NB_MEMBRES);
+
+	unsigned long nbAllocations = g_nbAllocations.load();
+	hockey::Annuaire b(a);
+	hockey::Annuaire c("Autre");
+	c = b;
+	ASSERT_EQ(nbAllocations, g_nbAllocations.load());
+
+	ASSERT_EQ(NB_MEMBRES, c.reqNbMembres());
+	ASSERT_EQ(&a.reqMembre(0), &c.reqMembre(0));
+	c.retirerPersonne(a.reqMembre(0));
+	ASSERT_EQ(NB_MEMBRES - 1, c.reqNbMembres());
+	ASSERT_EQ(NB_MEMBRES, a.reqNbMembres());
+	ASSERT_EQ(NB_MEMBRES, b.reqNbMembres());
+}
+
+/**
+ * \brief Test de l'utilisation concurrente de copies d'un annuaire
+ * cas valide : <br>
+ * 	ModificationCopiesConcurrente : deux fils modifient chacun sa copie pendant qu'un troisième
+ * 									lit puis détruit la sienne ; la dernière copie modifiée
+ * 									reprend le registre sans le dupliquer (à exécuter avec le
+ * 									preset tsan)
+ * <br>
+ * cas invalide : <br>
+ * 	Aucun d'identifié
+ */
+TEST(AnnuaireConcurrence, ModificationCopiesConcurrente)
+{
+	const unsigned int NB_MEMBRES = 200;
+	hockey::Annuaire base("Club");
+	remplirAnnuaire(base, NB_MEMBRES);
+	hockey::Joueur premier(base.reqMembre(0).reqNom(), "Prenom", util::Date(25, 8, 2004), "418 498-4193", "centre");
+
+	for (int passe = 0; passe < 50; passe++)
+	{
+		// Le registre de a est partagé par a, b et c seulement
+		hockey::Annuaire a(base);
+		a.ajouterPersonne(hockey::Joueur("Ajout", "Prenom", util::Date(25, 8, 2004), "418 498-4193", "centre"));
+		hockey::Annuaire b(a);
+		std::unique_ptr<hockey::Annuaire> c(new hockey::Annuaire(a));
+
+		std::atomic<unsigned int> nbLus(0);
+		std::thread lecteur([&c, &nbLus]()
+		{
+			for (unsigned int i = 0; i < c->reqNbMembres(); i++)
+			{
+				nbLus += c->trouverParTelephone(c->reqMembre(i).reqTelephone()).size() > 0;
+			}
+			c.reset();
+		});
+		// Les modifieurs attendent la fin des lectures par une lecture relâchée, qui n'ordonne rien :
+		// seul le compteur du registre ordonne les lectures de c avant les écritures en place.
+		auto attendreLectures = [&nbLus]()
+		{
+			while (nbLus.load(std::memory_order_relaxed) < NB_MEMBRES + 1)
+			{
+				std::this_thread::yield();
+			}
+		};
+		std::thread modifieurA([&a, &premier, &attendreLectures]()
+		{
+			attendreLectures();
+			a.asgTelephoneMembre(premier, "581 337-2278");
+			a.retirerPersonne(premier);
+		});
+		std::thread modifieurB([&b, &premier, &attendreLectures]()
+		{
+			attendreLectures();
+			b.asgTelephoneMembre(premier, "819 555-7890");
+			b.ajouterPersonne(hockey::Joueur("Autre", "Prenom", util::Date(25, 8, 2004), "418 498-4193", "centre"));
+		});
+		lecteur.join();
+		modifieurA.join();
+		modifieurB.join();
+
+		ASSERT_EQ(NB_MEMBRES + 1, nbLus.load());
+		ASSERT_EQ(NB_MEMBRES, a.reqNbMembres());
+		ASSERT_FALSE(a.personneEstDejaPresente(premier));
+		ASSERT_EQ(NB_MEMBRES + 2, b.reqNbMembres());
+		ASSERT_EQ("819 555-7890", b.trouverPersonne(premier.reqNom(), "Prenom", util::Date(25, 8, 2004))->reqTelephone());
+		ASSERT_EQ(NB_MEMBRES, base.reqNbMembres());
+	}
+}
+
+/**
+ * \brief Test de la méthode bool asgTelephoneMembre(const Personne& p_personne, const std::string& p_telephone)
+ * cas valide : <br>
+ * 	asgTelephoneMembreValide :	Le numéro du membre et l'index de téléphone sont mis à jour, une copie garde l'ancien numéro
+ * <br>
+ * cas invalide : <br>
+ * 	asgTelephoneMembreAbsent : Modification d'une personne absente
+ * 	asgTelephoneMembreInvalide : Numéro de téléphone invalide
+ */
+TEST_F(AnnuaireMembres, asgTelephoneMembreValide)
+{
+	hockey::Annuaire copie(f_annuaire);
+	ASSERT_TRUE(f_annuaire.asgTelephoneMembre(f_joueur, "581 337-2278"));
+
+	ASSERT_EQ("581 337-2278", f_annuaire.trouverPersonne("Nom", "Prenom", util::Date(25, 8, 2004))->reqTelephone());
+	ASSERT_EQ(1u, f_annuaire.trouverParTelephone("581 337-2278").size());
+	ASSERT_EQ(1u, f_annuaire.trouverParTelephone("418 498-4193").size());
+
+	ASSERT_EQ("418 498-4193", copie.reqMembre(0).reqTelephone());
+	ASSERT_EQ(2u, copie.trouverParTelephone("418 498-4193").size());
+	ASSERT_TRUE(copie.trouverParTelephone("581 337-2278").empty());
+}
+
+TEST_F(AnnuaireMembres, asgTelephoneMembreAbsent)
+{
+	hockey::Joueur j("Autre", "Prenom", util::Date(25, 8, 2004), "418 498-4193", "centre");
+	ASSERT_FALSE(f_annuaire.asgTelephoneMembre(j, "581 337-2278"));
+	ASSERT_TRUE(f_annuaire.trouverParTelephone("581 337-2278").empty());
+}
+
+TEST_F(AnnuaireMembres, asgTelephoneMembreInvalide)
+{
+	ASSERT_THROW(f_annuaire.asgTelephoneMembre(f_joueur, "418-498-4193"), PreconditionException);
+}
+
+/**
+ * \class AnnuaireNaissances
+ * \brief Fixture pour la création d'un annuaire de cinq joueurs nés à des dates différentes et d'un entraineur
+ */
+class AnnuaireNaissances : public ::testing::Test
+{
+public:
+	AnnuaireNaissances():f_annuaire("Test"),
+			f_alex("Tremblay", "Alex", util::Date(3, 3, 2004), "418 555-1234", "gardien")
+	{
+		f_annuaire.ajouterPersonne(f_alex);
+		f_annuaire.ajouterPersonne(hockey::Joueur("Gagnon", "Luc", util::Date(10, 10, 2003), "581 555-2345", "gardien"));
+		f_annuaire.ajouterPersonne(hockey::Joueur("Trudel", "Anne", util::Date(20, 6, 2004), "450 555-3456", "centre"));
+		f_annuaire.ajouterPersonne(hockey::Joueur("Roy", "Marc", util::Date(1, 1, 2005), "418 555-4567", "ailier"));
+		f_annuaire.ajouterPersonne(hockey::Joueur("Cote", "Lea", util::Date(29, 2, 2004), "819 555-7890", "centre"));
+		f_annuaire.ajouterPersonne(hockey::Entraineur("Jalbert", "David", util::Date(25, 8, 1999), "581 337-2278", "JALD 9908 2511", 'M'));
+	}
+
+	/**
+	 * \brief Retourne les prénoms d'une liste de membres, dans l'ordre de la liste
+	 */
+	static std::vector<std::string> prenoms(const std::vector<const hockey::Personne*>& p_vMembres)
+	{
+		std::vector<std::string> vPrenoms;
+		for (const hockey::Personne* membre : p_vMembres)
+		{
+			vPrenoms.push_back(membre->reqPrenom());
+		}
+		return vPrenoms;
+	}
+
+	hockey::Annuaire f_annuaire;
+	hockey::Joueur f_alex;
+};
+
+/**
+ * \brief Test des méthodes trouverParNaissance(const util::Date& p_debut, const util::Date& p_fin) const et
+ * 		  trouverFranchissementAge(int p_age, const util::Date& p_debut, const util::Date& p_fin) const
+ * cas valide : <br>
+ * 	trouverParNaissanceValide :	Membres nés dans l'intervalle, bornes incluses, par date de naissance croissante
+ * 	trouverParNaissanceApresRetrait : L'index suit les retraits, une copie garde l'ancien index
+ * 	trouverParNaissanceApresChargement : L'index construit au chargement d'un instantané suit ensuite les ajouts
+ * 	trouverFranchissementAgeValide : Joueurs qui atteignent 18 ans après la première date et au plus tard à la seconde
+ * 	trouverFranchissementAgeVingtNeufFevrier : Un membre né un 29 février atteint son âge le 1er mars des années non bissextiles
+ * <br>
+ * cas invalide : <br>
+ * 	trouverNaissanceInvalide : Intervalle inversé, âge nul
+ */
+TEST_F(AnnuaireNaissances, trouverParNaissanceValide)
+{
+	ASSERT_EQ(std::vector<std::string>({ "Lea", "Alex", "Anne" }),
+			  prenoms(f_annuaire.trouverParNaissance(util::Date(1, 1, 2004), util::Date(31, 12, 2004))));
+	ASSERT_EQ(std::vector<std::string>({ "Luc", "Lea", "Alex", "Anne", "Marc" }),
+			  prenoms(f_annuaire.trouverParNaissance(util::Date(10, 10, 2003), util::Date(1, 1, 2005))));
+	ASSERT_EQ(std::vector<std::string>({ "David" }),
+			  prenoms(f_annuaire.trouverParNaissance(util::Date(25, 8, 1999), util::Date(25, 8, 1999))));
+	ASSERT_TRUE(f_annuaire.trouverParNaissance(util::Date(1, 1, 2006), util::Date(31, 12, 2037)).empty());
+}
+
+TEST_F(AnnuaireNaissances, trouverParNaissanceApresRetrait)
+{
+	hockey::Annuaire copie(f_annuaire);
+	ASSERT_TRUE(f_annuaire.retirerPersonne(f_alex));
+	ASSERT_EQ(std::vector<std::string>({ "Lea", "Anne" }),
+			  prenoms(f_annuaire.trouverParNaissance(util::Date(1, 1, 2004), util::Date(31, 12, 2004))));
+	ASSERT_EQ(std::vector<std::string>({ "Lea", "Alex", "Anne" }),
+			  prenoms(copie.trouverParNaissance(util::Date(1, 1, 2004), util::Date(31, 12, 2004))));
+
+	f_annuaire.ajouterPersonne(f_alex);
+	ASSERT_EQ(std::vector<std::string>({ "Lea", "Alex", "Anne" }),
+			  prenoms(f_annuaire.trouverParNaissance(util::Date(1, 1, 2004), util::Date(31, 12, 2004))));
+}
+
+TEST_F(AnnuaireNaissances, trouverParNaissanceApresChargement)
+{
+	std::string chemin = ::testing::TempDir() + "AnnuaireNaissances.bin";
+	ASSERT_TRUE(f_annuaire.sauvegarder(chemin));
+	hockey::Annuaire a("Autre");
+	ASSERT_TRUE(a.charger(chemin));
+	std::remove(chemin.c_str());
+
+	ASSERT_EQ(std::vector<std::string>({ "Luc", "Lea", "Alex", "Anne", "Marc" }),
+			  prenoms(a.trouverParNaissance(util::Date(10, 10, 2003), util::Date(1, 1, 2005))));
+	a.ajouterPersonne(hockey::Joueur("Roy", "Zoe", util::Date(1, 1, 2004), "418 555-1111", "centre"));
+	ASSERT_EQ(std::vector<std::string>({ "Zoe", "Lea", "Alex", "Anne" }),
+			  prenoms(a.trouverParNaissance(util::Date(1, 1, 2004), util::Date(31, 12, 2004))));
+}
+
+TEST_F(AnnuaireNaissances, trouverFranchissementAgeValide)
+{
+	ASSERT_EQ(std::vector<std::string>({ "Luc", "Lea", "Alex" }),
+			  prenoms(f_annuaire.trouverFranchissementAge(AGE_MAXIMAL_JOUEUR + 1, util::Date(16, 4, 2020), util::Date(16, 4, 2022))));
+	ASSERT_EQ(std::vector<std::string>({ "Alex" }),
+			  prenoms(f_annuaire.trouverFranchissementAge(18, util::Date(2, 3, 2022), util::Date(3, 3, 2022))));
+	ASSERT_TRUE(f_annuaire.trouverFranchissementAge(18, util::Date(3, 3, 2022), util::Date(3, 3, 2022)).empty());
+	ASSERT_EQ(std::vector<std::string>({ "David" }),
+			  prenoms(f_annuaire.trouverFranchissementAge(21, util::Date(1, 1, 2020), util::Date(31, 12, 2020))));
+}
+
+TEST_F(AnnuaireNaissances, trouverFranchissementAgeVingtNeufFevrier)
+{
+	ASSERT_TRUE(f_annuaire.trouverFranchissementAge(18, util::Date(27, 2, 2022), util::Date(28, 2, 2022)).empty());
+	ASSERT_EQ(std::vector<std::string>({ "Lea" }),
+			  prenoms(f_annuaire.trouverFranchissementAge(18, util::Date(28, 2, 2022), util::Date(1, 3, 2022))));
+	ASSERT_EQ(std::vector<std::string>({ "Lea" }),
+			  prenoms(f_annuaire.trouverFranchissementAge(20, util::Date(28, 2, 2024), util::Date(29, 2, 2024))));
+}
+
+TEST_F(AnnuaireNaissances, trouverNaissanceInvalide)
+{
+	ASSERT_THROW(f_annuaire.trouverParNaissance(util::Date(2, 1, 2004), util::Date(1, 1, 2004)), PreconditionException);
+	ASSERT_THROW(f_annuaire.trouverFranchissementAge(18, util::Date(2, 1, 2022), util::Date(1, 1, 2022)), PreconditionException);
+	ASSERT_THROW(f_annuaire.trouverFranchissementAge(0, util::Date(1, 1, 2022), util::Date(2, 1, 2022)), PreconditionException);
+}
+
+/**
+ * \brief Test de la méthode trouverParPrefixe(const std::string& p_prefixe, unsigned int p_nbResultats) const
+ * cas valide : <br>
+ * 	trouverParPrefixeValide :	Noms et prénoms qui commencent par le préfixe, sans égard à la casse ni aux accents,
+ * 								par ordre alphabétique, limités au nombre demandé
+ * 	trouverParPrefixeApresRetrait : L'index suit les ajouts et les retraits, une copie garde l'ancien index
+ * 	trouverParPrefixeApresChargement : L'index construit au chargement d'un instantané suit ensuite les retraits
+ * <br>
+ * cas invalide : <br>
+ * 	trouverParPrefixeInvalide : Préfixe qui ne correspond à aucun membre, aucun résultat demandé
+ */
+TEST_F(AnnuaireNaissances, trouverParPrefixeValide)
+{
+	ASSERT_EQ(std::vector<std::string>({ "Alex", "Anne" }), prenoms(f_annuaire.trouverParPrefixe("tr", 10)));
+	ASSERT_EQ(std::vector<std::string>({ "Lea" }), prenoms(f_annuaire.trouverParPrefixe("C\xC3\x94", 10)));
+	ASSERT_EQ(std::vector<std::string>({ "Lea", "Luc" }), prenoms(f_annuaire.trouverParPrefixe("l", 10)));
+	ASSERT_EQ(std::vector<std::string>({ "Alex", "Anne" }), prenoms(f_annuaire.trouverParPrefixe("", 2)));
+}
+
+TEST_F(AnnuaireNaissances, trouverParPrefixeApresRetrait)
+{
+	hockey::Annuaire copie(f_annuaire);
+	ASSERT_TRUE(f_annuaire.retirerPersonne(f_alex));
+	ASSERT_EQ(std::vector<std::string>({ "Anne" }), prenoms(f_annuaire.trouverParPrefixe("TR", 10)));
+	ASSERT_TRUE(f_annuaire.trouverParPrefixe("alex", 10).empty());
+	ASSERT_EQ(std::vector<std::string>({ "Alex", "Anne" }), prenoms(copie.trouverParPrefixe("TR", 10)));
+
+	f_annuaire.ajouterPersonne(hockey::Joueur("Tr\xC3\xA9panier", "Zoe", util::Date(5, 5, 2004), "418 555-1111", "centre"));
+	ASSERT_EQ(std::vector<std::string>({ "Zoe", "Anne" }), prenoms(f_annuaire.trouverParPrefixe("tr", 10)));
+}
+
+TEST_F(AnnuaireNaissances, trouverParPrefixeApresChargement)
+{
+	std::string chemin = ::testing::TempDir() + "AnnuairePrefixes.bin";
+	ASSERT_TRUE(f_annuaire.sauvegarder(chemin));
+	hockey::Annuaire a("Autre");
+	ASSERT_TRUE(a.charger(chemin));
+	std::remove(chemin.c_str());
+
+	ASSERT_EQ(std::vector<std::string>({ "Alex", "Anne" }), prenoms(a.trouverParPrefixe("tr", 10)));
+	ASSERT_EQ(std::vector<std::string>({ "Lea", "Luc" }), prenoms(a.trouverParPrefixe("l", 10)));
+	ASSERT_TRUE(a.retirerPersonne(f_alex));
+	ASSERT_EQ(std::vector<std::string>({ "Anne" }), prenoms(a.trouverParPrefixe("tr", 10)));
+}
+
+TEST_F(AnnuaireNaissances, trouverParPrefixeInvalide)
+{
+	ASSERT_TRUE(f_annuaire.trouverParPrefixe("Tremblays", 10).empty());
+	ASSERT_THROW(f_annuaire.trouverParPrefixe("tr", 0), PreconditionException);
+}
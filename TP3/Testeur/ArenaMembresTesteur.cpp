@@ -0,0 +1,116 @@
+/**
+ * \file ArenaMembresTesteur.cpp
+ * \brief  Fichier de tests unitaires pour la classe ArenaMembres
+ * \author David J Ross
+ * \version 1
+ * \date 16 avril 2020
+ */
+
+#include <gtest/gtest.h>
+#include <utility>
+#include <cstdint>
+#include "ArenaMembres.h"
+#include "Joueur.h"
+#include "Date.h"
+
+/**
+ * \brief Test de la méthode void* allouer(std::size_t p_taille, std::size_t p_alignement)
+ * cas valide : <br>
+ * 	allouerAligne :	les espaces réservés respectent l'alignement et partagent un même bloc
+ * 	allouerGrosObjet : un objet plus gros qu'un bloc reçoit son propre bloc
+ * <br>
+ * cas invalide : <br>
+ * 	allouerAlignementInvalide : alignement qui n'est pas une puissance de 2
+ */
+TEST(ArenaMembres, allouerAligne)
+{
+	hockey::ArenaMembres arena(1024);
+	void* a = arena.allouer(3, 1);
+	void* b = arena.allouer(sizeof(double), alignof(double));
+	ASSERT_TRUE(a != b);
+	ASSERT_EQ(0u, reinterpret_cast<std::uintptr_t>(b) % alignof(double));
+	ASSERT_EQ(1u, arena.reqNbBlocs());
+}
+
+TEST(ArenaMembres, allouerGrosObjet)
+{
+	hockey::ArenaMembres arena(64);
+	arena.allouer(16, 8);
+	arena.allouer(4096, 8);
+	ASSERT_EQ(2u, arena.reqNbBlocs());
+}
+
+TEST(ArenaMembres, allouerAlignementInvalide)
+{
+	hockey::ArenaMembres arena;
+	ASSERT_THROW(arena.allouer(8, 3), PreconditionException);
+}
+
+/**
+ * \brief Test de la méthode void liberer()
+ * cas valide : <br>
+ * 	libererTout : tous les blocs sont rendus d'un coup
+ * <br>
+ * cas invalide : <br>
+ * 	Aucun d'identifié
+ */
+TEST(ArenaMembres, libererTout)
+{
+	hockey::ArenaMembres arena(64);
+	for (int i = 0; i < 10; i++)
+	{
+		arena.allouer(48, 8);
+	}
+	ASSERT_EQ(10u, arena.reqNbBlocs());
+	arena.liberer();
+	ASSERT_EQ(0u, arena.reqNbBlocs());
+}
+
+/**
+ * \brief Test du constructeur et de l'assignation par déplacement
+ * cas valide : <br>
+ * 	DeplacementBlocs : les blocs changent de propriétaire sans que les objets ne bougent
+ * <br>
+ * cas invalide : <br>
+ * 	Aucun d'identifié
+ */
+TEST(ArenaMembres, DeplacementBlocs)
+{
+	hockey::ArenaMembres arena(64);
+	int* entier = static_cast<int*>(arena.allouer(sizeof(int), alignof(int)));
+	*entier = 42;
+	arena.allouer(64, 8);
+
+	hockey::ArenaMembres reprise(std::move(arena));
+	ASSERT_EQ(2u, reprise.reqNbBlocs());
+	ASSERT_EQ(0u, arena.reqNbBlocs());
+	ASSERT_EQ(42, *entier);
+
+	hockey::ArenaMembres autre;
+	autre.allouer(16, 8);
+	autre = std::move(reprise);
+	ASSERT_EQ(2u, autre.reqNbBlocs());
+	ASSERT_EQ(0u, reprise.reqNbBlocs());
+	ASSERT_EQ(42, *entier);
+
+	arena.allouer(8, 8);
+	ASSERT_EQ(1u, arena.reqNbBlocs());
+}
+
+/**
+ * \brief Test de la méthode Personne* clone(ArenaMembres& p_arena) const
+ * cas valide : <br>
+ * 	cloneDansArena : la copie construite dans l'arène est égale à l'original
+ * <br>
+ * cas invalide : <br>
+ * 	Aucun d'identifié
+ */
+TEST(ArenaMembres, cloneDansArena)
+{
+	hockey::ArenaMembres arena;
+	hockey::Joueur j("Nom", "Prenom", util::Date(25, 8, 2004), "418 498-4193", "centre");
+	hockey::Personne* copie = j.clone(arena);
+	ASSERT_TRUE(*copie == j);
+	ASSERT_EQ(j.reqPersonneFormate(), copie->reqPersonneFormate());
+	copie->~Personne();
+}
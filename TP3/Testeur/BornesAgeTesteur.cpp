@@ -0,0 +1,86 @@
+/**
+ * \file BornesAgeTesteur.cpp
+ * \brief  Fichier de tests unitaires pour la classe BornesAge
+ * \author David J Ross
+ * \version 1
+ * \date 16 avril 2020
+ */
+
+#include <gtest/gtest.h>
+#include "BornesAge.h"
+#include "Horloge.h"
+#include "Date.h"
+
+/**
+ * \brief Test du constructeur BornesAge(const util::Date& p_aujourdhui) et des validations d'âge
+ * cas valide : <br>
+ * 	AgeJoueur :	Un joueur a entre 15 et 17 ans, jusqu'à la veille de ses 18 ans
+ * 	AgeEntraineur : Un entraineur a au moins 18 ans
+ * 	VingtNeufFevrier : Les bornes du 29 février tombent le 28 février des années non bissextiles
+ * <br>
+ * cas invalide : <br>
+ * 	Aucun d'identifié
+ */
+TEST(BornesAge, AgeJoueur)
+{
+	hockey::BornesAge bornes(util::Date(16, 4, 2020));
+	ASSERT_EQ(util::Date(16, 4, 2020), bornes.reqAujourdhui());
+	ASSERT_TRUE(bornes.validerAgeJoueur(util::Date(15, 4, 2005)));
+	ASSERT_FALSE(bornes.validerAgeJoueur(util::Date(16, 4, 2005)));
+	ASSERT_TRUE(bornes.validerAgeJoueur(util::Date(17, 4, 2002)));
+	ASSERT_FALSE(bornes.validerAgeJoueur(util::Date(16, 4, 2002)));
+}
+
+TEST(BornesAge, AgeEntraineur)
+{
+	hockey::BornesAge bornes(util::Date(16, 4, 2020));
+	ASSERT_TRUE(bornes.validerAgeEntraineur(util::Date(15, 4, 2002)));
+	ASSERT_FALSE(bornes.validerAgeEntraineur(util::Date(16, 4, 2002)));
+}
+
+TEST(BornesAge, VingtNeufFevrier)
+{
+	hockey::BornesAge bornes(util::Date(29, 2, 2020));
+	ASSERT_TRUE(bornes.validerAgeJoueur(util::Date(27, 2, 2005)));
+	ASSERT_FALSE(bornes.validerAgeJoueur(util::Date(28, 2, 2005)));
+	ASSERT_TRUE(bornes.validerAgeEntraineur(util::Date(27, 2, 2002)));
+	ASSERT_FALSE(bornes.validerAgeEntraineur(util::Date(28, 2, 2002)));
+}
+
+/**
+ * \brief Test de la méthode static long joursNaissanceLimite(const util::Date& p_date, long p_age)
+ * cas valide : <br>
+ * 	NaissanceLimite :	Même jour p_age années plus tôt, 28 février pour un 29 février, avant 1970
+ * <br>
+ * cas invalide : <br>
+ * 	Aucun d'identifié
+ */
+TEST(BornesAge, NaissanceLimite)
+{
+	ASSERT_EQ(util::Date(16, 4, 2002).reqJoursEpoque(), hockey::BornesAge::joursNaissanceLimite(util::Date(16, 4, 2020), 18));
+	ASSERT_EQ(util::Date(28, 2, 2002).reqJoursEpoque(), hockey::BornesAge::joursNaissanceLimite(util::Date(29, 2, 2020), 18));
+	ASSERT_EQ(util::Date(29, 2, 2004).reqJoursEpoque(), hockey::BornesAge::joursNaissanceLimite(util::Date(29, 2, 2020), 16));
+	ASSERT_EQ(util::Date::joursDepuisCivil(1, 1, 1960), hockey::BornesAge::joursNaissanceLimite(util::Date(1, 1, 2020), 60));
+	ASSERT_LT(hockey::BornesAge::joursNaissanceLimite(util::Date(1, 1, 2020), 60), 0);
+}
+
+/**
+ * \brief Test de la méthode static BornesAge reqBornesAujourdhui()
+ * cas valide : <br>
+ * 	BornesAujourdhui :	Les bornes suivent la date du jour de util::Horloge
+ * <br>
+ * cas invalide : <br>
+ * 	Aucun d'identifié
+ */
+TEST(BornesAge, BornesAujourdhui)
+{
+	util::Date dateFixee = util::Horloge::reqAujourdhui();
+	ASSERT_EQ(dateFixee, hockey::BornesAge::reqBornesAujourdhui().reqAujourdhui());
+
+	util::Horloge::fixerAujourdhui(util::Date(16, 4, 2021));
+	hockey::BornesAge bornes = hockey::BornesAge::reqBornesAujourdhui();
+	util::Horloge::fixerAujourdhui(dateFixee);
+	ASSERT_EQ(util::Date(16, 4, 2021), bornes.reqAujourdhui());
+	ASSERT_FALSE(bornes.validerAgeJoueur(util::Date(15, 4, 2003)));
+	ASSERT_TRUE(hockey::BornesAge::reqBornesAujourdhui().validerAgeJoueur(util::Date(15, 4, 2003)));
+}
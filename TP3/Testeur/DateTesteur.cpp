@@ -0,0 +1,190 @@
+/**
+ * \file DateTesteur.cpp
+ * \brief  Fichier de tests unitaires pour la classe Date
+ * \author David J Ross
+ * \version 1
+ * \date 16 avril 2020
+ */
+
+#include <gtest/gtest.h>
+#include <sstream>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include "Date.h"
+
+/**
+ * \brief Test du Constructeur Date::Date(long p_jour, long p_mois, long p_annee)
+ * cas valide : <br>
+ * 	DateValide :	Date valide, les accesseurs retournent les valeurs données
+ * 	DateBornes :	Premier et dernier jour acceptés
+ * <br>
+ * cas invalide : <br>
+ * 	DateInvalide : 29 février d'une année non bissextile et année hors limites
+ */
+TEST(DateConstructeur, DateValide)
+{
+	util::Date d(25, 8, 2004);
+	ASSERT_EQ(25, d.reqJour());
+	ASSERT_EQ(8, d.reqMois());
+	ASSERT_EQ(2004, d.reqAnnee());
+}
+
+TEST(DateConstructeur, DateBornes)
+{
+	ASSERT_EQ(0, util::Date(1, 1, 1970).reqJoursEpoque());
+	ASSERT_EQ(24836, util::Date(31, 12, 2037).reqJoursEpoque());
+}
+
+TEST(DateConstructeur, DateInvalide)
+{
+	ASSERT_THROW(util::Date(29, 2, 2001), PreconditionException);
+	ASSERT_THROW(util::Date(1, 1, 1969), PreconditionException);
+	ASSERT_THROW(util::Date(1, 1, 2038), PreconditionException);
+}
+
+/**
+ * \brief Test des conversions entre le calendrier civil et le nombre de jours
+ * cas valide : <br>
+ * 	ConversionAllerRetour : chaque jour de 1970 à 2037 se convertit dans les deux sens
+ * 	JoursEpoqueConstexpr : la conversion est évaluable à la compilation
+ * <br>
+ * cas invalide : <br>
+ * 	JoursEpoqueHorsLimites : nombre de jours hors de l'intervalle accepté
+ */
+TEST(DateConversion, ConversionAllerRetour)
+{
+	for (long jours = 0; jours <= 24836; jours++)
+	{
+		util::Date d = util::Date::dateDepuisJoursEpoque(jours);
+		ASSERT_TRUE(util::Date::validerDate(d.reqJour(), d.reqMois(), d.reqAnnee()));
+		ASSERT_EQ(jours, util::Date(d.reqJour(), d.reqMois(), d.reqAnnee()).reqJoursEpoque());
+	}
+}
+
+TEST(DateConversion, JoursEpoqueConstexpr)
+{
+	constexpr long jours = util::Date::joursDepuisCivil(29, 2, 2000);
+	static_assert(jours == 11016, "29 février 2000");
+	ASSERT_EQ(jours, util::Date(29, 2, 2000).reqJoursEpoque());
+}
+
+TEST(DateConversion, JoursEpoqueHorsLimites)
+{
+	ASSERT_THROW(util::Date::dateDepuisJoursEpoque(-1), PreconditionException);
+	ASSERT_THROW(util::Date::dateDepuisJoursEpoque(24837), PreconditionException);
+}
+
+/**
+ * \brief Test des méthodes de calcul sur les dates
+ * cas valide : <br>
+ * 	reqJourAnnee :	rang du jour dans l'année, bissextile ou non
+ * 	Soustraction :	nombre de jours entre deux dates, y compris à travers un changement d'heure
+ * 	ajouteNbJour :	ajout et retrait de jours à travers un changement de mois et d'année
+ * <br>
+ * cas invalide : <br>
+ * 	ajouteNbJourHorsLimites : ajout qui dépasserait le 31 décembre 2037
+ */
+TEST(DateCalcul, reqJourAnnee)
+{
+	ASSERT_EQ(1, util::Date(1, 1, 2019).reqJourAnnee());
+	ASSERT_EQ(366, util::Date(31, 12, 2020).reqJourAnnee());
+	ASSERT_EQ(60, util::Date(1, 3, 2019).reqJourAnnee());
+}
+
+TEST(DateCalcul, Soustraction)
+{
+	ASSERT_EQ(1, util::Date(9, 3, 2020) - util::Date(8, 3, 2020));
+	ASSERT_EQ(-366, util::Date(1, 1, 2020) - util::Date(1, 1, 2021));
+}
+
+TEST(DateCalcul, ajouteNbJour)
+{
+	util::Date d(31, 12, 2019);
+	ASSERT_TRUE(d.ajouteNbJour(60));
+	ASSERT_EQ(util::Date(29, 2, 2020), d);
+	ASSERT_TRUE(d.ajouteNbJour(-60));
+	ASSERT_EQ(util::Date(31, 12, 2019), d);
+}
+
+TEST(DateCalcul, ajouteNbJourHorsLimites)
+{
+	util::Date d(30, 12, 2037);
+	ASSERT_FALSE(d.ajouteNbJour(2));
+	ASSERT_EQ(util::Date(30, 12, 2037), d);
+}
+
+/**
+ * \brief Test du formatage des dates
+ * cas valide : <br>
+ * 	reqDateFormatee : nom du jour de la semaine et du mois en français
+ * 	operateurSortie : format JJ/MM/AAAA
+ * <br>
+ * cas invalide : <br>
+ * 	Aucun d'identifié
+ */
+TEST(DateFormat, reqDateFormatee)
+{
+	ASSERT_EQ("Jeudi le 01 janvier 1970", util::Date(1, 1, 1970).reqDateFormatee());
+	ASSERT_EQ("Samedi le 12 mai 1979", util::Date(12, 5, 1979).reqDateFormatee());
+	ASSERT_EQ("Mercredi le 25 aout 2004", util::Date(25, 8, 2004).reqDateFormatee());
+}
+
+TEST(DateFormat, operateurSortie)
+{
+	std::ostringstream os;
+	os << util::Date(5, 3, 2004);
+	ASSERT_EQ("05/03/2004", os.str());
+}
+
+/**
+ * \brief Test de l'utilisation concurrente de la classe Date
+ * cas valide : <br>
+ * 	FormatageConcurrent : plusieurs fils construisent, comparent et formatent des dates
+ * 						  en même temps et obtiennent les mêmes résultats qu'un seul fil
+ * <br>
+ * cas invalide : <br>
+ * 	Aucun d'identifié
+ */
+TEST(DateConcurrence, FormatageConcurrent)
+{
+	const unsigned int NB_FILS = 8;
+	const long NB_JOURS = 24837;
+
+	std::vector<std::string> attendus;
+	for (long jours = 0; jours < NB_JOURS; jours += 97)
+	{
+		attendus.push_back(util::Date::dateDepuisJoursEpoque(jours).reqDateFormatee());
+	}
+
+	std::atomic<unsigned int> nbErreurs(0);
+	std::vector<std::thread> fils;
+	for (unsigned int f = 0; f < NB_FILS; f++)
+	{
+		fils.emplace_back([f, &attendus, &nbErreurs]()
+		{
+			util::Date aujourdhui;
+			for (int passe = 0; passe < 4; passe++)
+			{
+				for (std::size_t i = (f + passe) % attendus.size(); i < attendus.size(); i++)
+				{
+					util::Date d = util::Date::dateDepuisJoursEpoque(i * 97);
+					util::Date copie(d.reqJour(), d.reqMois(), d.reqAnnee());
+					std::ostringstream os;
+					os << copie;
+					if (!(copie == d) || d.reqDateFormatee() != attendus[i] || os.str().length() != 10
+							|| !(d < aujourdhui || aujourdhui < d || d == aujourdhui))
+					{
+						nbErreurs++;
+					}
+				}
+			}
+		});
+	}
+	for (std::thread& t : fils)
+	{
+		t.join();
+	}
+
+	ASSERT_EQ(0u, nbErreurs.load());
+}
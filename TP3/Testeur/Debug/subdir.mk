@@ -4,22 +4,73 @@
 
 # Add inputs and outputs from these tool invocations to the build variables 
 CPP_SRCS += \
+../AnnuaireColonnesTesteur.cpp \
+../AnnuaireProjeteTesteur.cpp \
 ../AnnuaireTesteur.cpp \
+../ArenaMembresTesteur.cpp \
+../BornesAgeTesteur.cpp \
+../DateTesteur.cpp \
 ../EntraineurTesteur.cpp \
+../FichierProjeteTesteur.cpp \
+../HorlogeTesteur.cpp \
+../ImportateurAnnuaireTesteur.cpp \
+../IndexHachageTesteur.cpp \
+../IndexNaissanceTesteur.cpp \
+../IndexNomsTesteur.cpp \
+../InstantaneAnnuaireTesteur.cpp \
 ../JoueurTesteur.cpp \
-../PersonneTesteur.cpp 
+../PersonneTesteur.cpp \
+../RequeteAnnuaireTesteur.cpp \
+../SiteContratTesteur.cpp \
+../TamponFormatageTesteur.cpp \
+../TriParBaseTesteur.cpp \
+../ValidationFormatTesteur.cpp 
 
 OBJS += \
+./AnnuaireColonnesTesteur.o \
+./AnnuaireProjeteTesteur.o \
 ./AnnuaireTesteur.o \
+./ArenaMembresTesteur.o \
+./BornesAgeTesteur.o \
+./DateTesteur.o \
 ./EntraineurTesteur.o \
+./FichierProjeteTesteur.o \
+./HorlogeTesteur.o \
+./ImportateurAnnuaireTesteur.o \
+./IndexHachageTesteur.o \
+./IndexNaissanceTesteur.o \
+./IndexNomsTesteur.o \
+./InstantaneAnnuaireTesteur.o \
 ./JoueurTesteur.o \
-./PersonneTesteur.o 
+./PersonneTesteur.o \
+./RequeteAnnuaireTesteur.o \
+./SiteContratTesteur.o \
+./TamponFormatageTesteur.o \
+./TriParBaseTesteur.o \
+./ValidationFormatTesteur.o 
 
 CPP_DEPS += \
+./AnnuaireColonnesTesteur.d \
+./AnnuaireProjeteTesteur.d \
 ./AnnuaireTesteur.d \
+./ArenaMembresTesteur.d \
+./BornesAgeTesteur.d \
+./DateTesteur.d \
 ./EntraineurTesteur.d \
+./FichierProjeteTesteur.d \
+./HorlogeTesteur.d \
+./ImportateurAnnuaireTesteur.d \
+./IndexHachageTesteur.d \
+./IndexNaissanceTesteur.d \
+./IndexNomsTesteur.d \
+./InstantaneAnnuaireTesteur.d \
 ./JoueurTesteur.d \
-./PersonneTesteur.d 
+./PersonneTesteur.d \
+./RequeteAnnuaireTesteur.d \
+./SiteContratTesteur.d \
+./TamponFormatageTesteur.d \
+./TriParBaseTesteur.d \
+./ValidationFormatTesteur.d 
 
 
 # Each subdirectory must supply rules for building sources it contributes
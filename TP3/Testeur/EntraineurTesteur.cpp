@@ -17,10 +17,12 @@
 			   const std::string& p_telephone, const std::string& p_numRAMQ, char p_sexe)
  * cas valide : <br>
  * 	EntraineurValide :	Entraineur avec des infos valides
+ * 	EntraineurNomAccentue : Entraineur dont le numéro de RAMQ reprend les lettres de son nom accentué, sans accent
  * <br>
  * cas invalide : <br>
  * 	EntraineurRAMQInvalide: Entraineur avec un numéro de RAMQ invalide
  * 	EntraineurAgeInvalide: Entraineur avec un âge invalide, inférieur a 18
+ * 	EntraineurNomAccentueInvalide: Numéro de RAMQ qui reprend les octets UTF-8 du nom accentué
  */
 TEST(EntraineurConstructeur, EntraineurValide)
 {
@@ -30,6 +32,13 @@ TEST(EntraineurConstructeur, EntraineurValide)
 			e.reqDateNaissance().reqAnnee(), e.reqSexe()));
 }
 
+TEST(EntraineurConstructeur, EntraineurNomAccentue)
+{
+	hockey::Entraineur e("\xC3\x89mond", "Jean", util::Date(1, 1, 1980), "418 498-4193", "EMOJ 8001 0112", 'M');
+	ASSERT_EQ("\xC3\x89mond", e.reqNom());
+	ASSERT_EQ("EMOJ 8001 0112", e.reqNumRAMQ());
+}
+
 TEST(EntraineurConstructeur, EntraineurRAMQInvalide)
 {
 	util::Date d(25, 8, 1999);
@@ -42,6 +51,12 @@ TEST(EntraineurConstructeur, EntraineurAgeInvalide)
 	ASSERT_THROW(hockey::Entraineur e("Jalbert", "David", d, "418 498-4193", "JALD 0508 2511", 'M'), PreconditionException);
 }
 
+TEST(EntraineurConstructeur, EntraineurNomAccentueInvalide)
+{
+	ASSERT_THROW(hockey::Entraineur e("\xC3\x89mond", "Jean", util::Date(1, 1, 1980), "418 498-4193", "\xC3\x89MJ 8001 0112", 'M'),
+				 PreconditionException);
+}
+
 
 /**
  * \class EntraineurBase
@@ -82,3 +97,40 @@ TEST_F(EntraineurBase, reqSexeValide)
 {
 	ASSERT_EQ('M', f_entraineurBase.reqSexe());
 }
+
+/**
+ * \brief Test de la fabrique static Resultat<Entraineur> creer(std::string p_nom, std::string p_prenom, const util::Date& p_dateNaissance,
+			   std::string p_telephone, std::string p_numRAMQ, char p_sexe)
+ * cas valide : <br>
+ * 	CreerValide :	Le résultat contient l'entraineur construit
+ * <br>
+ * cas invalide : <br>
+ * 	CreerInvalide : Chaque donnée invalide donne son code d'erreur, sans lancer d'exception
+ */
+TEST(EntraineurCreer, CreerValide)
+{
+	hockey::Resultat<hockey::Entraineur> resultat = hockey::Entraineur::creer("Jalbert", "David", util::Date(25, 8, 1999), "418 498-4193",
+																			  "JALD 9908 2511", 'M');
+	ASSERT_TRUE(resultat.estValide());
+	ASSERT_EQ("JALD 9908 2511", resultat.reqValeur().reqNumRAMQ());
+	ASSERT_EQ('M', resultat.reqValeur().reqSexe());
+	ASSERT_EQ("David", resultat.reqValeur().reqPrenom());
+}
+
+TEST(EntraineurCreer, CreerInvalide)
+{
+	util::Date d(25, 8, 1999);
+	ASSERT_EQ(hockey::CodeErreur::NomInvalide, hockey::Entraineur::creer("", "David", d, "418 498-4193", "JALD 9908 2511", 'M').reqErreur());
+	ASSERT_EQ(hockey::CodeErreur::PrenomInvalide, hockey::Entraineur::creer("Jalbert", "D4vid", d, "418 498-4193", "JALD 9908 2511",
+																			'M').reqErreur());
+	ASSERT_EQ(hockey::CodeErreur::TelephoneInvalide, hockey::Entraineur::creer("Jalbert", "David", d, "000 498-4193", "JALD 9908 2511",
+																			   'M').reqErreur());
+	ASSERT_EQ(hockey::CodeErreur::SexeInvalide, hockey::Entraineur::creer("Jalbert", "David", d, "418 498-4193", "JALD 9908 2511",
+																		  'X').reqErreur());
+	ASSERT_EQ(hockey::CodeErreur::NumRAMQInvalide, hockey::Entraineur::creer("Jalbert", "David", d, "418 498-4193", "9908",
+																			 'M').reqErreur());
+	ASSERT_EQ(hockey::CodeErreur::NumRAMQInvalide, hockey::Entraineur::creer("Jalbert", "David", d, "418 498-4193", "JALD 9908 2511",
+																			 'F').reqErreur());
+	ASSERT_EQ(hockey::CodeErreur::AgeInvalide, hockey::Entraineur::creer("Jalbert", "David", util::Date(25, 8, 2005), "418 498-4193",
+																		 "JALD 0508 2511", 'M').reqErreur());
+}
@@ -0,0 +1,55 @@
+/**
+ * \file FichierProjeteTesteur.cpp
+ * \brief  Fichier de tests unitaires pour la classe FichierProjete
+ * \author David J Ross
+ * \version 1
+ * \date 16 avril 2020
+ */
+
+#include <gtest/gtest.h>
+#include <fstream>
+#include <string>
+#include <cstdio>
+#include "FichierProjete.h"
+
+/**
+ * \brief Test de la méthode bool ouvrir(const std::string& p_fichier)
+ * cas valide : <br>
+ * 	ouvrirValide :	Le contenu projeté est celui du fichier, la projection est retirée à la fermeture
+ * <br>
+ * cas invalide : <br>
+ * 	ouvrirAbsent :	Fichier inexistant
+ * 	ouvrirVide :	Fichier vide
+ */
+TEST(FichierProjete, ouvrirValide)
+{
+	std::string chemin = ::testing::TempDir() + "FichierProjeteValide.bin";
+	std::ofstream(chemin.c_str(), std::ios::binary) << "Club des gagnants";
+
+	util::FichierProjete fichier;
+	ASSERT_TRUE(fichier.ouvrir(chemin));
+	ASSERT_TRUE(fichier.estOuvert());
+	ASSERT_EQ("Club des gagnants", std::string(fichier.reqDonnees(), fichier.reqTaille()));
+
+	fichier.fermer();
+	ASSERT_FALSE(fichier.estOuvert());
+	ASSERT_EQ(0u, fichier.reqTaille());
+	std::remove(chemin.c_str());
+}
+
+TEST(FichierProjete, ouvrirAbsent)
+{
+	util::FichierProjete fichier;
+	ASSERT_FALSE(fichier.ouvrir(::testing::TempDir() + "FichierProjeteAbsent.bin"));
+	ASSERT_FALSE(fichier.estOuvert());
+}
+
+TEST(FichierProjete, ouvrirVide)
+{
+	std::string chemin = ::testing::TempDir() + "FichierProjeteVide.bin";
+	std::ofstream(chemin.c_str(), std::ios::binary);
+
+	util::FichierProjete fichier;
+	ASSERT_FALSE(fichier.ouvrir(chemin));
+	std::remove(chemin.c_str());
+}
@@ -0,0 +1,83 @@
+/**
+ * \file HorlogeTesteur.cpp
+ * \brief  Fichier de tests unitaires pour la classe Horloge et environnement qui fixe la date du jour des tests
+ * \author David J Ross
+ * \version 1
+ * \date 16 avril 2020
+ */
+
+#include <gtest/gtest.h>
+#include <thread>
+#include "Horloge.h"
+#include "Date.h"
+
+/**
+ * \class DateDuJourFixee
+ * \brief Environnement de tous les tests : la date du jour est fixée au 16 avril 2020, pour que
+ * 		  les âges des membres de test ne dépendent pas du jour où les tests sont exécutés
+ */
+class DateDuJourFixee : public ::testing::Environment
+{
+public:
+	virtual void SetUp()
+	{
+		util::Horloge::fixerAujourdhui(util::Date(16, 4, 2020));
+	}
+	virtual void TearDown()
+	{
+		util::Horloge::suivreSysteme();
+	}
+};
+
+static ::testing::Environment* const s_dateDuJourFixee = ::testing::AddGlobalTestEnvironment(new DateDuJourFixee);
+
+/**
+ * \class HorlogeSysteme
+ * \brief Fixture qui laisse l'horloge suivre le système pendant le test et rétablit ensuite la date fixée
+ */
+class HorlogeSysteme : public ::testing::Test
+{
+public:
+	HorlogeSysteme(): f_dateFixee(util::Horloge::reqAujourdhui())
+	{
+		util::Horloge::suivreSysteme();
+	}
+	~HorlogeSysteme()
+	{
+		util::Horloge::fixerAujourdhui(f_dateFixee);
+	}
+
+	util::Date f_dateFixee;
+};
+
+/**
+ * \brief Test des méthodes statiques de la classe Horloge
+ * cas valide : <br>
+ * 	DateFixee :	La date fixée est retournée par reqAujourdhui(), dans tous les fils
+ * 	DateSysteme : Sans date fixée, reqAujourdhui() retourne la date du système, à chaque appel
+ * <br>
+ * cas invalide : <br>
+ * 	Aucun d'identifié
+ */
+TEST(Horloge, DateFixee)
+{
+	ASSERT_TRUE(util::Horloge::estFixee());
+	ASSERT_EQ(util::Date(16, 4, 2020), util::Horloge::reqAujourdhui());
+
+	util::Date autreFil(1, 1, 1970);
+	std::thread fil([&autreFil]() { autreFil = util::Horloge::reqAujourdhui(); });
+	fil.join();
+	ASSERT_EQ(util::Date(16, 4, 2020), autreFil);
+}
+
+TEST_F(HorlogeSysteme, DateSysteme)
+{
+	ASSERT_FALSE(util::Horloge::estFixee());
+	util::Date avant;
+	util::Date aujourdhui = util::Horloge::reqAujourdhui();
+	util::Date memeJour = util::Horloge::reqAujourdhui();
+	util::Date apres;
+	// Minuit peut passer entre deux lectures
+	ASSERT_TRUE(aujourdhui == avant || aujourdhui == apres);
+	ASSERT_TRUE(memeJour == aujourdhui || memeJour == apres);
+}
@@ -0,0 +1,236 @@
+/**
+ * \file ImportateurAnnuaireTesteur.cpp
+ * \brief  Fichier de tests unitaires pour la classe ImportateurAnnuaire
+ * \author David J Ross
+ * \version 1
+ * \date 16 avril 2020
+ */
+
+#include <gtest/gtest.h>
+#include <sstream>
+#include <stdexcept>
+#include <streambuf>
+#include "ImportateurAnnuaire.h"
+#include "Annuaire.h"
+#include "Joueur.h"
+#include "Entraineur.h"
+#include "Date.h"
+
+/**
+ * \brief Test du Constructeur ImportateurAnnuaire::ImportateurAnnuaire(char p_delimiteur, unsigned int p_tailleLot,
+ * 								unsigned int p_nbErreursDetaillees)
+ * cas valide : <br>
+ * 	ImportateurValide :	Délimiteur et taille de lot valides
+ * <br>
+ * cas invalide : <br>
+ * 	ImportateurTailleLotInvalide : Taille de lot nulle
+ */
+TEST(ImportateurAnnuaireConstructeur, ImportateurValide)
+{
+	hockey::ImportateurAnnuaire importateur('\t', 16);
+	ASSERT_EQ('\t', importateur.reqDelimiteur());
+	ASSERT_EQ(16u, importateur.reqTailleLot());
+}
+
+TEST(ImportateurAnnuaireConstructeur, ImportateurTailleLotInvalide)
+{
+	ASSERT_THROW(hockey::ImportateurAnnuaire importateur(',', 0), PreconditionException);
+}
+
+/**
+ * \brief Test de la méthode RapportImportation importer(std::istream& p_entree, Annuaire& p_annuaire) const
+ * cas valide : <br>
+ * 	importerValide :	Un joueur et un entraineur valides, avec commentaire et ligne vide
+ * 	importerTSV :		Fichier délimité par des tabulations, fin de ligne Windows
+ * 	importerPlusieursLots : Plus de lignes que la taille d'un lot, l'ordre est conservé
+ * <br>
+ * cas invalide : <br>
+ * 	importerLignesInvalides : Chaque ligne invalide est consignée sans lever d'exception
+ * 	importerErreursBornees : Le détail des erreurs est limité, le compte reste exact
+ */
+TEST(ImportateurAnnuaire, importerValide)
+{
+	std::istringstream entree("# role,nom,prenom,naissance,telephone,position|RAMQ,sexe\n"
+							  "J,Nom,Prenom,25/08/2004,418 498-4193,centre\n"
+							  "\n"
+							  "E,Jalbert,David,25/08/1999,418 498-4193,JALD 9908 2511,M\n");
+	hockey::Annuaire annuaire("Test");
+	hockey::RapportImportation rapport = hockey::ImportateurAnnuaire().importer(entree, annuaire);
+
+	ASSERT_EQ(2u, rapport.m_nbLignes);
+	ASSERT_EQ(2u, rapport.m_nbAjouts);
+	ASSERT_EQ(0u, rapport.m_nbErreurs);
+	ASSERT_EQ(2u, annuaire.reqNbMembres());
+	ASSERT_TRUE(annuaire.trouverParNumRAMQ("JALD 9908 2511") != nullptr);
+}
+
+TEST(ImportateurAnnuaire, importerTSV)
+{
+	std::istringstream entree("J\tNom\tPrenom\t25/08/2004\t418 498-4193\tgardien\r\n");
+	hockey::Annuaire annuaire("Test");
+	hockey::RapportImportation rapport = hockey::ImportateurAnnuaire('\t').importer(entree, annuaire);
+
+	ASSERT_EQ(1u, rapport.m_nbAjouts);
+	ASSERT_EQ("gardien", dynamic_cast<const hockey::Joueur&>(annuaire.reqMembre(0)).reqPosition());
+}
+
+TEST(ImportateurAnnuaire, importerPlusieursLots)
+{
+	std::ostringstream fichier;
+	const char* noms[] = { "Aa", "Bb", "Cc", "Dd", "Ee", "Ff", "Gg" };
+	for (int i = 0; i < 7; i++)
+	{
+		fichier << "J," << noms[i] << ",Prenom,25/08/2004,418 498-4193,ailier\n";
+	}
+	std::istringstream entree(fichier.str());
+	hockey::Annuaire annuaire("Test");
+	hockey::RapportImportation rapport = hockey::ImportateurAnnuaire(',', 3).importer(entree, annuaire);
+
+	ASSERT_EQ(7u, rapport.m_nbAjouts);
+	for (unsigned int i = 0; i < 7; i++)
+	{
+		ASSERT_EQ(noms[i], annuaire.reqMembre(i).reqNom());
+	}
+}
+
+TEST(ImportateurAnnuaire, importerLignesInvalides)
+{
+	std::istringstream entree("X,Nom,Prenom,25/08/2004,418 498-4193,centre\n"
+							  "J,Nom,Prenom,25/08/2004,418 498-4193\n"
+							  "J,Nom6,Prenom,25/08/2004,418 498-4193,centre\n"
+							  "J,Nom,Prenom6,25/08/2004,418 498-4193,centre\n"
+							  "J,Nom,Prenom,31/02/2004,418 498-4193,centre\n"
+							  "J,Nom,Prenom,25/08/2004,41893,centre\n"
+							  "J,Nom,Prenom,25/08/2004,418 498-4193,wrabla\n"
+							  "J,Nom,Prenom,25/08/2001,418 498-4193,centre\n"
+							  "E,Jalbert,David,25/08/1999,418 498-4193,JALD 9908 2511,X\n"
+							  "E,Jalbert,David,25/08/1999,418 498-4193,9908,M\n"
+							  "J,Nom,Prenom,25/08/2004,418 498-4193,centre\n"
+							  "J,Nom,Prenom,25/08/2004,418 498-4193,ailier\n");
+	hockey::Annuaire annuaire("Test");
+	hockey::RapportImportation rapport = hockey::ImportateurAnnuaire().importer(entree, annuaire);
+
+	ASSERT_EQ(12u, rapport.m_nbLignes);
+	ASSERT_EQ(1u, rapport.m_nbAjouts);
+	ASSERT_EQ(11u, rapport.m_nbErreurs);
+	ASSERT_EQ(11u, rapport.m_vErreurs.size());
+	const char* messages[] = { "Rôle invalide", "Nombre de champs invalide", "Nom invalide", "Prénom invalide",
+							   "Date de naissance invalide", "Téléphone invalide", "Position invalide", "Âge invalide",
+							   "Sexe invalide", "Numéro de RAMQ invalide" };
+	for (unsigned int i = 0; i < 10; i++)
+	{
+		ASSERT_EQ(i + 1, rapport.m_vErreurs[i].m_ligne);
+		ASSERT_EQ(messages[i], rapport.m_vErreurs[i].m_message);
+	}
+	ASSERT_EQ(12u, rapport.m_vErreurs[10].m_ligne);
+	ASSERT_EQ("Membre déjà présent", rapport.m_vErreurs[10].m_message);
+}
+
+TEST(ImportateurAnnuaire, importerErreursBornees)
+{
+	std::ostringstream fichier;
+	for (int i = 0; i < 50; i++)
+	{
+		fichier << "J,Nom6,Prenom,25/08/2004,418 498-4193,centre\n";
+	}
+	std::istringstream entree(fichier.str());
+	hockey::Annuaire annuaire("Test");
+	hockey::RapportImportation rapport = hockey::ImportateurAnnuaire(',', 8, 5).importer(entree, annuaire);
+
+	ASSERT_EQ(50u, rapport.m_nbErreurs);
+	ASSERT_EQ(5u, rapport.m_vErreurs.size());
+}
+
+/**
+ * \brief Test de la méthode RapportImportation importerParallele(std::istream& p_entree, Annuaire& p_annuaire,
+ * 								unsigned int p_nbFils) const
+ * cas valide : <br>
+ * 	importerParalleleIdentique : Même rapport et mêmes membres, dans le même ordre, qu'une importation séquentielle
+ * <br>
+ * cas invalide : <br>
+ * 	importerParalleleFluxEnErreur : L'exception levée par le flux pendant que les fils valident
+ * 									est propagée à l'appelant, après la fusion des groupes précédents
+ */
+TEST(ImportateurAnnuaire, importerParalleleIdentique)
+{
+	std::ostringstream fichier;
+	const char* lettres = "abcdefghij";
+	for (int i = 0; i < 300; i++)
+	{
+		fichier << "J,N" << lettres[i / 100] << lettres[i / 10 % 10] << lettres[i % 10] << ",Prenom,25/08/2004,418 498-4193,centre\n";
+		if (i % 7 == 0)
+		{
+			fichier << "J,Invalide6,Prenom,25/08/2004,418 498-4193,centre\n";
+		}
+		if (i % 11 == 0)
+		{
+			fichier << "J,Naaa,Prenom,25/08/2004,418 498-4193,centre\n";
+		}
+	}
+	hockey::ImportateurAnnuaire importateur(',', 16);
+
+	std::istringstream entreeSequentielle(fichier.str());
+	hockey::Annuaire sequentiel("Test");
+	hockey::RapportImportation rapportSequentiel = importateur.importer(entreeSequentielle, sequentiel);
+
+	std::istringstream entreeParallele(fichier.str());
+	hockey::Annuaire parallele("Test");
+	hockey::RapportImportation rapportParallele = importateur.importerParallele(entreeParallele, parallele, 4);
+
+	ASSERT_EQ(rapportSequentiel.m_nbLignes, rapportParallele.m_nbLignes);
+	ASSERT_EQ(300u, rapportParallele.m_nbAjouts);
+	ASSERT_EQ(rapportSequentiel.m_nbErreurs, rapportParallele.m_nbErreurs);
+	ASSERT_EQ(rapportSequentiel.m_vErreurs.size(), rapportParallele.m_vErreurs.size());
+	for (unsigned int i = 0; i < rapportParallele.m_vErreurs.size(); i++)
+	{
+		ASSERT_EQ(rapportSequentiel.m_vErreurs[i].m_ligne, rapportParallele.m_vErreurs[i].m_ligne);
+		ASSERT_EQ(rapportSequentiel.m_vErreurs[i].m_message, rapportParallele.m_vErreurs[i].m_message);
+	}
+	for (unsigned int i = 0; i < parallele.reqNbMembres(); i++)
+	{
+		ASSERT_TRUE(sequentiel.reqMembre(i) == parallele.reqMembre(i));
+	}
+}
+
+namespace
+{
+/**
+ * \brief Tampon de flux qui fournit un texte puis lève une exception au lieu de signaler la fin
+ */
+class TamponEnErreur: public std::streambuf
+{
+public:
+	explicit TamponEnErreur(const std::string& p_texte):
+			m_texte(p_texte)
+	{
+		setg(&m_texte[0], &m_texte[0], &m_texte[0] + m_texte.size());
+	}
+
+protected:
+	int_type underflow() override
+	{
+		throw std::runtime_error("lecture impossible");
+	}
+
+private:
+	std::string m_texte;
+};
+}
+
+TEST(ImportateurAnnuaire, importerParalleleFluxEnErreur)
+{
+	std::ostringstream fichier;
+	const char* lettres = "abcdefghij";
+	for (int i = 0; i < 100; i++)
+	{
+		fichier << "J,N" << lettres[i / 10] << lettres[i % 10] << ",Prenom,25/08/2004,418 498-4193,centre\n";
+	}
+	TamponEnErreur tampon(fichier.str());
+	std::istream entree(&tampon);
+	entree.exceptions(std::ios::badbit);
+	hockey::ImportateurAnnuaire importateur(',', 16);
+	hockey::Annuaire annuaire("Test");
+
+	ASSERT_THROW(importateur.importerParallele(entree, annuaire, 2), std::runtime_error);
+	ASSERT_EQ(64u, annuaire.reqNbMembres());
+}
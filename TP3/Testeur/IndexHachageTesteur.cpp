@@ -0,0 +1,316 @@
+/**
+ * \file IndexHachageTesteur.cpp
+ * \brief  Fichier de tests unitaires pour la classe IndexHachage
+ * \author David J Ross
+ * \version 1
+ * \date 16 avril 2020
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+#include "IndexHachage.h"
+
+/**
+ * \class IndexHachageBase
+ * \brief Fixture pour la création d'un index contenant trois positions de même clé et
+ * 		  cent positions de clés distinctes, assez pour agrandir le tableau plusieurs fois
+ */
+class IndexHachageBase : public ::testing::Test
+{
+public:
+	IndexHachageBase()
+	{
+		for (std::uint32_t position = 0; position < 3; position++)
+		{
+			f_index.ajouter(CLE_COMMUNE, position);
+		}
+		for (std::uint32_t position = 3; position < 103; position++)
+		{
+			f_index.ajouter(position * 7, position);
+		}
+	}
+
+	/**
+	 * \brief Retourne les positions associées à une clé, en ordre croissant
+	 */
+	std::vector<std::uint32_t> trouver(std::size_t p_cle) const
+	{
+		std::vector<std::uint32_t> vPositions;
+		f_index.parcourir(p_cle, [&vPositions](std::uint32_t p_position)
+		{
+			vPositions.push_back(p_position);
+			return true;
+		});
+		std::sort(vPositions.begin(), vPositions.end());
+		return vPositions;
+	}
+
+	static const std::size_t CLE_COMMUNE = 1000000;
+	hockey::IndexHachage f_index;
+};
+
+/**
+ * \brief Test des méthodes ajouter(), parcourir() et reserver()
+ * cas valide : <br>
+ * 	ajouterValide :	Toutes les positions sont retrouvées, le tableau reste au plus à moitié plein
+ * 	ajouterMemeCle : Les positions d'une même clé sont toutes retrouvées
+ * 	parcourirArret : Le parcours s'arrête dès que la fonction retourne faux
+ * 	reserverCapacite : La capacité réservée suffit, l'index vide n'alloue rien
+ * <br>
+ * cas invalide : <br>
+ * 	parcourirAbsent : Clé absente, index vide
+ * 	ajouterInvalide : Position POSITION_VIDE
+ */
+TEST_F(IndexHachageBase, ajouterValide)
+{
+	ASSERT_EQ(103u, f_index.reqNbEntrees());
+	ASSERT_GE(f_index.reqCapacite(), 2 * f_index.reqNbEntrees());
+	for (std::uint32_t position = 3; position < 103; position++)
+	{
+		ASSERT_EQ(std::vector<std::uint32_t>({ position }), trouver(position * 7)) << position;
+	}
+}
+
+TEST_F(IndexHachageBase, ajouterMemeCle)
+{
+	ASSERT_EQ(std::vector<std::uint32_t>({ 0, 1, 2 }), trouver(CLE_COMMUNE));
+	f_index.ajouter(CLE_COMMUNE, 1);
+	ASSERT_EQ(std::vector<std::uint32_t>({ 0, 1, 1, 2 }), trouver(CLE_COMMUNE));
+}
+
+TEST_F(IndexHachageBase, parcourirArret)
+{
+	int nbAppels = 0;
+	f_index.parcourir(CLE_COMMUNE, [&nbAppels](std::uint32_t)
+	{
+		nbAppels++;
+		return false;
+	});
+	ASSERT_EQ(1, nbAppels);
+}
+
+TEST(IndexHachage, reserverCapacite)
+{
+	hockey::IndexHachage index;
+	ASSERT_EQ(0u, index.reqCapacite());
+
+	index.reserver(1000);
+	std::size_t capacite = index.reqCapacite();
+	ASSERT_GE(capacite, 2000u);
+	for (std::uint32_t position = 0; position < 1000; position++)
+	{
+		index.ajouter(position, position);
+	}
+	ASSERT_EQ(capacite, index.reqCapacite());
+
+	index.reserver(10);
+	ASSERT_EQ(capacite, index.reqCapacite());
+}
+
+TEST_F(IndexHachageBase, parcourirAbsent)
+{
+	ASSERT_TRUE(trouver(5).empty());
+	hockey::IndexHachage vide;
+	int nbAppels = 0;
+	vide.parcourir(0, [&nbAppels](std::uint32_t)
+	{
+		nbAppels++;
+		return true;
+	});
+	ASSERT_EQ(0, nbAppels);
+}
+
+TEST_F(IndexHachageBase, ajouterInvalide)
+{
+	ASSERT_THROW(f_index.ajouter(1, hockey::IndexHachage::POSITION_VIDE), PreconditionException);
+}
+
+/**
+ * \brief Test des méthodes bool retirer(std::size_t p_cle, std::uint32_t p_position) et
+ * 		  bool remplacer(std::size_t p_cle, std::uint32_t p_ancienne, std::uint32_t p_nouvelle)
+ * cas valide : <br>
+ * 	retirerValide :	Seule l'entrée retirée quitte l'index, les entrées qui la suivaient sont retrouvées
+ * 	retirerTous : L'index vidé accepte de nouvelles entrées
+ * 	remplacerValide : Seule la position de l'entrée visée change
+ * 	copieIndependante : Une copie ne partage pas ses entrées avec l'index d'origine
+ * <br>
+ * cas invalide : <br>
+ * 	retirerAbsent : Position absente, clé absente
+ * 	remplacerInvalide : Entrée absente, nouvelle position POSITION_VIDE
+ */
+TEST_F(IndexHachageBase, retirerValide)
+{
+	ASSERT_TRUE(f_index.retirer(CLE_COMMUNE, 1));
+	ASSERT_EQ(std::vector<std::uint32_t>({ 0, 2 }), trouver(CLE_COMMUNE));
+
+	for (std::uint32_t position = 3; position < 103; position += 2)
+	{
+		ASSERT_TRUE(f_index.retirer(position * 7, position));
+	}
+	ASSERT_EQ(52u, f_index.reqNbEntrees());
+	for (std::uint32_t position = 3; position < 103; position++)
+	{
+		ASSERT_EQ(position % 2 == 0, trouver(position * 7).size() == 1) << position;
+	}
+}
+
+TEST_F(IndexHachageBase, retirerTous)
+{
+	for (std::uint32_t position = 0; position < 3; position++)
+	{
+		ASSERT_TRUE(f_index.retirer(CLE_COMMUNE, position));
+	}
+	for (std::uint32_t position = 3; position < 103; position++)
+	{
+		ASSERT_TRUE(f_index.retirer(position * 7, position));
+	}
+	ASSERT_EQ(0u, f_index.reqNbEntrees());
+
+	f_index.ajouter(CLE_COMMUNE, 4);
+	ASSERT_EQ(std::vector<std::uint32_t>({ 4 }), trouver(CLE_COMMUNE));
+}
+
+TEST_F(IndexHachageBase, remplacerValide)
+{
+	ASSERT_TRUE(f_index.remplacer(CLE_COMMUNE, 2, 200));
+	ASSERT_EQ(std::vector<std::uint32_t>({ 0, 1, 200 }), trouver(CLE_COMMUNE));
+	ASSERT_TRUE(f_index.remplacer(70, 10, 0));
+	ASSERT_EQ(std::vector<std::uint32_t>({ 0 }), trouver(70));
+	ASSERT_EQ(103u, f_index.reqNbEntrees());
+}
+
+TEST_F(IndexHachageBase, copieIndependante)
+{
+	hockey::IndexHachage copie(f_index);
+	ASSERT_TRUE(copie.retirer(CLE_COMMUNE, 0));
+	ASSERT_EQ(std::vector<std::uint32_t>({ 0, 1, 2 }), trouver(CLE_COMMUNE));
+	ASSERT_EQ(102u, copie.reqNbEntrees());
+}
+
+TEST_F(IndexHachageBase, retirerAbsent)
+{
+	ASSERT_FALSE(f_index.retirer(CLE_COMMUNE, 3));
+	ASSERT_FALSE(f_index.retirer(5, 0));
+	ASSERT_EQ(103u, f_index.reqNbEntrees());
+
+	hockey::IndexHachage vide;
+	ASSERT_FALSE(vide.retirer(0, 0));
+}
+
+TEST_F(IndexHachageBase, remplacerInvalide)
+{
+	ASSERT_FALSE(f_index.remplacer(CLE_COMMUNE, 3, 4));
+	ASSERT_THROW(f_index.remplacer(CLE_COMMUNE, 0, hockey::IndexHachage::POSITION_VIDE), PreconditionException);
+}
+
+/**
+ * \brief Test de la méthode void renumeroter(const std::vector<std::uint32_t>& p_vNouvellesPositions)
+ * cas valide : <br>
+ * 	renumeroterValide :	Chaque entrée reçoit sa nouvelle position et reste trouvée par sa clé
+ * <br>
+ * cas invalide : <br>
+ * 	renumeroterInvalide : Position absente de la table, nouvelle position POSITION_VIDE
+ */
+TEST_F(IndexHachageBase, renumeroterValide)
+{
+	std::vector<std::uint32_t> vNouvellesPositions(103);
+	for (std::uint32_t position = 0; position < 103; position++)
+	{
+		vNouvellesPositions[position] = 1000 + position;
+	}
+	f_index.renumeroter(vNouvellesPositions);
+
+	ASSERT_EQ(std::vector<std::uint32_t>({ 1000, 1001, 1002 }), trouver(CLE_COMMUNE));
+	for (std::uint32_t position = 3; position < 103; position++)
+	{
+		ASSERT_EQ(std::vector<std::uint32_t>({ 1000 + position }), trouver(position * 7));
+	}
+	ASSERT_EQ(103u, f_index.reqNbEntrees());
+}
+
+TEST_F(IndexHachageBase, renumeroterInvalide)
+{
+	ASSERT_THROW(f_index.renumeroter(std::vector<std::uint32_t>(50, 0)), PreconditionException);
+
+	std::vector<std::uint32_t> vNouvellesPositions(103, 0);
+	vNouvellesPositions[0] = hockey::IndexHachage::POSITION_VIDE;
+	hockey::IndexHachage index;
+	index.ajouter(CLE_COMMUNE, 0);
+	ASSERT_THROW(index.renumeroter(vNouvellesPositions), PreconditionException);
+}
+
+/**
+ * \brief Test de la méthode void construire(const std::vector<std::pair<std::size_t, std::uint32_t>>& p_vEntrees)
+ * cas valide : <br>
+ * 	construireValide : Toutes les entrées sont retrouvées, y compris celles de même clé
+ * 	construireRemplace : Les entrées précédentes disparaissent, l'index accepte ensuite des ajouts et des retraits
+ * 	construireVide : Un index construit sans entrée reste utilisable
+ * <br>
+ * cas invalide : <br>
+ * 	construireInvalide : Position POSITION_VIDE
+ */
+TEST(IndexHachage, construireValide)
+{
+	std::vector<std::pair<std::size_t, std::uint32_t>> vEntrees;
+	for (std::uint32_t position = 0; position < 1000; position++)
+	{
+		vEntrees.emplace_back(position % 10 == 0 ? 42 : position * 13, position);
+	}
+	hockey::IndexHachage index;
+	index.construire(vEntrees);
+
+	ASSERT_EQ(1000u, index.reqNbEntrees());
+	ASSERT_GE(index.reqCapacite(), 2000u);
+	std::vector<std::uint32_t> vCommunes;
+	index.parcourir(42, [&vCommunes](std::uint32_t p_position)
+	{
+		vCommunes.push_back(p_position);
+		return true;
+	});
+	ASSERT_EQ(100u, vCommunes.size());
+	for (std::uint32_t position = 1; position < 1000; position++)
+	{
+		if (position % 10 != 0)
+		{
+			int nbTrouvees = 0;
+			index.parcourir(position * 13, [&nbTrouvees, position](std::uint32_t p_position)
+			{
+				nbTrouvees += p_position == position;
+				return true;
+			});
+			ASSERT_EQ(1, nbTrouvees) << position;
+		}
+	}
+}
+
+TEST_F(IndexHachageBase, construireRemplace)
+{
+	f_index.construire({ { 5, 0 }, { 6, 1 } });
+	ASSERT_EQ(2u, f_index.reqNbEntrees());
+	ASSERT_TRUE(trouver(CLE_COMMUNE).empty());
+	ASSERT_EQ(std::vector<std::uint32_t>({ 0 }), trouver(5));
+
+	for (std::uint32_t position = 2; position < 100; position++)
+	{
+		f_index.ajouter(5, position);
+	}
+	ASSERT_TRUE(f_index.retirer(6, 1));
+	ASSERT_EQ(99u, trouver(5).size());
+}
+
+TEST(IndexHachage, construireVide)
+{
+	hockey::IndexHachage index;
+	index.construire({});
+	ASSERT_EQ(0u, index.reqNbEntrees());
+	index.ajouter(1, 1);
+	ASSERT_EQ(1u, index.reqNbEntrees());
+}
+
+TEST(IndexHachage, construireInvalide)
+{
+	hockey::IndexHachage index;
+	ASSERT_THROW(index.construire({ { 1, 0 }, { 2, hockey::IndexHachage::POSITION_VIDE } }), PreconditionException);
+}
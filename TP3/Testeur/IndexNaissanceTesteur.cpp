@@ -0,0 +1,218 @@
+/**
+ * \file IndexNaissanceTesteur.cpp
+ * \brief  Fichier de tests unitaires pour la classe IndexNaissance
+ * \author David J Ross
+ * \version 1
+ * \date 16 avril 2020
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <vector>
+#include "IndexNaissance.h"
+#include "Joueur.h"
+#include "Date.h"
+
+/**
+ * \class IndexNaissanceBase
+ * \brief Fixture pour la création d'un index à blocs de deux entrées contenant six joueurs,
+ * 		  ajoutés dans le désordre, dont deux nés le même jour
+ */
+class IndexNaissanceBase : public ::testing::Test
+{
+public:
+	IndexNaissanceBase():f_index(2),
+			f_vJoueurs({ hockey::Joueur("Roy", "Marc", util::Date(1, 1, 2005), "418 555-4567", "ailier"),
+						 hockey::Joueur("Gagnon", "Luc", util::Date(10, 10, 2003), "581 555-2345", "gardien"),
+						 hockey::Joueur("Trudel", "Anne", util::Date(20, 6, 2004), "450 555-3456", "centre"),
+						 hockey::Joueur("Tremblay", "Alex", util::Date(3, 3, 2004), "418 555-1234", "gardien"),
+						 hockey::Joueur("Cote", "Lea", util::Date(20, 6, 2004), "819 555-7890", "centre"),
+						 hockey::Joueur("Pare", "Eve", util::Date(1, 5, 2002), "418 555-0000", "ailier") })
+	{
+		for (const hockey::Joueur& joueur : f_vJoueurs)
+		{
+			f_index.ajouter(&joueur);
+		}
+	}
+
+	/**
+	 * \brief Retourne les dates de naissance, en jours, des membres d'un intervalle
+	 */
+	std::vector<long> naissances(long p_premierJour, long p_dernierJour) const
+	{
+		std::vector<const hockey::Personne*> vTrouves;
+		f_index.collecter(p_premierJour, p_dernierJour, vTrouves);
+		std::vector<long> vJours;
+		for (const hockey::Personne* membre : vTrouves)
+		{
+			vJours.push_back(membre->reqDateNaissance().reqJoursEpoque());
+		}
+		return vJours;
+	}
+
+	hockey::IndexNaissance f_index;
+	std::vector<hockey::Joueur> f_vJoueurs;
+};
+
+/**
+ * \brief Test des méthodes ajouter(), collecter() et parcourir()
+ * cas valide : <br>
+ * 	ajouterOrdonne :	Les membres ajoutés dans le désordre sont parcourus par date croissante, répartis en plusieurs blocs
+ * 	collecterIntervalle : Bornes incluses, intervalle qui traverse plusieurs blocs, intervalle vide
+ * 	parcourirArret : Le parcours s'arrête dès que la fonction retourne faux
+ * <br>
+ * cas invalide : <br>
+ * 	constructeurInvalide : Blocs d'une seule entrée
+ */
+TEST_F(IndexNaissanceBase, ajouterOrdonne)
+{
+	ASSERT_EQ(6u, f_index.reqNbMembres());
+	ASSERT_GE(f_index.reqNbBlocs(), 3u);
+
+	std::vector<long> vJours = naissances(0, util::Date(31, 12, 2037).reqJoursEpoque());
+	ASSERT_EQ(6u, vJours.size());
+	ASSERT_TRUE(std::is_sorted(vJours.begin(), vJours.end()));
+	ASSERT_EQ(util::Date(1, 5, 2002).reqJoursEpoque(), vJours.front());
+	ASSERT_EQ(util::Date(1, 1, 2005).reqJoursEpoque(), vJours.back());
+}
+
+TEST_F(IndexNaissanceBase, collecterIntervalle)
+{
+	long juin2004 = util::Date(20, 6, 2004).reqJoursEpoque();
+	ASSERT_EQ(std::vector<long>({ juin2004, juin2004 }), naissances(juin2004, juin2004));
+	ASSERT_EQ(4u, naissances(util::Date(10, 10, 2003).reqJoursEpoque(), juin2004).size());
+	ASSERT_EQ(4u, naissances(util::Date(11, 10, 2003).reqJoursEpoque(), util::Date(1, 1, 2005).reqJoursEpoque()).size());
+	ASSERT_TRUE(naissances(util::Date(2, 1, 2005).reqJoursEpoque(), util::Date(31, 12, 2037).reqJoursEpoque()).empty());
+	ASSERT_TRUE(naissances(juin2004 + 1, juin2004).empty());
+}
+
+TEST_F(IndexNaissanceBase, parcourirArret)
+{
+	int nbAppels = 0;
+	f_index.parcourir(0, util::Date(31, 12, 2037).reqJoursEpoque(), [&nbAppels](const hockey::Personne*)
+	{
+		nbAppels++;
+		return nbAppels < 2;
+	});
+	ASSERT_EQ(2, nbAppels);
+}
+
+TEST(IndexNaissance, constructeurInvalide)
+{
+	ASSERT_THROW(hockey::IndexNaissance index(1), PreconditionException);
+}
+
+/**
+ * \brief Test de la méthode bool retirer(const Personne* p_membre)
+ * cas valide : <br>
+ * 	retirerValide :	Seul le membre retiré quitte l'index, même si un autre est né le même jour
+ * 	retirerTous : L'index vidé n'a plus de bloc et accepte de nouveaux membres
+ * <br>
+ * cas invalide : <br>
+ * 	retirerAbsent : Un membre qui n'est pas indexé n'est pas retiré
+ */
+TEST_F(IndexNaissanceBase, retirerValide)
+{
+	long juin2004 = util::Date(20, 6, 2004).reqJoursEpoque();
+	ASSERT_TRUE(f_index.retirer(&f_vJoueurs[4]));
+	ASSERT_EQ(5u, f_index.reqNbMembres());
+
+	std::vector<const hockey::Personne*> vTrouves;
+	f_index.collecter(juin2004, juin2004, vTrouves);
+	ASSERT_EQ(std::vector<const hockey::Personne*>({ &f_vJoueurs[2] }), vTrouves);
+	ASSERT_FALSE(f_index.retirer(&f_vJoueurs[4]));
+}
+
+TEST_F(IndexNaissanceBase, retirerTous)
+{
+	for (const hockey::Joueur& joueur : f_vJoueurs)
+	{
+		ASSERT_TRUE(f_index.retirer(&joueur));
+	}
+	ASSERT_EQ(0u, f_index.reqNbMembres());
+	ASSERT_EQ(0u, f_index.reqNbBlocs());
+
+	f_index.ajouter(&f_vJoueurs[0]);
+	ASSERT_EQ(1u, naissances(0, util::Date(31, 12, 2037).reqJoursEpoque()).size());
+}
+
+TEST_F(IndexNaissanceBase, retirerAbsent)
+{
+	hockey::Joueur absent("Roy", "Marc", util::Date(1, 1, 2005), "418 555-4567", "ailier");
+	ASSERT_FALSE(f_index.retirer(&absent));
+	ASSERT_EQ(6u, f_index.reqNbMembres());
+}
+
+/**
+ * \brief Test des méthodes void construire(const std::vector<const Personne*>& p_vMembres) et
+ * 		  void copier(const IndexNaissance& p_index, Correspondance p_correspondance)
+ * cas valide : <br>
+ * 	construireOrdonne :	Les membres donnés dans le désordre sont parcourus par date croissante et
+ * 						acceptent ensuite des ajouts et des retraits
+ * 	construireRemplace : Le contenu précédent de l'index est remplacé, un vector vide le vide
+ * 	copierCorrespondance : Chaque membre copié est remplacé par son correspondant, l'index d'origine est intact
+ * <br>
+ * cas invalide : <br>
+ * 	Aucun d'identifié
+ */
+TEST_F(IndexNaissanceBase, construireOrdonne)
+{
+	hockey::IndexNaissance index(2);
+	std::vector<const hockey::Personne*> vMembres;
+	for (const hockey::Joueur& joueur : f_vJoueurs)
+	{
+		vMembres.push_back(&joueur);
+	}
+	index.construire(vMembres);
+	ASSERT_EQ(6u, index.reqNbMembres());
+	ASSERT_EQ(3u, index.reqNbBlocs());
+
+	std::vector<const hockey::Personne*> vTrouves;
+	index.collecter(0, util::Date(31, 12, 2037).reqJoursEpoque(), vTrouves);
+	ASSERT_EQ(6u, vTrouves.size());
+	ASSERT_EQ(&f_vJoueurs[5], vTrouves.front());
+	ASSERT_EQ(&f_vJoueurs[0], vTrouves.back());
+
+	ASSERT_TRUE(index.retirer(&f_vJoueurs[4]));
+	index.ajouter(&f_vJoueurs[4]);
+	vTrouves.clear();
+	long juin2004 = util::Date(20, 6, 2004).reqJoursEpoque();
+	index.collecter(juin2004, juin2004, vTrouves);
+	ASSERT_EQ(2u, vTrouves.size());
+}
+
+TEST_F(IndexNaissanceBase, construireRemplace)
+{
+	f_index.construire(std::vector<const hockey::Personne*>({ &f_vJoueurs[1] }));
+	ASSERT_EQ(1u, f_index.reqNbMembres());
+	ASSERT_EQ(std::vector<long>({ util::Date(10, 10, 2003).reqJoursEpoque() }), naissances(0, util::Date(31, 12, 2037).reqJoursEpoque()));
+
+	f_index.construire(std::vector<const hockey::Personne*>());
+	ASSERT_EQ(0u, f_index.reqNbMembres());
+	ASSERT_EQ(0u, f_index.reqNbBlocs());
+}
+
+TEST_F(IndexNaissanceBase, copierCorrespondance)
+{
+	std::vector<hockey::Joueur> vCopies(f_vJoueurs);
+	hockey::IndexNaissance copie;
+	copie.copier(f_index, [this, &vCopies](const hockey::Personne* p_membre)
+	{
+		return &vCopies[static_cast<const hockey::Joueur*>(p_membre) - f_vJoueurs.data()];
+	});
+	ASSERT_EQ(f_index.reqNbMembres(), copie.reqNbMembres());
+	ASSERT_EQ(f_index.reqNbBlocs(), copie.reqNbBlocs());
+
+	std::vector<const hockey::Personne*> vOriginaux, vTrouves;
+	f_index.collecter(0, util::Date(31, 12, 2037).reqJoursEpoque(), vOriginaux);
+	copie.collecter(0, util::Date(31, 12, 2037).reqJoursEpoque(), vTrouves);
+	ASSERT_EQ(vOriginaux.size(), vTrouves.size());
+	for (std::size_t i = 0; i < vTrouves.size(); i++)
+	{
+		ASSERT_EQ(&vCopies[static_cast<const hockey::Joueur*>(vOriginaux[i]) - f_vJoueurs.data()], vTrouves[i]);
+	}
+
+	ASSERT_TRUE(copie.retirer(&vCopies[0]));
+	ASSERT_FALSE(copie.retirer(&f_vJoueurs[1]));
+	ASSERT_EQ(6u, f_index.reqNbMembres());
+}
@@ -0,0 +1,249 @@
+/**
+ * \file IndexNomsTesteur.cpp
+ * \brief  Fichier de tests unitaires pour la classe IndexNoms
+ * \author David J Ross
+ * \version 1
+ * \date 16 avril 2020
+ */
+
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+#include "IndexNoms.h"
+#include "Joueur.h"
+#include "Date.h"
+
+/**
+ * \class IndexNomsBase
+ * \brief Fixture pour la création d'un index à blocs de deux entrées contenant huit joueurs,
+ * 		  dont des noms accentués et trois noms qui partagent leurs quinze premières lettres
+ */
+class IndexNomsBase : public ::testing::Test
+{
+public:
+	IndexNomsBase():f_index(2),
+			f_vJoueurs({ hockey::Joueur("Tremblay", "Alex", util::Date(3, 3, 2004), "418 555-1234", "gardien"),
+						 hockey::Joueur("Trudel", "Anne", util::Date(20, 6, 2004), "450 555-3456", "centre"),
+						 hockey::Joueur("Gagn\xC3\xA9", "Luc", util::Date(10, 10, 2003), "581 555-2345", "gardien"),
+						 hockey::Joueur("Gagnon", "Marc", util::Date(1, 1, 2005), "418 555-4567", "ailier"),
+						 hockey::Joueur("Roy", "\xC3\x89ric", util::Date(1, 5, 2003), "819 555-7890", "ailier"),
+						 hockey::Joueur("Vaillancourtmar", "Trevor", util::Date(2, 2, 2004), "418 555-0000", "centre"),
+						 hockey::Joueur("Vaillancourtmartin", "Zoe", util::Date(5, 5, 2004), "418 555-1111", "centre"),
+						 hockey::Joueur("Vaillancourtmarchand", "Ines", util::Date(6, 6, 2004), "418 555-2222", "ailier") })
+	{
+		for (const hockey::Joueur& joueur : f_vJoueurs)
+		{
+			f_index.ajouter(&joueur);
+		}
+	}
+
+	/**
+	 * \brief Retourne les indices, dans f_vJoueurs, des membres trouvés par IndexNoms::trouver()
+	 */
+	std::vector<int> trouver(const std::string& p_prefixe, unsigned int p_nbResultats = 10) const
+	{
+		std::vector<int> vIndices;
+		for (const hockey::Personne* membre : f_index.trouver(p_prefixe, p_nbResultats))
+		{
+			vIndices.push_back(static_cast<int>(static_cast<const hockey::Joueur*>(membre) - f_vJoueurs.data()));
+		}
+		return vIndices;
+	}
+
+	hockey::IndexNoms f_index;
+	std::vector<hockey::Joueur> f_vJoueurs;
+};
+
+/**
+ * \brief Test des méthodes ajouter(), trouver() et parcourir()
+ * cas valide : <br>
+ * 	ajouterBlocs :	Deux entrées par membre, réparties en plusieurs blocs
+ * 	trouverOrdonne : Ordre alphabétique, noms qui ne diffèrent qu'après la quinzième lettre
+ * 	trouverSansAccent : La casse et les accents du préfixe et des noms sont ignorés
+ * 	trouverNomEtPrenom : Un membre trouvé par son nom et son prénom n'est retourné qu'une fois
+ * 	trouverLimite : Seuls les premiers membres sont retournés, préfixe vide
+ * 	parcourirArret : Le parcours s'arrête dès que la fonction retourne faux
+ * <br>
+ * cas invalide : <br>
+ * 	trouverAucun : Préfixe qui ne correspond à aucun nom, préfixe plus long qu'un nom
+ * 	trouverInvalide : Aucun résultat demandé
+ * 	constructeurInvalide : Blocs d'une seule entrée
+ */
+TEST_F(IndexNomsBase, ajouterBlocs)
+{
+	ASSERT_EQ(8u, f_index.reqNbMembres());
+	ASSERT_GE(f_index.reqNbBlocs(), 8u);
+}
+
+TEST_F(IndexNomsBase, trouverOrdonne)
+{
+	ASSERT_EQ(std::vector<int>({ 5, 7, 6 }), trouver("vaillancourtma"));
+	ASSERT_EQ(std::vector<int>({ 5, 7, 6 }), trouver("VAILLANCOURTMAR"));
+	ASSERT_EQ(std::vector<int>({ 7 }), trouver("Vaillancourtmarc"));
+	ASSERT_EQ(std::vector<int>({ 6 }), trouver("vaillancourtmart"));
+	ASSERT_EQ(std::vector<int>({ 6 }), trouver("Vaillancourtmartin"));
+}
+
+TEST_F(IndexNomsBase, trouverSansAccent)
+{
+	ASSERT_EQ(std::vector<int>({ 2 }), trouver("gagne"));
+	ASSERT_EQ(std::vector<int>({ 2, 3 }), trouver("GAGN"));
+	ASSERT_EQ(std::vector<int>({ 2 }), trouver("Gagn\xC3\xA8"));
+	ASSERT_EQ(std::vector<int>({ 4 }), trouver("eri"));
+	ASSERT_EQ(std::vector<int>({ 4 }), trouver("\xC3\x89r"));
+}
+
+TEST_F(IndexNomsBase, trouverNomEtPrenom)
+{
+	ASSERT_EQ(std::vector<int>({ 0, 5, 1 }), trouver("tr"));
+	ASSERT_EQ(std::vector<int>({ 5 }), trouver("trev"));
+	ASSERT_EQ(std::vector<int>({ 0, 1 }), trouver("a"));
+}
+
+TEST_F(IndexNomsBase, trouverLimite)
+{
+	ASSERT_EQ(std::vector<int>({ 0, 5 }), trouver("tr", 2));
+	ASSERT_EQ(std::vector<int>({ 0, 1, 4 }), trouver("", 3));
+}
+
+TEST_F(IndexNomsBase, parcourirArret)
+{
+	int nbAppels = 0;
+	f_index.parcourir("", [&nbAppels](const hockey::Personne*, bool)
+	{
+		nbAppels++;
+		return nbAppels < 3;
+	});
+	ASSERT_EQ(3, nbAppels);
+}
+
+TEST_F(IndexNomsBase, trouverAucun)
+{
+	ASSERT_TRUE(trouver("x").empty());
+	ASSERT_TRUE(trouver("Royer").empty());
+	ASSERT_TRUE(trouver("Tremblayette").empty());
+	ASSERT_TRUE(trouver("Vaillancourtmartine").empty());
+	ASSERT_TRUE(trouver("Vaillancourtmarz").empty());
+}
+
+TEST_F(IndexNomsBase, trouverInvalide)
+{
+	ASSERT_THROW(f_index.trouver("tr", 0), PreconditionException);
+}
+
+TEST(IndexNoms, constructeurInvalide)
+{
+	ASSERT_THROW(hockey::IndexNoms index(1), PreconditionException);
+}
+
+/**
+ * \brief Test de la méthode bool retirer(const Personne* p_membre)
+ * cas valide : <br>
+ * 	retirerValide :	Le nom et le prénom du membre retiré quittent l'index, les autres membres restent
+ * 	retirerTous : L'index vidé n'a plus de bloc et accepte de nouveaux membres
+ * <br>
+ * cas invalide : <br>
+ * 	retirerAbsent : Un membre qui n'est pas indexé n'est pas retiré, même si un membre identique l'est
+ */
+TEST_F(IndexNomsBase, retirerValide)
+{
+	ASSERT_TRUE(f_index.retirer(&f_vJoueurs[0]));
+	ASSERT_TRUE(f_index.retirer(&f_vJoueurs[7]));
+	ASSERT_EQ(6u, f_index.reqNbMembres());
+	ASSERT_EQ(std::vector<int>({ 5, 1 }), trouver("tr"));
+	ASSERT_EQ(std::vector<int>({ 5, 6 }), trouver("vaillancourtmar"));
+	ASSERT_TRUE(trouver("alex").empty());
+	ASSERT_TRUE(trouver("ines").empty());
+	ASSERT_FALSE(f_index.retirer(&f_vJoueurs[0]));
+}
+
+TEST_F(IndexNomsBase, retirerTous)
+{
+	for (const hockey::Joueur& joueur : f_vJoueurs)
+	{
+		ASSERT_TRUE(f_index.retirer(&joueur));
+	}
+	ASSERT_EQ(0u, f_index.reqNbMembres());
+	ASSERT_EQ(0u, f_index.reqNbBlocs());
+
+	f_index.ajouter(&f_vJoueurs[2]);
+	ASSERT_EQ(std::vector<int>({ 2 }), trouver(""));
+}
+
+TEST_F(IndexNomsBase, retirerAbsent)
+{
+	hockey::Joueur absent("Gagnon", "Marc", util::Date(1, 1, 2005), "418 555-4567", "ailier");
+	ASSERT_FALSE(f_index.retirer(&absent));
+	ASSERT_EQ(8u, f_index.reqNbMembres());
+}
+
+/**
+ * \brief Test des méthodes void construire(const std::vector<const Personne*>& p_vMembres) et
+ * 		  void copier(const IndexNoms& p_index, Correspondance p_correspondance)
+ * cas valide : <br>
+ * 	construireOrdonne :	Mêmes résultats que les ajouts un à un, y compris pour les noms qui ne
+ * 						diffèrent qu'après la quinzième lettre, puis ajouts et retraits
+ * 	construireRemplace : Le contenu précédent de l'index est remplacé, un vector vide le vide
+ * 	copierCorrespondance : Chaque membre copié est remplacé par son correspondant, l'index d'origine est intact
+ * <br>
+ * cas invalide : <br>
+ * 	Aucun d'identifié
+ */
+TEST_F(IndexNomsBase, construireOrdonne)
+{
+	std::vector<const hockey::Personne*> vMembres;
+	for (auto it = f_vJoueurs.rbegin(); it != f_vJoueurs.rend(); ++it)
+	{
+		vMembres.push_back(&*it);
+	}
+	hockey::IndexNoms ajoute(f_index);
+	f_index.construire(vMembres);
+	ASSERT_EQ(8u, f_index.reqNbMembres());
+	ASSERT_EQ(8u, f_index.reqNbBlocs());
+
+	for (const char* prefixe : { "", "tr", "gagn", "vaillancourtma", "Vaillancourtmarc", "Vaillancourtmartin", "\xC3\x89r" })
+	{
+		ASSERT_EQ(ajoute.trouver(prefixe, 10), f_index.trouver(prefixe, 10)) << prefixe;
+	}
+
+	ASSERT_TRUE(f_index.retirer(&f_vJoueurs[7]));
+	f_index.ajouter(&f_vJoueurs[7]);
+	ASSERT_EQ(std::vector<int>({ 5, 7, 6 }), trouver("vaillancourtma"));
+}
+
+TEST_F(IndexNomsBase, construireRemplace)
+{
+	f_index.construire(std::vector<const hockey::Personne*>({ &f_vJoueurs[2] }));
+	ASSERT_EQ(1u, f_index.reqNbMembres());
+	ASSERT_EQ(std::vector<int>({ 2 }), trouver(""));
+
+	f_index.construire(std::vector<const hockey::Personne*>());
+	ASSERT_EQ(0u, f_index.reqNbMembres());
+	ASSERT_EQ(0u, f_index.reqNbBlocs());
+	ASSERT_TRUE(trouver("").empty());
+}
+
+TEST_F(IndexNomsBase, copierCorrespondance)
+{
+	std::vector<hockey::Joueur> vCopies(f_vJoueurs);
+	hockey::IndexNoms copie;
+	copie.copier(f_index, [this, &vCopies](const hockey::Personne* p_membre)
+	{
+		return &vCopies[static_cast<const hockey::Joueur*>(p_membre) - f_vJoueurs.data()];
+	});
+	ASSERT_EQ(f_index.reqNbMembres(), copie.reqNbMembres());
+	ASSERT_EQ(f_index.reqNbBlocs(), copie.reqNbBlocs());
+
+	std::vector<const hockey::Personne*> vOriginaux = f_index.trouver("", 10);
+	std::vector<const hockey::Personne*> vTrouves = copie.trouver("", 10);
+	ASSERT_EQ(vOriginaux.size(), vTrouves.size());
+	for (std::size_t i = 0; i < vTrouves.size(); i++)
+	{
+		ASSERT_EQ(&vCopies[static_cast<const hockey::Joueur*>(vOriginaux[i]) - f_vJoueurs.data()], vTrouves[i]);
+	}
+
+	ASSERT_TRUE(copie.retirer(&vCopies[0]));
+	ASSERT_FALSE(copie.retirer(&f_vJoueurs[1]));
+	ASSERT_EQ(8u, f_index.reqNbMembres());
+	ASSERT_EQ(std::vector<int>({ 0, 5, 1 }), trouver("tr"));
+}
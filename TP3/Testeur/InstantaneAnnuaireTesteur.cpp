@@ -0,0 +1,160 @@
+/**
+ * \file InstantaneAnnuaireTesteur.cpp
+ * \brief  Fichier de tests unitaires pour la classe VueInstantane et le format des instantanés
+ * \author David J Ross
+ * \version 1
+ * \date 16 avril 2020
+ */
+
+#include <gtest/gtest.h>
+#include <sstream>
+#include <cstring>
+#include <vector>
+#include "InstantaneAnnuaire.h"
+#include "Annuaire.h"
+#include "Joueur.h"
+#include "Entraineur.h"
+
+/**
+ * \class InstantaneMembres
+ * \brief Fixture qui place en mémoire l'instantané d'un annuaire de trois membres,
+ * 		  dans un tampon aligné sur 8 octets
+ */
+class InstantaneMembres : public ::testing::Test
+{
+public:
+	InstantaneMembres():f_annuaire("Test")
+	{
+		f_annuaire.ajouterPersonne(hockey::Joueur("Tremblay", "Luc", util::Date(25, 8, 2004), "581 337-2278", "centre"));
+		f_annuaire.ajouterPersonne(hockey::Entraineur("Jalbert", "David", util::Date(25, 8, 1999), "418 498-4193",
+													  "JALD 9908 2511", 'M'));
+		f_annuaire.ajouterPersonne(hockey::Joueur("Nom", "Prenom", util::Date(25, 8, 2004), "418 498-4193", "ailier"));
+
+		std::ostringstream os;
+		f_annuaire.sauvegarder(os);
+		f_texte = os.str();
+		copierTampon();
+	}
+
+	void copierTampon()
+	{
+		f_tampon.assign((f_texte.length() + 7) / 8, 0);
+		std::memcpy(f_tampon.data(), f_texte.data(), f_texte.length());
+	}
+
+	const char* donnees() const
+	{
+		return reinterpret_cast<const char*>(f_tampon.data());
+	}
+
+	hockey::EnteteInstantane& entete()
+	{
+		return *reinterpret_cast<hockey::EnteteInstantane*>(f_tampon.data());
+	}
+
+	hockey::Annuaire f_annuaire;
+	std::string f_texte;
+	std::vector<std::uint64_t> f_tampon;
+};
+
+/**
+ * \brief Test de la méthode bool VueInstantane::ouvrir(const char* p_donnees, std::size_t p_taille)
+ * cas valide : <br>
+ * 	ouvrirValide :	Les membres, les chaînes et le nom du club se lisent dans l'instantané
+ * 	PermutationsTriees : Les permutations sont triées par téléphone, par identité et par numéro de RAMQ
+ * <br>
+ * cas invalide : <br>
+ * 	ouvrirSignatureInvalide : Signature ou version inconnue
+ * 	ouvrirTronque :	Instantané incomplet
+ * 	ouvrirIdentifiantHorsLimites : Identifiant de chaîne qui dépasse la table des chaînes
+ * 	ouvrirOrdreRAMQInvalide : Ordre par numéro de RAMQ qui désigne un joueur, trop d'entraineurs
+ */
+TEST_F(InstantaneMembres, ouvrirValide)
+{
+	hockey::VueInstantane vue;
+	ASSERT_TRUE(vue.ouvrir(donnees(), f_texte.length()));
+	ASSERT_EQ(3u, vue.reqNbMembres());
+	ASSERT_EQ("Test", vue.reqNomClub().reqTexte());
+
+	const hockey::MembreInstantane& entraineur = vue.reqMembre(1);
+	ASSERT_EQ(hockey::ROLE_INSTANTANE_ENTRAINEUR, entraineur.m_role);
+	ASSERT_EQ('M', entraineur.m_sexe);
+	ASSERT_EQ("Jalbert", vue.reqChaine(entraineur.m_idNom).reqTexte());
+	ASSERT_EQ("JALD 9908 2511", vue.reqChaine(entraineur.m_idSpecifique).reqTexte());
+	ASSERT_EQ(4184984193ULL, entraineur.m_telephone);
+	ASSERT_EQ(util::Date(25, 8, 1999).reqJoursEpoque(), entraineur.m_joursNaissance);
+}
+
+TEST_F(InstantaneMembres, PermutationsTriees)
+{
+	hockey::VueInstantane vue;
+	ASSERT_TRUE(vue.ouvrir(donnees(), f_texte.length()));
+
+	// La table des chaînes est triée : « Jalbert » < « Nom » < « Tremblay »
+	ASSERT_EQ(1u, vue.reqOrdreIdentite()[0]);
+	ASSERT_EQ(2u, vue.reqOrdreIdentite()[1]);
+	ASSERT_EQ(0u, vue.reqOrdreIdentite()[2]);
+	for (unsigned int i = 1; i < vue.reqNbChaines(); i++)
+	{
+		ASSERT_LT(vue.reqChaine(i - 1).reqTexte(), vue.reqChaine(i).reqTexte());
+	}
+
+	ASSERT_EQ(1u, vue.reqOrdreTelephone()[0]);
+	ASSERT_EQ(2u, vue.reqOrdreTelephone()[1]);
+	ASSERT_EQ(0u, vue.reqOrdreTelephone()[2]);
+
+	ASSERT_EQ(1u, vue.reqNbEntraineurs());
+	ASSERT_EQ(1u, vue.reqOrdreRAMQ()[0]);
+}
+
+TEST_F(InstantaneMembres, ouvrirSignatureInvalide)
+{
+	hockey::VueInstantane vue;
+	entete().m_signature[0] = 'X';
+	ASSERT_FALSE(vue.ouvrir(donnees(), f_texte.length()));
+	ASSERT_FALSE(vue.estOuverte());
+
+	copierTampon();
+	entete().m_version = hockey::VERSION_INSTANTANE + 1;
+	ASSERT_FALSE(vue.ouvrir(donnees(), f_texte.length()));
+
+	copierTampon();
+	entete().m_marqueOctets = 0x04030201;
+	ASSERT_FALSE(vue.ouvrir(donnees(), f_texte.length()));
+}
+
+TEST_F(InstantaneMembres, ouvrirTronque)
+{
+	hockey::VueInstantane vue;
+	ASSERT_FALSE(vue.ouvrir(donnees(), f_texte.length() - 1));
+	ASSERT_FALSE(vue.ouvrir(donnees(), sizeof(hockey::EnteteInstantane) - 1));
+
+	entete().m_tailleFichier = 1 << 20;
+	ASSERT_FALSE(vue.ouvrir(donnees(), f_texte.length()));
+}
+
+TEST_F(InstantaneMembres, ouvrirIdentifiantHorsLimites)
+{
+	hockey::VueInstantane vue;
+	hockey::MembreInstantane* membres = reinterpret_cast<hockey::MembreInstantane*>(
+			reinterpret_cast<char*>(f_tampon.data()) + entete().m_decalageMembres);
+	membres[2].m_idPrenom = entete().m_nbChaines;
+	ASSERT_FALSE(vue.ouvrir(donnees(), f_texte.length()));
+
+	copierTampon();
+	membres[0].m_role = 7;
+	ASSERT_FALSE(vue.ouvrir(donnees(), f_texte.length()));
+}
+
+TEST_F(InstantaneMembres, ouvrirOrdreRAMQInvalide)
+{
+	hockey::VueInstantane vue;
+	std::uint32_t* ordreRAMQ = reinterpret_cast<std::uint32_t*>(
+			reinterpret_cast<char*>(f_tampon.data()) + entete().m_decalageOrdreRAMQ);
+	ordreRAMQ[0] = 0;
+	ASSERT_FALSE(vue.ouvrir(donnees(), f_texte.length()));
+
+	copierTampon();
+	entete().m_nbEntraineurs = 4;
+	ASSERT_FALSE(vue.ouvrir(donnees(), f_texte.length()));
+}
@@ -7,6 +7,8 @@
  */
 
 #include <gtest/gtest.h>
+#include <type_traits>
+#include <utility>
 #include "Joueur.h"
 #include "Date.h"
 #include "validationFormat.h"
@@ -41,7 +43,7 @@ TEST(JoueurConstructeur, JoueurPositionInvalide)
 }
 
 /**
- * \brief Test de la méthode const std::string reqPosition() const
+ * \brief Test de la méthode const std::string& reqPosition() const
  * cas valide : <br>
  * 	reqPositionValide :	Joueur avec des infos valides
  * <br>
@@ -55,3 +57,115 @@ TEST(JoueurBase, reqPositionValide)
 	hockey::Joueur j("Nom", "Prenom", d, "418 498-4193", "centre");
 	ASSERT_EQ("centre", j.reqPosition());
 }
+
+/**
+ * \brief Test du constructeur et de l'assignation par déplacement
+ * cas valide : <br>
+ * 	DeplacementValide :	Le joueur déplacé conserve toutes ses informations
+ * 	ConstructeurCedeChaines : Les chaînes cédées avec std::move() ne sont pas copiées
+ * <br>
+ * cas invalide : <br>
+ * 	Aucun d'identifié
+ */
+TEST(JoueurDeplacement, DeplacementValide)
+{
+	hockey::Joueur j("Nom", "Prenom", util::Date(25, 8, 2004), "418 498-4193", "centre");
+	hockey::Joueur deplace(std::move(j));
+	ASSERT_EQ("Nom", deplace.reqNom());
+	ASSERT_EQ("centre", deplace.reqPosition());
+
+	hockey::Joueur autre("Autre", "Prenom", util::Date(25, 8, 2004), "581 337-2278", "ailier");
+	autre = std::move(deplace);
+	ASSERT_EQ("Nom", autre.reqNom());
+	ASSERT_EQ("418 498-4193", autre.reqTelephone());
+	ASSERT_EQ("centre", autre.reqPosition());
+	ASSERT_TRUE(std::is_nothrow_move_constructible<hockey::Joueur>::value);
+}
+
+TEST(JoueurDeplacement, ConstructeurCedeChaines)
+{
+	// Un nom assez long pour ne pas tenir dans l'espace interne d'un std::string
+	std::string nom(40, 'a');
+	const char* tamponNom = nom.data();
+	hockey::Joueur j(std::move(nom), "Prenom", util::Date(25, 8, 2004), "418 498-4193", "centre");
+	ASSERT_EQ(tamponNom, j.reqNom().data());
+}
+
+/**
+ * \brief Test de la fabrique static Resultat<Joueur> creer(std::string p_nom, std::string p_prenom, const util::Date& p_dateNaissance,
+			   std::string p_telephone, std::string p_position)
+ * cas valide : <br>
+ * 	CreerValide :	Le résultat contient le joueur construit
+ * 	CopieResultat : Un résultat copié ou assigné contient sa propre copie du joueur
+ * 	DeplacementResultat : Le déplacement d'un résultat ne lève pas d'exception et remplace la valeur ou l'erreur
+ * <br>
+ * cas invalide : <br>
+ * 	CreerInvalide : Chaque donnée invalide donne son code d'erreur, sans lancer d'exception
+ * 	ResultatErreur : La valeur d'un résultat en erreur ne peut pas être lue, un résultat en erreur doit avoir une erreur
+ */
+TEST(JoueurCreer, CreerValide)
+{
+	hockey::Resultat<hockey::Joueur> resultat = hockey::Joueur::creer("Nom", "Prenom", util::Date(25, 8, 2004), "418 498-4193", "centre");
+	ASSERT_TRUE(resultat.estValide());
+	ASSERT_EQ(hockey::CodeErreur::Aucune, resultat.reqErreur());
+	ASSERT_EQ("Nom", resultat.reqValeur().reqNom());
+	ASSERT_EQ("Prenom", resultat.reqValeur().reqPrenom());
+	ASSERT_EQ("418 498-4193", resultat.reqValeur().reqTelephone());
+	ASSERT_EQ("centre", resultat.reqValeur().reqPosition());
+	ASSERT_TRUE(resultat.reqValeur() == hockey::Joueur("Nom", "Prenom", util::Date(25, 8, 2004), "418 498-4193", "centre"));
+}
+
+TEST(JoueurCreer, CopieResultat)
+{
+	hockey::Resultat<hockey::Joueur> resultat = hockey::Joueur::creer("Nom", "Prenom", util::Date(25, 8, 2004), "418 498-4193", "centre");
+	hockey::Resultat<hockey::Joueur> copie(resultat);
+	resultat.reqValeur().asgTelephone("581 337-2278");
+	ASSERT_EQ("418 498-4193", copie.reqValeur().reqTelephone());
+
+	hockey::Resultat<hockey::Joueur> erreur(hockey::CodeErreur::AgeInvalide);
+	erreur = copie;
+	ASSERT_TRUE(erreur.estValide());
+	ASSERT_EQ("418 498-4193", erreur.reqValeur().reqTelephone());
+
+	copie = hockey::Resultat<hockey::Joueur>(hockey::CodeErreur::NomInvalide);
+	ASSERT_FALSE(copie.estValide());
+	ASSERT_EQ(hockey::CodeErreur::NomInvalide, copie.reqErreur());
+}
+
+TEST(JoueurCreer, DeplacementResultat)
+{
+	ASSERT_TRUE(std::is_nothrow_move_constructible<hockey::Resultat<hockey::Joueur>>::value);
+	ASSERT_TRUE(std::is_nothrow_move_assignable<hockey::Resultat<hockey::Joueur>>::value);
+
+	hockey::Resultat<hockey::Joueur> resultat = hockey::Joueur::creer("Nom", "Prenom", util::Date(25, 8, 2004), "418 498-4193", "centre");
+	resultat = hockey::Joueur::creer("Autre", "Prenom", util::Date(25, 8, 2004), "581 337-2278", "ailier");
+	ASSERT_TRUE(resultat.estValide());
+	ASSERT_EQ("Autre", resultat.reqValeur().reqNom());
+
+	hockey::Resultat<hockey::Joueur> deplace(std::move(resultat));
+	ASSERT_EQ("ailier", deplace.reqValeur().reqPosition());
+
+	deplace = hockey::Resultat<hockey::Joueur>(hockey::CodeErreur::TelephoneInvalide);
+	ASSERT_EQ(hockey::CodeErreur::TelephoneInvalide, deplace.reqErreur());
+}
+
+TEST(JoueurCreer, CreerInvalide)
+{
+	util::Date d(25, 8, 2004);
+	ASSERT_EQ(hockey::CodeErreur::NomInvalide, hockey::Joueur::creer("N0m", "Prenom", d, "418 498-4193", "centre").reqErreur());
+	ASSERT_EQ(hockey::CodeErreur::PrenomInvalide, hockey::Joueur::creer("Nom", "", d, "418 498-4193", "centre").reqErreur());
+	ASSERT_EQ(hockey::CodeErreur::TelephoneInvalide, hockey::Joueur::creer("Nom", "Prenom", d, "418 4984193", "centre").reqErreur());
+	ASSERT_EQ(hockey::CodeErreur::PositionInvalide, hockey::Joueur::creer("Nom", "Prenom", d, "418 498-4193", "wrabla").reqErreur());
+	ASSERT_EQ(hockey::CodeErreur::AgeInvalide, hockey::Joueur::creer("Nom", "Prenom", util::Date(25, 8, 2001), "418 498-4193",
+																	  "centre").reqErreur());
+	// La première donnée invalide, dans l'ordre des préconditions, détermine l'erreur
+	ASSERT_EQ(hockey::CodeErreur::NomInvalide, hockey::Joueur::creer("", "", util::Date(25, 8, 2001), "", "wrabla").reqErreur());
+}
+
+TEST(JoueurCreer, ResultatErreur)
+{
+	hockey::Resultat<hockey::Joueur> resultat = hockey::Joueur::creer("Nom", "Prenom", util::Date(25, 8, 2004), "418 498-4193", "wrabla");
+	ASSERT_FALSE(resultat.estValide());
+	ASSERT_THROW(resultat.reqValeur(), PreconditionException);
+	ASSERT_THROW(hockey::Resultat<hockey::Joueur> r(hockey::CodeErreur::Aucune), PreconditionException);
+}
@@ -0,0 +1,180 @@
+/**
+ * \file RequeteAnnuaireTesteur.cpp
+ * \brief  Fichier de tests unitaires pour la classe RequeteAnnuaire et son exécution par Annuaire
+ * \author David J Ross
+ * \version 1
+ * \date 16 avril 2020
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <sstream>
+#include <vector>
+#include "RequeteAnnuaire.h"
+#include "Annuaire.h"
+#include "Joueur.h"
+#include "Entraineur.h"
+#include "Date.h"
+
+/**
+ * \class RequeteBase
+ * \brief Fixture pour la création d'un annuaire de quatre joueurs et deux entraineurs
+ */
+class RequeteBase : public ::testing::Test
+{
+public:
+	RequeteBase():f_annuaire("Test")
+	{
+		f_annuaire.ajouterPersonne(hockey::Joueur("Tremblay", "Alex", util::Date(3, 3, 2004), "418 555-1234", "gardien"));
+		f_annuaire.ajouterPersonne(hockey::Joueur("Gagnon", "Luc", util::Date(10, 10, 2003), "581 555-2345", "gardien"));
+		f_annuaire.ajouterPersonne(hockey::Joueur("Trudel", "Anne", util::Date(20, 6, 2004), "450 555-3456", "centre"));
+		f_annuaire.ajouterPersonne(hockey::Joueur("Roy", "Marc", util::Date(1, 1, 2005), "418 555-4567", "ailier"));
+		f_annuaire.ajouterPersonne(hockey::Entraineur("Tremblay", "Marie", util::Date(5, 2, 1985), "418 555-5678", "TREM 8552 0512", 'F'));
+		f_annuaire.ajouterPersonne(hockey::Entraineur("Bouchard", "Paul", util::Date(12, 11, 1979), "819 555-6789", "BOUP 7911 1234", 'M'));
+	}
+
+	/**
+	 * \brief Retourne les prénoms des membres retenus par une requête, dans l'ordre des résultats
+	 */
+	std::vector<std::string> prenoms(const hockey::RequeteAnnuaire& p_requete) const
+	{
+		std::vector<std::string> vPrenoms;
+		for (const hockey::Personne* membre : f_annuaire.executerRequete(p_requete))
+		{
+			vPrenoms.push_back(membre->reqPrenom());
+		}
+		return vPrenoms;
+	}
+
+	hockey::Annuaire f_annuaire;
+};
+
+/**
+ * \brief Test de l'exécution d'une requête par Annuaire::executerRequete() et Annuaire::ecrireRequete()
+ * cas valide : <br>
+ * 	SansFiltre :	Une requête sans filtre retient tous les membres, sans les copier
+ * 	FiltreRolePosition : Seuls les membres du rôle ou les joueurs de la position sont retenus
+ * 	FiltreNaissance : Seuls les membres nés dans l'intervalle, bornes incluses, sont retenus, y compris après un retrait
+ * 	FiltresCombines : Un membre doit satisfaire tous les filtres (code régional et rôle)
+ * 	FiltrePrefixeNom : Le préfixe du nom est comparé sans égard à la casse ni aux accents, combiné à d'autres filtres
+ * 	TriLimite : Tri sur un champ, égalités départagées par le prénom, limite avec et sans tri
+ * 	Projection : Les champs projetés sont écrits dans l'ordre demandé, un membre par ligne
+ * <br>
+ * cas invalide : <br>
+ * 	RequeteInvalide : Position invalide, code régional qui n'est pas de trois chiffres,
+ * 					  intervalle inversé, limite nulle
+ */
+TEST_F(RequeteBase, SansFiltre)
+{
+	std::vector<const hockey::Personne*> vResultats = f_annuaire.executerRequete(hockey::RequeteAnnuaire());
+	ASSERT_EQ(6u, vResultats.size());
+	for (unsigned int i = 0; i < f_annuaire.reqNbMembres(); i++)
+	{
+		ASSERT_NE(std::find(vResultats.begin(), vResultats.end(), &f_annuaire.reqMembre(i)), vResultats.end());
+	}
+}
+
+TEST_F(RequeteBase, FiltreRolePosition)
+{
+	hockey::RequeteAnnuaire gardiens;
+	gardiens.filtrerPosition("gardien").trierPar(hockey::ChampMembre::Prenom);
+	ASSERT_EQ(std::vector<std::string>({ "Alex", "Luc" }), prenoms(gardiens));
+
+	hockey::RequeteAnnuaire entraineurs;
+	entraineurs.filtrerRole(hockey::RoleMembre::Entraineur).trierPar(hockey::ChampMembre::Prenom);
+	ASSERT_EQ(std::vector<std::string>({ "Marie", "Paul" }), prenoms(entraineurs));
+
+	hockey::RequeteAnnuaire aucun;
+	aucun.filtrerRole(hockey::RoleMembre::Entraineur).filtrerPosition("centre");
+	ASSERT_TRUE(f_annuaire.executerRequete(aucun).empty());
+}
+
+TEST_F(RequeteBase, FiltreNaissance)
+{
+	hockey::RequeteAnnuaire nes2004;
+	nes2004.filtrerNaissance(util::Date(1, 1, 2004), util::Date(31, 12, 2004)).trierPar(hockey::ChampMembre::DateNaissance);
+	ASSERT_EQ(std::vector<std::string>({ "Alex", "Anne" }), prenoms(nes2004));
+
+	hockey::RequeteAnnuaire bornes;
+	bornes.filtrerNaissance(util::Date(10, 10, 2003), util::Date(1, 1, 2005)).trierPar(hockey::ChampMembre::DateNaissance);
+	ASSERT_EQ(std::vector<std::string>({ "Luc", "Alex", "Anne", "Marc" }), prenoms(bornes));
+
+	f_annuaire.retirerPersonne(hockey::Joueur("Tremblay", "Alex", util::Date(3, 3, 2004), "418 555-1234", "gardien"));
+	ASSERT_EQ(std::vector<std::string>({ "Luc", "Anne", "Marc" }), prenoms(bornes));
+	bornes.filtrerRole(hockey::RoleMembre::Joueur).filtrerPosition("centre");
+	ASSERT_EQ(std::vector<std::string>({ "Anne" }), prenoms(bornes));
+}
+
+TEST_F(RequeteBase, FiltresCombines)
+{
+	hockey::RequeteAnnuaire requete;
+	requete.filtrerIndicatif("418").filtrerRole(hockey::RoleMembre::Entraineur);
+	ASSERT_EQ(std::vector<std::string>({ "Marie" }), prenoms(requete));
+
+	requete.filtrerRole(hockey::RoleMembre::Joueur).trierPar(hockey::ChampMembre::Nom);
+	ASSERT_EQ(std::vector<std::string>({ "Marc", "Alex" }), prenoms(requete));
+}
+
+TEST_F(RequeteBase, FiltrePrefixeNom)
+{
+	hockey::RequeteAnnuaire requete;
+	requete.filtrerPrefixeNom("tR").trierPar(hockey::ChampMembre::Prenom);
+	ASSERT_EQ(std::vector<std::string>({ "Alex", "Anne", "Marie" }), prenoms(requete));
+
+	requete.filtrerPrefixeNom("Tremblayy");
+	ASSERT_TRUE(f_annuaire.executerRequete(requete).empty());
+
+	hockey::RequeteAnnuaire accents;
+	accents.filtrerPrefixeNom("TR\xC3\x89M").filtrerRole(hockey::RoleMembre::Joueur);
+	ASSERT_EQ(std::vector<std::string>({ "Alex" }), prenoms(accents));
+	accents.filtrerNaissance(util::Date(1, 1, 2005), util::Date(31, 12, 2005));
+	ASSERT_TRUE(f_annuaire.executerRequete(accents).empty());
+}
+
+TEST_F(RequeteBase, TriLimite)
+{
+	hockey::RequeteAnnuaire parNom;
+	parNom.trierPar(hockey::ChampMembre::Nom);
+	ASSERT_EQ(std::vector<std::string>({ "Paul", "Luc", "Marc", "Alex", "Marie", "Anne" }), prenoms(parNom));
+
+	hockey::RequeteAnnuaire plusAges;
+	plusAges.trierPar(hockey::ChampMembre::DateNaissance).limiter(2);
+	ASSERT_EQ(std::vector<std::string>({ "Paul", "Marie" }), prenoms(plusAges));
+
+	hockey::RequeteAnnuaire sansTri;
+	sansTri.filtrerRole(hockey::RoleMembre::Joueur).limiter(3);
+	ASSERT_EQ(3u, f_annuaire.executerRequete(sansTri).size());
+}
+
+TEST_F(RequeteBase, Projection)
+{
+	hockey::RequeteAnnuaire entraineurs;
+	entraineurs.filtrerRole(hockey::RoleMembre::Entraineur).trierPar(hockey::ChampMembre::Nom)
+			   .projeter(hockey::ChampMembre::Nom).projeter(hockey::ChampMembre::Sexe).projeter(hockey::ChampMembre::DateNaissance);
+	std::ostringstream os;
+	f_annuaire.ecrireRequete(entraineurs, os);
+	ASSERT_EQ("Bouchard\tM\t1979-11-12\nTremblay\tF\t1985-02-05\n", os.str());
+
+	hockey::RequeteAnnuaire parDefaut;
+	parDefaut.filtrerPrefixeNom("Roy");
+	os.str("");
+	f_annuaire.ecrireRequete(parDefaut, os);
+	ASSERT_EQ("Roy\tMarc\t2005-01-01\t418 555-4567\n", os.str());
+
+	hockey::RequeteAnnuaire position;
+	position.filtrerIndicatif("819").projeter(hockey::ChampMembre::Prenom).projeter(hockey::ChampMembre::Position)
+			.projeter(hockey::ChampMembre::NumRAMQ);
+	os.str("");
+	f_annuaire.ecrireRequete(position, os);
+	ASSERT_EQ("Paul\t\tBOUP 7911 1234\n", os.str());
+}
+
+TEST_F(RequeteBase, RequeteInvalide)
+{
+	hockey::RequeteAnnuaire requete;
+	ASSERT_THROW(requete.filtrerPosition("gardienne"), PreconditionException);
+	ASSERT_THROW(requete.filtrerIndicatif("41a"), PreconditionException);
+	ASSERT_THROW(requete.filtrerIndicatif("4185"), PreconditionException);
+	ASSERT_THROW(requete.filtrerNaissance(util::Date(2, 1, 2004), util::Date(1, 1, 2004)), PreconditionException);
+	ASSERT_THROW(requete.limiter(0), PreconditionException);
+}
@@ -0,0 +1,171 @@
+/**
+ * \file SiteContratTesteur.cpp
+ * \brief  Fichier de tests unitaires pour la classe SiteContrat et le mode CONTRAT_ECHANTILLONNE
+ * \author David J Ross
+ * \version 1
+ * \date 16 avril 2020
+ */
+
+// Les macros de contrat de ce fichier sont compilées en mode échantillonné, quel que soit le mode du reste des tests
+#if !defined(CONTRAT_ECHANTILLONNE)
+#  define CONTRAT_ECHANTILLONNE
+#endif
+
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include "ContratException.h"
+#include "SiteContrat.h"
+
+/**
+ * \class PeriodeEchantillonnage
+ * \brief Fixture qui fixe la période d'échantillonnage à 4 et rétablit la période d'origine après le test
+ */
+class PeriodeEchantillonnage : public ::testing::Test
+{
+public:
+	PeriodeEchantillonnage(): f_periodeOrigine(SiteContrat::reqPeriodeEchantillonnage())
+	{
+		SiteContrat::asgPeriodeEchantillonnage(4);
+	}
+	~PeriodeEchantillonnage()
+	{
+		SiteContrat::asgPeriodeEchantillonnage(f_periodeOrigine);
+	}
+
+	unsigned int f_periodeOrigine;
+};
+
+/**
+ * \brief Fonction dont la précondition et la postcondition comptent leurs évaluations
+ */
+static void verifierContrats(bool p_precondition, bool p_postcondition, int& p_nbPreconditions, int& p_nbPostconditions)
+{
+	PRECONDITION((++p_nbPreconditions, p_precondition));
+	POSTCONDITION((++p_nbPostconditions, p_postcondition));
+}
+
+/**
+ * \brief Classe dont les invariants comptent leurs vérifications
+ */
+class InvariantsComptes
+{
+public:
+	InvariantsComptes(): m_nbVerifications(0), m_valide(true)
+	{
+	}
+	void modifier(bool p_valide)
+	{
+		m_valide = p_valide;
+		INVARIANTS();
+	}
+	int m_nbVerifications;
+
+private:
+	void verifieInvariant()
+	{
+		m_nbVerifications++;
+		INVARIANT(m_valide);
+	}
+	bool m_valide;
+};
+
+/**
+ * \brief Recherche le site de contrat d'une expression donnée
+ */
+static const SiteContrat* trouverSite(const std::string& p_expression)
+{
+	const SiteContrat* site = SiteContrat::reqPremierSite();
+	while (site != nullptr && p_expression != site->reqExpression())
+	{
+		site = site->reqSuivant();
+	}
+	return site;
+}
+
+/**
+ * \brief Test des macros de contrat en mode CONTRAT_ECHANTILLONNE
+ * cas valide : <br>
+ * 	PostconditionEchantillonnee :	Une postcondition n'est vérifiée qu'une fois sur 4, dès le premier passage
+ * 	InvariantsEchantillonnes : verifieInvariant() n'est appelée qu'une fois sur 4
+ * 	CompteursSite : Le site compte ses passages et ses vérifications et figure au rapport
+ * <br>
+ * cas invalide : <br>
+ * 	PreconditionToujoursVerifiee : Une précondition fausse lance toujours une exception, période nulle ou qui n'est pas une puissance de 2
+ * 	PostconditionFausseEchantillonnee : Une postcondition fausse ne lance une exception que lorsqu'elle est vérifiée
+ */
+TEST_F(PeriodeEchantillonnage, PostconditionEchantillonnee)
+{
+	int nbPreconditions = 0;
+	int nbPostconditions = 0;
+	for (int i = 0; i < 8; i++)
+	{
+		verifierContrats(true, true, nbPreconditions, nbPostconditions);
+	}
+	ASSERT_EQ(8, nbPreconditions);
+	ASSERT_EQ(2, nbPostconditions);
+}
+
+TEST_F(PeriodeEchantillonnage, InvariantsEchantillonnes)
+{
+	InvariantsComptes objet;
+	for (int i = 0; i < 8; i++)
+	{
+		objet.modifier(true);
+	}
+	ASSERT_EQ(2, objet.m_nbVerifications);
+}
+
+TEST_F(PeriodeEchantillonnage, CompteursSite)
+{
+	int nbPreconditions = 0;
+	int nbPostconditions = 0;
+	verifierContrats(true, true, nbPreconditions, nbPostconditions);
+
+	const SiteContrat* site = trouverSite("(++p_nbPostconditions, p_postcondition)");
+	ASSERT_TRUE(site != nullptr);
+	std::uint64_t nbPassages = site->reqNbPassages();
+	std::uint64_t nbVerifications = site->reqNbVerifications();
+	for (int i = 0; i < 8; i++)
+	{
+		verifierContrats(true, true, nbPreconditions, nbPostconditions);
+	}
+	ASSERT_EQ(nbPassages + 8, site->reqNbPassages());
+	ASSERT_EQ(nbVerifications + 2, site->reqNbVerifications());
+
+	std::ostringstream rapport;
+	SiteContrat::ecrireRapport(rapport);
+	ASSERT_NE(std::string::npos, rapport.str().find("(++p_nbPostconditions, p_postcondition)"));
+}
+
+TEST_F(PeriodeEchantillonnage, PreconditionToujoursVerifiee)
+{
+	int nbPreconditions = 0;
+	int nbPostconditions = 0;
+	for (int i = 0; i < 8; i++)
+	{
+		ASSERT_THROW(verifierContrats(false, true, nbPreconditions, nbPostconditions), PreconditionException);
+	}
+	ASSERT_THROW(SiteContrat::asgPeriodeEchantillonnage(0), PreconditionException);
+	ASSERT_THROW(SiteContrat::asgPeriodeEchantillonnage(6), PreconditionException);
+}
+
+TEST_F(PeriodeEchantillonnage, PostconditionFausseEchantillonnee)
+{
+	int nbPreconditions = 0;
+	int nbPostconditions = 0;
+	int nbExceptions = 0;
+	for (int i = 0; i < 8; i++)
+	{
+		try
+		{
+			verifierContrats(true, false, nbPreconditions, nbPostconditions);
+		}
+		catch (PostconditionException&)
+		{
+			nbExceptions++;
+		}
+	}
+	ASSERT_EQ(2, nbPostconditions);
+	ASSERT_EQ(2, nbExceptions);
+}
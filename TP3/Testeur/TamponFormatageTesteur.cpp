@@ -0,0 +1,135 @@
+/**
+ * \file TamponFormatageTesteur.cpp
+ * \brief  Fichier de tests unitaires pour la classe TamponFormatage
+ * \author David J Ross
+ * \version 1
+ * \date 16 avril 2020
+ */
+
+#include <gtest/gtest.h>
+#include <sstream>
+#include <limits>
+#include "TamponFormatage.h"
+#include "Date.h"
+#include "Joueur.h"
+#include "Entraineur.h"
+
+/**
+ * \brief Test des méthodes d'ajout de TamponFormatage
+ * cas valide : <br>
+ * 	TamponVide :	Un tampon construit par défaut est vide
+ * 	ajouterTexte :	Ajout de caractères, de chaînes et d'entiers
+ * 	ajouterEntierBornes : Entiers nuls, négatifs et extrêmes
+ * 	DepassementInterne : Le texte peut dépasser l'espace interne sans perte
+ * 	viderReutiliser : Un tampon vidé peut être réutilisé
+ * <br>
+ * cas invalide : <br>
+ * 	ajouterEntierDeuxChiffresInvalide : Entier hors de l'intervalle 0 à 99
+ */
+TEST(TamponFormatage, TamponVide)
+{
+	util::TamponFormatage t;
+	ASSERT_EQ(0u, t.reqLongueur());
+	ASSERT_EQ("", t.reqTexte());
+}
+
+TEST(TamponFormatage, ajouterTexte)
+{
+	util::TamponFormatage t;
+	t.ajouter("le ", 3);
+	t.ajouterEntierDeuxChiffres(5);
+	t.ajouter(' ');
+	t.ajouter(std::string("mai"));
+	t.ajouter(' ');
+	t.ajouterEntier(1979);
+	ASSERT_EQ("le 05 mai 1979", t.reqTexte());
+}
+
+TEST(TamponFormatage, ajouterEntierBornes)
+{
+	util::TamponFormatage t;
+	t.ajouterEntier(0);
+	t.ajouter(' ');
+	t.ajouterEntier(-42);
+	t.ajouter(' ');
+	t.ajouterEntier(std::numeric_limits<long>::min());
+	std::ostringstream os;
+	os << "0 -42 " << std::numeric_limits<long>::min();
+	ASSERT_EQ(os.str(), t.reqTexte());
+}
+
+TEST(TamponFormatage, DepassementInterne)
+{
+	util::TamponFormatage t;
+	std::string attendu;
+	for (int i = 0; i < 1000; i++)
+	{
+		t.ajouterEntier(i);
+		t.ajouter(',');
+		attendu += std::to_string(i) + ',';
+	}
+	ASSERT_EQ(attendu.length(), t.reqLongueur());
+	ASSERT_EQ(attendu, t.reqTexte());
+}
+
+TEST(TamponFormatage, viderReutiliser)
+{
+	util::TamponFormatage t;
+	t.ajouter(std::string(1000, 'x'));
+	t.vider();
+	ASSERT_EQ(0u, t.reqLongueur());
+	t.ajouter("abc", 3);
+	std::ostringstream os;
+	t.ecrire(os);
+	ASSERT_EQ("abc", os.str());
+}
+
+TEST(TamponFormatage, ajouterEntierDeuxChiffresInvalide)
+{
+	util::TamponFormatage t;
+	ASSERT_THROW(t.ajouterEntierDeuxChiffres(100), PreconditionException);
+	ASSERT_THROW(t.ajouterEntierDeuxChiffres(-1), PreconditionException);
+}
+
+/**
+ * \brief Test du formatage des dates et des membres dans un tampon
+ * cas valide : <br>
+ * 	formaterDateIdentique : Même texte que reqDateFormatee() pour chaque jour de 1970 à 2037
+ * 	formaterPersonneCumulatif : Plusieurs membres formatés à la suite dans un même tampon
+ * <br>
+ * cas invalide : <br>
+ * 	Aucun d'identifié
+ */
+TEST(TamponFormatage, formaterDateIdentique)
+{
+	util::TamponFormatage t;
+	for (long jours = 0; jours <= 24836; jours++)
+	{
+		util::Date d = util::Date::dateDepuisJoursEpoque(jours);
+		t.vider();
+		d.formaterDate(t);
+		ASSERT_EQ(d.reqDateFormatee(), t.reqTexte());
+	}
+}
+
+TEST(TamponFormatage, formaterPersonneCumulatif)
+{
+	hockey::Joueur j("Nom", "Prenom", util::Date(25, 8, 2004), "418 498-4193", "centre");
+	hockey::Entraineur e("Jalbert", "David", util::Date(5, 1, 1999), "418 498-4193", "JALD 9901 0511", 'M');
+	util::TamponFormatage t;
+	j.formaterPersonne(t);
+	e.formaterPersonne(t);
+	ASSERT_EQ("Nom               : Nom\n"
+			  "Prenom            : Prenom\n"
+			  "Date de naissance : Mercredi le 25 aout 2004\n"
+			  "Telephone         : 418 498-4193\n"
+			  "Position          : centre\n"
+			  "---------------------\n"
+			  "Nom               : Jalbert\n"
+			  "Prenom            : David\n"
+			  "Date de naissance : Mardi le 05 janvier 1999\n"
+			  "Telephone         : 418 498-4193\n"
+			  "Numero de RAMQ    : JALD 9901 0511\n"
+			  "---------------------\n", t.reqTexte());
+	ASSERT_EQ(j.reqPersonneFormate() + e.reqPersonneFormate(), t.reqTexte());
+}
@@ -0,0 +1,106 @@
+/**
+ * \file TriParBaseTesteur.cpp
+ * \brief  Fichier de tests unitaires pour le tri par base
+ * \author David J Ross
+ * \version 1
+ * \date 16 avril 2020
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "TriParBase.h"
+
+/**
+ * \brief Test de la fonction unsigned int nbBits(std::uint64_t p_valeur)
+ * cas valide : <br>
+ * 	nbBitsValide : 0, 1, puissances de 2 et plus grande valeur
+ * <br>
+ * cas invalide : <br>
+ * 	aucun
+ */
+TEST(TriParBase, nbBitsValide)
+{
+	ASSERT_EQ(0u, util::nbBits(0));
+	ASSERT_EQ(1u, util::nbBits(1));
+	ASSERT_EQ(11u, util::nbBits(2047));
+	ASSERT_EQ(12u, util::nbBits(2048));
+	ASSERT_EQ(64u, util::nbBits(UINT64_MAX));
+}
+
+/**
+ * \brief Test de la fonction void trierParBase(std::vector<T>& p_vValeurs, unsigned int p_nbBits, Cle p_cle)
+ * cas valide : <br>
+ * 	trierValide : Même ordre que std::stable_sort sur des clés de 64 bits
+ * 	trierStable : Les valeurs de même clé gardent leur ordre, deux tris successifs ordonnent selon les deux clés
+ * 	trierChiffreCommun : Des clés qui ne diffèrent que par un chiffre sont triées
+ * 	trierVide : Aucune valeur, aucun bit
+ * <br>
+ * cas invalide : <br>
+ * 	aucun
+ */
+TEST(TriParBase, trierValide)
+{
+	std::vector<std::uint64_t> vValeurs;
+	std::uint64_t valeur = 88172645463325252ull;
+	for (int i = 0; i < 5000; i++)
+	{
+		valeur ^= valeur << 13;
+		valeur ^= valeur >> 7;
+		valeur ^= valeur << 17;
+		vValeurs.push_back(valeur);
+	}
+	std::vector<std::uint64_t> vAttendues(vValeurs);
+	std::sort(vAttendues.begin(), vAttendues.end());
+
+	util::trierParBase(vValeurs, 64, [](std::uint64_t p_valeur) { return p_valeur; });
+	ASSERT_EQ(vAttendues, vValeurs);
+}
+
+TEST(TriParBase, trierStable)
+{
+	std::vector<std::pair<std::uint64_t, std::uint64_t>> vValeurs;
+	for (std::uint64_t i = 0; i < 3000; i++)
+	{
+		vValeurs.emplace_back((i * 7919) % 50, (i * 104729) % 3001);
+	}
+	std::vector<std::pair<std::uint64_t, std::uint64_t>> vAttendues(vValeurs);
+	std::sort(vAttendues.begin(), vAttendues.end());
+
+	util::trierParBase(vValeurs, util::nbBits(3000), [](const std::pair<std::uint64_t, std::uint64_t>& p_valeur)
+	{
+		return p_valeur.second;
+	});
+	util::trierParBase(vValeurs, util::nbBits(49), [](const std::pair<std::uint64_t, std::uint64_t>& p_valeur)
+	{
+		return p_valeur.first;
+	});
+	ASSERT_EQ(vAttendues, vValeurs);
+}
+
+TEST(TriParBase, trierChiffreCommun)
+{
+	std::vector<std::uint64_t> vValeurs;
+	for (std::uint64_t i = 0; i < 100; i++)
+	{
+		vValeurs.push_back(0xABCull << 40 | ((i * 37) % 100) << 22 | 5);
+	}
+	std::vector<std::uint64_t> vAttendues(vValeurs);
+	std::sort(vAttendues.begin(), vAttendues.end());
+
+	util::trierParBase(vValeurs, 64, [](std::uint64_t p_valeur) { return p_valeur; });
+	ASSERT_EQ(vAttendues, vValeurs);
+}
+
+TEST(TriParBase, trierVide)
+{
+	std::vector<std::uint64_t> vValeurs;
+	util::trierParBase(vValeurs, 64, [](std::uint64_t p_valeur) { return p_valeur; });
+	ASSERT_TRUE(vValeurs.empty());
+
+	vValeurs = { 3, 1, 2 };
+	util::trierParBase(vValeurs, 0, [](std::uint64_t p_valeur) { return p_valeur; });
+	ASSERT_EQ(std::vector<std::uint64_t>({ 3, 1, 2 }), vValeurs);
+}
@@ -0,0 +1,507 @@
+/**
+ * \file ValidationFormatTesteur.cpp
+ * \brief  Fichier de tests unitaires pour les méthodes de validation de format
+ * \author David J Ross
+ * \version 1
+ * \date 16 avril 2020
+ */
+
+#include <gtest/gtest.h>
+#include <string>
+#include <memory>
+#include <vector>
+#include <cstdio>
+#include <cstdint>
+#include <cctype>
+#include <algorithm>
+#include <iterator>
+#include "validationFormat.h"
+
+/**
+ * \brief Test de la méthode bool validerTelephone(const std::string& p_telephone)
+ * cas valide : <br>
+ * 	validerTelephoneValide :	Numéros au format NNN NNN-NNNN avec un code régional accepté
+ * 	validerTelephoneCodes9 : Tous les codes régionaux commençant par 9 sont acceptés
+ * 	validerTelephoneTousCodes : Exactement les codes de la table et les 100 codes en 9 sont acceptés
+ * <br>
+ * cas invalide : <br>
+ * 	validerTelephoneLongueur : Numéros vides, tronqués ou trop longs
+ * 	validerTelephoneFormat : Séparateurs absents ou déplacés, caractères qui ne sont pas des chiffres
+ * 	validerTelephoneCodeRegional : Code régional non accepté
+ * 	validerTelephoneCaractere : Chaque caractère d'un numéro valide remplacé par chacun des 256 octets
+ */
+TEST(validerTelephone, validerTelephoneValide)
+{
+	ASSERT_TRUE(util::validerTelephone("418 498-4193"));
+	ASSERT_TRUE(util::validerTelephone("581 337-2278"));
+	ASSERT_TRUE(util::validerTelephone("450 000-0000"));
+	ASSERT_TRUE(util::validerTelephone("579 999-9999"));
+	ASSERT_TRUE(util::validerTelephone("866 123-4567"));
+	ASSERT_TRUE(util::validerTelephone("877 123-4567"));
+	ASSERT_TRUE(util::validerTelephone("855 123-4567"));
+}
+
+TEST(validerTelephone, validerTelephoneCodes9)
+{
+	for (int code = 900; code <= 999; code++)
+	{
+		ASSERT_TRUE(util::validerTelephone(std::to_string(code) + " 498-4193"));
+	}
+}
+
+TEST(validerTelephone, validerTelephoneTousCodes)
+{
+	const int CODES[] = { 403, 780, 604, 236, 250, 778, 902, 204, 506, 905, 519, 289, 705, 613, 807, 416, 647,
+						  438, 514, 450, 579, 418, 581, 819, 873, 306, 709, 867, 800, 866, 877, 888, 855 };
+	int nbAcceptes = 0;
+	for (int code = 0; code < 1000; code++)
+	{
+		std::string telephone = std::to_string(code + 1000).substr(1) + " 498-4193";
+		bool attendu = code >= 900 || std::find(std::begin(CODES), std::end(CODES), code) != std::end(CODES);
+		ASSERT_EQ(attendu, util::validerTelephone(telephone)) << telephone;
+		nbAcceptes += attendu;
+	}
+	// 902 et 905 sont déjà compris dans les codes en 9
+	ASSERT_EQ(131, nbAcceptes);
+}
+
+TEST(validerTelephone, validerTelephoneLongueur)
+{
+	ASSERT_FALSE(util::validerTelephone(""));
+	ASSERT_FALSE(util::validerTelephone("57"));
+	ASSERT_FALSE(util::validerTelephone("418"));
+	ASSERT_FALSE(util::validerTelephone("418 498-419"));
+	ASSERT_FALSE(util::validerTelephone("418 498-41933"));
+	ASSERT_FALSE(util::validerTelephone(std::string("418 498-4193\0", 13)));
+}
+
+TEST(validerTelephone, validerTelephoneFormat)
+{
+	ASSERT_FALSE(util::validerTelephone("418-498-4193"));
+	ASSERT_FALSE(util::validerTelephone("418 498 4193"));
+	ASSERT_FALSE(util::validerTelephone("4184 98-4193"));
+	ASSERT_FALSE(util::validerTelephone("418 4a8-4193"));
+	ASSERT_FALSE(util::validerTelephone("418 498-419/"));
+	ASSERT_FALSE(util::validerTelephone("418 498-419:"));
+}
+
+TEST(validerTelephone, validerTelephoneCodeRegional)
+{
+	ASSERT_FALSE(util::validerTelephone("123 498-4193"));
+	ASSERT_FALSE(util::validerTelephone("000 498-4193"));
+	ASSERT_FALSE(util::validerTelephone("419 498-4193"));
+}
+
+TEST(validerTelephone, validerTelephoneCaractere)
+{
+	const std::string VALIDE = "418 498-4193";
+	for (std::size_t position = 0; position < VALIDE.length(); position++)
+	{
+		for (int octet = 0; octet < 256; octet++)
+		{
+			std::string telephone(VALIDE);
+			telephone[position] = static_cast<char>(octet);
+
+			bool attendu;
+			if (position == 3)
+			{
+				attendu = octet == ' ';
+			}
+			else if (position == 7)
+			{
+				attendu = octet == '-';
+			}
+			else if (position < 3)
+			{
+				// Seuls 416, 418, 438 et 918 sont atteignables en changeant un chiffre de 418
+				std::string code = telephone.substr(0, 3);
+				attendu = code == "416" || code == "418" || code == "438" || code == "918";
+			}
+			else
+			{
+				attendu = std::isdigit(octet) != 0;
+			}
+			ASSERT_EQ(attendu, util::validerTelephone(telephone)) << "position " << position << ", octet " << octet;
+		}
+	}
+}
+
+/**
+ * \brief Test de la méthode bool validerTelephone(const char* p_telephone, std::size_t p_longueur)
+ * cas valide : <br>
+ * 	validerTelephoneTamponExact : Numéro dans un tampon de 12 caractères exactement, sans terminaison
+ * <br>
+ * cas invalide : <br>
+ * 	validerTelephoneTamponCourt : Longueur plus courte que le format, aucun caractère n'est lu au-delà
+ */
+TEST(validerTelephoneTampon, validerTelephoneTamponExact)
+{
+	std::unique_ptr<char[]> tampon(new char[12]);
+	std::string("418 498-4193").copy(tampon.get(), 12);
+	ASSERT_TRUE(util::validerTelephone(tampon.get(), 12));
+}
+
+TEST(validerTelephoneTampon, validerTelephoneTamponCourt)
+{
+	std::unique_ptr<char[]> tampon(new char[3]);
+	std::string("418").copy(tampon.get(), 3);
+	ASSERT_FALSE(util::validerTelephone(tampon.get(), 3));
+	ASSERT_FALSE(util::validerTelephone(tampon.get(), 0));
+}
+
+/**
+ * \brief Test de la méthode std::size_t validerTelephones(const std::string* p_telephones,
+ * 		  std::size_t p_nbTelephones, bool* p_valides)
+ * cas valide : <br>
+ * 	validerTelephonesLot :	Chaque résultat du lot est celui de validerTelephone() et le nombre de valides est retourné
+ * 	validerTelephonesVide : Lot vide
+ * <br>
+ * cas invalide : <br>
+ * 	Aucun d'identifié
+ */
+TEST(validerTelephones, validerTelephonesLot)
+{
+	const std::string TELEPHONES[] = { "418 498-4193", "57", "581 337-2278", "123 498-4193", "", "999 000-0000" };
+	const std::size_t NB_TELEPHONES = sizeof(TELEPHONES) / sizeof(TELEPHONES[0]);
+	bool valides[NB_TELEPHONES];
+
+	ASSERT_EQ(3u, util::validerTelephones(TELEPHONES, NB_TELEPHONES, valides));
+	for (std::size_t i = 0; i < NB_TELEPHONES; i++)
+	{
+		ASSERT_EQ(util::validerTelephone(TELEPHONES[i]), valides[i]);
+	}
+}
+
+TEST(validerTelephones, validerTelephonesVide)
+{
+	ASSERT_EQ(0u, util::validerTelephones(nullptr, 0, nullptr));
+}
+
+/**
+ * \brief Test de la méthode bool validerNumRAMQ(const std::string& p_numero, const std::string& p_nom,
+ * 		  const std::string& p_prenom, int p_jourNaissance, int p_moisNaissance, int p_anneeNaissance, char p_sex)
+ * cas valide : <br>
+ * 	validerNumRAMQValide :	Numéros d'hommes et de femmes, mois et jours à un ou deux chiffres, casse quelconque
+ * 	validerNumRAMQAccent : Lettres d'un nom ou d'un prénom accentué, prises sans accent
+ * <br>
+ * cas invalide : <br>
+ * 	validerNumRAMQLongueur : Numéros vides, tronqués ou trop longs, aucun caractère n'est lu au-delà
+ * 	validerNumRAMQNomCourt : Nom ou prénom trop court pour former le numéro
+ * 	validerNumRAMQDate : Jour, mois ou année hors des bornes
+ * 	validerNumRAMQCaractere : Chacun des 12 premiers caractères d'un numéro valide remplacé par chacun des 256 octets
+ * 	validerNumRAMQAccentInvalide : Octets UTF-8 d'une lettre accentuée dans le numéro
+ */
+TEST(validerNumRAMQ, validerNumRAMQValide)
+{
+	ASSERT_TRUE(util::validerNumRAMQ("JALD 9908 2511", "Jalbert", "David", 25, 8, 1999, 'M'));
+	ASSERT_TRUE(util::validerNumRAMQ("jald 9958 2511", "Jalbert", "David", 25, 8, 1999, 'F'));
+	ASSERT_TRUE(util::validerNumRAMQ("JALD 9912 0111", "jalbert", "david", 1, 12, 1999, 'M'));
+	ASSERT_TRUE(util::validerNumRAMQ("JaLd 0461 3199", "Jalbert", "David", 31, 11, 2004, 'F'));
+}
+
+TEST(validerNumRAMQ, validerNumRAMQAccent)
+{
+	ASSERT_TRUE(util::validerNumRAMQ("EMOJ 8001 0112", "\xC3\x89mond", "Jean", 1, 1, 1980, 'M'));
+	ASSERT_TRUE(util::validerNumRAMQ("emoj 8001 0112", "\xC3\xA9mond", "Jean", 1, 1, 1980, 'M'));
+	ASSERT_TRUE(util::validerNumRAMQ("GAGE 8051 0112", "Gagn\xC3\xA9", "\xC3\x89lise", 1, 1, 1980, 'F'));
+	ASSERT_TRUE(util::validerNumRAMQ("OEUA 8001 0112", "\xC5\x92uvrard", "Alice", 1, 1, 1980, 'M'));
+}
+
+TEST(validerNumRAMQ, validerNumRAMQLongueur)
+{
+	ASSERT_FALSE(util::validerNumRAMQ("", "Jalbert", "David", 25, 8, 1999, 'M'));
+	ASSERT_FALSE(util::validerNumRAMQ("JA", "Jalbert", "David", 25, 8, 1999, 'M'));
+	ASSERT_FALSE(util::validerNumRAMQ("JALD 9908 251", "Jalbert", "David", 25, 8, 1999, 'M'));
+	ASSERT_FALSE(util::validerNumRAMQ("JALD 9908 25111", "Jalbert", "David", 25, 8, 1999, 'M'));
+}
+
+TEST(validerNumRAMQ, validerNumRAMQNomCourt)
+{
+	ASSERT_FALSE(util::validerNumRAMQ("JAXD 9908 2511", "Ja", "David", 25, 8, 1999, 'M'));
+	ASSERT_FALSE(util::validerNumRAMQ("JALD 9908 2511", "", "David", 25, 8, 1999, 'M'));
+	ASSERT_FALSE(util::validerNumRAMQ("JALD 9908 2511", "Jalbert", "", 25, 8, 1999, 'M'));
+}
+
+TEST(validerNumRAMQ, validerNumRAMQDate)
+{
+	ASSERT_FALSE(util::validerNumRAMQ("JALD 9900 0011", "Jalbert", "David", 0, 0, 1999, 'M'));
+	ASSERT_FALSE(util::validerNumRAMQ("JALD 9920 2511", "Jalbert", "David", 25, 20, 1999, 'M'));
+	ASSERT_FALSE(util::validerNumRAMQ("JALD 9908 4011", "Jalbert", "David", 40, 8, 1999, 'M'));
+}
+
+TEST(validerNumRAMQ, validerNumRAMQCaractere)
+{
+	const std::string VALIDE = "JALD 9908 2511";
+	for (std::size_t position = 0; position < 12; position++)
+	{
+		for (int octet = 0; octet < 256; octet++)
+		{
+			std::string numero(VALIDE);
+			numero[position] = static_cast<char>(octet);
+
+			bool attendu = numero[position] == VALIDE[position];
+			if (position < 4)
+			{
+				attendu = std::toupper(octet) == VALIDE[position];
+			}
+			ASSERT_EQ(attendu, util::validerNumRAMQ(numero, "Jalbert", "David", 25, 8, 1999, 'M'))
+					<< "position " << position << ", octet " << octet;
+		}
+	}
+	ASSERT_TRUE(util::validerNumRAMQ("JALD 9908 25??", "Jalbert", "David", 25, 8, 1999, 'M'));
+}
+
+TEST(validerNumRAMQ, validerNumRAMQAccentInvalide)
+{
+	ASSERT_FALSE(util::validerNumRAMQ("\xC3\x89MJ 8001 0112", "\xC3\x89mond", "Jean", 1, 1, 1980, 'M'));
+	ASSERT_FALSE(util::validerNumRAMQ("EMOJ 8001 0112", "Emond", "\xC3\x89lise", 1, 1, 1980, 'M'));
+}
+
+/**
+ * \brief Test de la méthode std::size_t validerNumRAMQs(const std::string* p_numeros, const std::string* p_noms,
+ * 		  const std::string* p_prenoms, const std::uint32_t* p_datesNaissance, const char* p_sexes,
+ * 		  std::size_t p_nbNumeros, bool* p_valides)
+ * cas valide : <br>
+ * 	validerNumRAMQsLot :	Chaque résultat du lot est celui de validerNumRAMQ() et le nombre de valides est retourné
+ * 	validerNumRAMQsVide : Lot vide
+ * 	validerNumRAMQsBlocs : Lot de plusieurs blocs mêlant noms ASCII, accentués et courts, dates
+ * 						   invalides et numéros de mauvaise longueur, chaque résultat étant celui de validerNumRAMQ()
+ * <br>
+ * cas invalide : <br>
+ * 	Aucun d'identifié
+ */
+TEST(validerNumRAMQs, validerNumRAMQsLot)
+{
+	const std::string NUMEROS[] = { "JALD 9908 2511", "JALD 9958 2511", "ROSD 0461 0199", "ROSD 0411 0199", "RO",
+									"EMOJ 8001 0112", "\xC3\x89MJ 8001 0112" };
+	const std::string NOMS[] = { "Jalbert", "Jalbert", "Ross", "Ross", "Ross", "\xC3\x89mond", "\xC3\x89mond" };
+	const std::string PRENOMS[] = { "David", "David", "David", "David", "David", "Jean", "Jean" };
+	const int JOURS[] = { 25, 25, 1, 1, 1, 1, 1 };
+	const int MOIS[] = { 8, 8, 11, 11, 11, 1, 1 };
+	const int ANNEES[] = { 1999, 1999, 2004, 2004, 2004, 1980, 1980 };
+	const char SEXES[] = { 'M', 'M', 'F', 'F', 'F', 'M', 'M' };
+	const std::size_t NB_NUMEROS = sizeof(NUMEROS) / sizeof(NUMEROS[0]);
+
+	std::uint32_t dates[NB_NUMEROS];
+	for (std::size_t i = 0; i < NB_NUMEROS; i++)
+	{
+		dates[i] = (ANNEES[i] << 9) | (MOIS[i] << 5) | JOURS[i];
+	}
+	bool valides[NB_NUMEROS];
+
+	ASSERT_EQ(3u, util::validerNumRAMQs(NUMEROS, NOMS, PRENOMS, dates, SEXES, NB_NUMEROS, valides));
+	ASSERT_TRUE(valides[5]);
+	for (std::size_t i = 0; i < NB_NUMEROS; i++)
+	{
+		ASSERT_EQ(util::validerNumRAMQ(NUMEROS[i], NOMS[i], PRENOMS[i], JOURS[i], MOIS[i], ANNEES[i], SEXES[i]), valides[i]);
+	}
+}
+
+TEST(validerNumRAMQs, validerNumRAMQsVide)
+{
+	ASSERT_EQ(0u, util::validerNumRAMQs(nullptr, nullptr, nullptr, nullptr, nullptr, 0, nullptr));
+}
+
+TEST(validerNumRAMQs, validerNumRAMQsBlocs)
+{
+	const std::string NOMS[] = { "Jalbert", "\xC3\x89mond", "Ja", "", "\xC5\x92uvrard", "Ross" };
+	const std::string PRENOMS[] = { "David", "Jean", "David", "Alice", "", "\xC3\x89lise" };
+	const std::string LETTRES[] = { "JALD", "EMOJ", "JA", "", "OEU", "ROSE" };
+	const std::size_t NB_NOMS = sizeof(NOMS) / sizeof(NOMS[0]);
+	const std::size_t NB_NUMEROS = 200;
+
+	std::vector<std::string> numeros, noms, prenoms;
+	std::vector<std::uint32_t> dates;
+	std::vector<char> sexes;
+	for (std::size_t i = 0; i < NB_NUMEROS; i++)
+	{
+		int jour = i % 33;
+		int mois = i % 14;
+		int annee = 1950 + i % 60;
+		char sexe = i % 3 == 0 ? 'F' : 'M';
+		int moisNumero = sexe == 'F' ? mois + 50 : mois;
+		char numero[32];
+		std::snprintf(numero, sizeof(numero), "%02d%02d %02d11", annee % 100, moisNumero, jour);
+
+		std::string lettres = LETTRES[i % NB_NOMS];
+		lettres.resize(4, '\0');
+		numeros.push_back(lettres + ' ' + numero);
+		if (i % 11 == 0)
+		{
+			numeros.back().pop_back();
+		}
+		noms.push_back(NOMS[i % NB_NOMS]);
+		prenoms.push_back(PRENOMS[i % NB_NOMS]);
+		dates.push_back((annee << 9) | (mois << 5) | jour);
+		sexes.push_back(sexe);
+	}
+	std::unique_ptr<bool[]> valides(new bool[NB_NUMEROS]);
+
+	std::size_t nbAttendus = 0;
+	std::size_t nbValides = util::validerNumRAMQs(numeros.data(), noms.data(), prenoms.data(), dates.data(), sexes.data(),
+												  NB_NUMEROS, valides.get());
+	for (std::size_t i = 0; i < NB_NUMEROS; i++)
+	{
+		bool attendu = util::validerNumRAMQ(numeros[i], noms[i], prenoms[i], dates[i] & 0x1F, (dates[i] >> 5) & 0x0F,
+											dates[i] >> 9, sexes[i]);
+		ASSERT_EQ(attendu, valides[i]) << "ligne " << i;
+		nbAttendus += attendu;
+	}
+	ASSERT_EQ(nbAttendus, nbValides);
+	ASSERT_GT(nbValides, 0u);
+}
+
+/**
+ * \brief Test de la méthode bool validerFormatNom(const std::string& p_nom)
+ * cas valide : <br>
+ * 	validerFormatNomAscii :	Noms de lettres ASCII, plus courts et plus longs qu'un bloc de 16 caractères
+ * 	validerFormatNomAccents : Noms contenant des lettres accentuées encodées en UTF-8
+ * <br>
+ * cas invalide : <br>
+ * 	validerFormatNomVide : Nom vide
+ * 	validerFormatNomCaracteres : Chiffres, espaces, ponctuation, avant, dans et après un bloc de 16 caractères
+ * 	validerFormatNomUtf8Invalide : Séquences UTF-8 tronquées ou mal formées et caractères non latins ou qui ne sont pas des lettres
+ * 	validerFormatNomOctet : Chaque caractère d'un nom de 20 lettres remplacé par chacun des 256 octets
+ */
+TEST(validerFormatNom, validerFormatNomAscii)
+{
+	ASSERT_TRUE(util::validerFormatNom("a"));
+	ASSERT_TRUE(util::validerFormatNom("Jalbert"));
+	ASSERT_TRUE(util::validerFormatNom("AZaz"));
+	ASSERT_TRUE(util::validerFormatNom("Abcdefghijklmnop"));
+	ASSERT_TRUE(util::validerFormatNom("AbcdefghijklmnopQrstuvwxyzABCDEFGHIJ"));
+}
+
+TEST(validerFormatNom, validerFormatNomAccents)
+{
+	ASSERT_TRUE(util::validerFormatNom("\xC3\x89mile"));
+	ASSERT_TRUE(util::validerFormatNom("Gagn\xC3\xA9"));
+	ASSERT_TRUE(util::validerFormatNom("L\xC3\xA9vesque"));
+	ASSERT_TRUE(util::validerFormatNom("Fran\xC3\xA7oise"));
+	ASSERT_TRUE(util::validerFormatNom("\xC3\x8Bl\xC3\xB4\xC3\xAF\xC3\xB9\xC3\xBF"));
+	ASSERT_TRUE(util::validerFormatNom("C\xC5\x93ur"));
+	ASSERT_TRUE(util::validerFormatNom("AbcdefghijklmnopQrst\xC3\xA9"));
+}
+
+TEST(validerFormatNom, validerFormatNomVide)
+{
+	ASSERT_FALSE(util::validerFormatNom(""));
+	ASSERT_FALSE(util::validerFormatNom(nullptr, 0));
+}
+
+TEST(validerFormatNom, validerFormatNomCaracteres)
+{
+	ASSERT_FALSE(util::validerFormatNom("Nom6"));
+	ASSERT_FALSE(util::validerFormatNom("Jean Luc"));
+	ASSERT_FALSE(util::validerFormatNom("Jean-Luc"));
+	ASSERT_FALSE(util::validerFormatNom("@[`{"));
+	ASSERT_FALSE(util::validerFormatNom("Abcdefghijklmnop6"));
+	ASSERT_FALSE(util::validerFormatNom("AbcdefghijklmnopQrstuvwxyzABCDEF6HIJ"));
+	ASSERT_FALSE(util::validerFormatNom(std::string("Nom\0", 4)));
+}
+
+TEST(validerFormatNom, validerFormatNomUtf8Invalide)
+{
+	ASSERT_FALSE(util::validerFormatNom("Gagn\xC3"));
+	ASSERT_FALSE(util::validerFormatNom("Gagn\xA9"));
+	ASSERT_FALSE(util::validerFormatNom("Gagn\xC3\x41"));
+	ASSERT_FALSE(util::validerFormatNom("\xC3\x97"));
+	ASSERT_FALSE(util::validerFormatNom("\xC3\xB7"));
+	ASSERT_FALSE(util::validerFormatNom("\xC2\xAB" "Nom"));
+	ASSERT_FALSE(util::validerFormatNom("\xC1\x81"));
+	ASSERT_FALSE(util::validerFormatNom("\xE2\x82\xAC"));
+	ASSERT_FALSE(util::validerFormatNom("\xCE\xB1"));
+	ASSERT_FALSE(util::validerFormatNom("AbcdefghijklmnopQrst\xC3"));
+}
+
+TEST(validerFormatNom, validerFormatNomOctet)
+{
+	const std::string VALIDE = "AbcdefghijklmnopQrst";
+	for (std::size_t position = 0; position < VALIDE.length(); position++)
+	{
+		for (int octet = 0; octet < 256; octet++)
+		{
+			std::string nom(VALIDE);
+			nom[position] = static_cast<char>(octet);
+			bool attendu = (octet >= 'A' && octet <= 'Z') || (octet >= 'a' && octet <= 'z');
+			ASSERT_EQ(attendu, util::validerFormatNom(nom)) << "position " << position << ", octet " << octet;
+		}
+	}
+}
+
+/**
+ * \brief Test de la méthode std::size_t validerFormatNoms(const std::string* p_noms, std::size_t p_nbNoms, bool* p_valides)
+ * cas valide : <br>
+ * 	validerFormatNomsLot :	Chaque résultat du lot est celui de validerFormatNom() et le nombre de valides est retourné
+ * 	validerFormatNomsVide : Lot vide
+ * <br>
+ * cas invalide : <br>
+ * 	Aucun d'identifié
+ */
+TEST(validerFormatNoms, validerFormatNomsLot)
+{
+	const std::string NOMS[] = { "Jalbert", "", "Gagn\xC3\xA9", "Nom6", "\xC3", "AbcdefghijklmnopQrst" };
+	const std::size_t NB_NOMS = sizeof(NOMS) / sizeof(NOMS[0]);
+	bool valides[NB_NOMS];
+
+	ASSERT_EQ(3u, util::validerFormatNoms(NOMS, NB_NOMS, valides));
+	for (std::size_t i = 0; i < NB_NOMS; i++)
+	{
+		ASSERT_EQ(util::validerFormatNom(NOMS[i]), valides[i]);
+	}
+}
+
+TEST(validerFormatNoms, validerFormatNomsVide)
+{
+	ASSERT_EQ(0u, util::validerFormatNoms(nullptr, 0, nullptr));
+}
+
+/**
+ * \brief Test des méthodes normaliserNom(), comparerNomNormalise() et nomCommencePar()
+ * cas valide : <br>
+ * 	normaliserNomValide :	Majuscules ASCII, lettres accentuées remplacées par leur équivalent ASCII,
+ * 							lettres doubles (Æ, Œ, ß, Þ, Ĳ), lettres de U+0180 à U+024F gardées telles quelles
+ * 	comparerNomNormaliseValide : Même ordre que la comparaison des noms normalisés, préfixe plus court
+ * 	nomCommenceParValide : Préfixe vide, préfixe sans égard à la casse ni aux accents, préfixe qui coupe une lettre double
+ * <br>
+ * cas invalide : <br>
+ * 	nomCommenceParInvalide : Préfixe plus long que le nom, préfixe qui ne correspond pas
+ */
+TEST(normaliserNom, normaliserNomValide)
+{
+	ASSERT_EQ("", util::normaliserNom(""));
+	ASSERT_EQ("JALBERT", util::normaliserNom("jAlbert"));
+	ASSERT_EQ("GAGNE", util::normaliserNom("Gagn\xC3\xA9"));
+	ASSERT_EQ("EEEEAAC", util::normaliserNom("\xC3\x89\xC3\xA8\xC3\xAA\xC3\xAB\xC3\x80\xC3\xA2\xC3\xA7"));
+	ASSERT_EQ("LOEUVRE", util::normaliserNom("L\xC5\x93uvre"));
+	ASSERT_EQ("AESSTHIJ", util::normaliserNom("\xC3\x86\xC3\x9F\xC3\xBE\xC4\xB2"));
+	ASSERT_EQ("DVORAKLODZ", util::normaliserNom("Dvo\xC5\x99\xC3\xA1k\xC5\x81\xC3\xB3" "d\xC5\xBA"));
+	ASSERT_EQ("\xC6\x80Y", util::normaliserNom("\xC6\x80\xC3\xBF"));
+}
+
+TEST(normaliserNom, comparerNomNormaliseValide)
+{
+	ASSERT_EQ(0, util::comparerNomNormalise("Gagn\xC3\xA9", "GAGNE"));
+	ASSERT_LT(util::comparerNomNormalise("Gagn\xC3\xA9", "GAGNON"), 0);
+	ASSERT_GT(util::comparerNomNormalise("Gagnon", "GAGNE"), 0);
+	ASSERT_LT(util::comparerNomNormalise("Gagn", "GAGNE"), 0);
+	ASSERT_GT(util::comparerNomNormalise("Gagne", "GAGN"), 0);
+	ASSERT_GT(util::comparerNomNormalise("\xC5\x92uf", "OE"), 0);
+	ASSERT_EQ(0, util::comparerNomNormalise("", ""));
+}
+
+TEST(normaliserNom, nomCommenceParValide)
+{
+	ASSERT_TRUE(util::nomCommencePar("Tremblay", ""));
+	ASSERT_TRUE(util::nomCommencePar("Tremblay", "TREM"));
+	ASSERT_TRUE(util::nomCommencePar("\xC3\x89mond", "EM"));
+	ASSERT_TRUE(util::nomCommencePar("\xC5\x92uf", "O"));
+	ASSERT_TRUE(util::nomCommencePar("Gagn\xC3\xA9", "GAGNE"));
+}
+
+TEST(normaliserNom, nomCommenceParInvalide)
+{
+	ASSERT_FALSE(util::nomCommencePar("Roy", "ROYER"));
+	ASSERT_FALSE(util::nomCommencePar("Tremblay", "TRO"));
+	ASSERT_FALSE(util::nomCommencePar("\xC3\x89mond", "\xC3\x89"));
+}
@@ -88,14 +88,7 @@ int main()
 		}
 		else
 		{
-			util::Date dateAujourdhui;
-			util::Date dateNaissanceMinimale(dateAujourdhui.reqJour(), dateAujourdhui.reqMois(), (dateAujourdhui.reqAnnee() - AGE_MINIMAL_JOUEUR));
-			ageInvalide = !(util::Date (jour,mois,annee) <  dateNaissanceMinimale);
-			if(!ageInvalide)
-			{
-				util::Date dateNaissanceMaximale(dateAujourdhui.reqJour(), dateAujourdhui.reqMois(), (dateAujourdhui.reqAnnee() - AGE_MAXIMAL_JOUEUR - 1));
-				ageInvalide = !(dateNaissanceMaximale < (util::Date (jour,mois,annee)));
-			}
+			ageInvalide = !hockey::Joueur::validerAge(util::Date (jour,mois,annee));
 			if(ageInvalide)
 			{
 				cout << "Date invalide, le joueur doit être agé entre 15 et 17 ans" << endl;
@@ -180,9 +173,7 @@ int main()
 		}
 		else
 		{
-			util::Date dateAujourdhui;
-			util::Date dateNaissanceMinimale(dateAujourdhui.reqJour(), dateAujourdhui.reqMois(), (dateAujourdhui.reqAnnee() - AGE_MINIMAL_ENTRAINEUR));
-			ageInvalide = !(util::Date (jour,mois,annee) <  dateNaissanceMinimale);
+			ageInvalide = !hockey::Entraineur::validerAge(util::Date (jour,mois,annee));
 			if(ageInvalide)
 			{
 				cout << "Date invalide, l'entraineur doit être majeur" << endl;
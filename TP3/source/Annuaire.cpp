@@ -9,47 +9,696 @@
 
 #include "Annuaire.h"
 #include <sstream>
+#include <fstream>
+#include <algorithm>
+#include <cctype>
+#include <new>
+#include <cstdint>
+#include <utility>
+#include <atomic>
 #include "validationFormat.h"
+#include "Joueur.h"
+#include "AnnuaireColonnes.h"
+#include "InstantaneAnnuaire.h"
+#include "FichierProjete.h"
+#include "RequeteAnnuaire.h"
+#include "BornesAge.h"
+#include "IndexHachage.h"
+#include "IndexNaissance.h"
+#include "IndexNoms.h"
+#include "TriParBase.h"
+
+#if defined(__SANITIZE_THREAD__)
+#define ANNUAIRE_TSAN
+#elif defined(__has_feature)
+#if __has_feature(thread_sanitizer)
+#define ANNUAIRE_TSAN
+#endif
+#endif
+
+#if defined(ANNUAIRE_TSAN)
+#include <sanitizer/tsan_interface.h>
+#endif
 
 
 using namespace std;
 
+namespace
+{
+/**
+ * \brief Combine une valeur de hachage avec une autre
+ * \param[in] p_germe est la valeur de hachage accumulée
+ * \param[in] p_valeur est la valeur de hachage à y ajouter
+ * \return la valeur de hachage combinée
+ */
+std::size_t combinerHachage(std::size_t p_germe, std::size_t p_valeur)
+{
+	return p_germe ^ (p_valeur + 0x9e3779b9 + (p_germe << 6) + (p_germe >> 2));
+}
+
+/**
+ * \brief Calcule la clé de l'index d'identité (nom, prénom et date de naissance),
+ * 		  soit les mêmes attributs que ceux comparés par Personne::operator==
+ */
+std::size_t hacherIdentite(const std::string& p_nom, const std::string& p_prenom, const util::Date& p_dateNaissance)
+{
+	std::size_t cle = std::hash<std::string>()(p_nom);
+	cle = combinerHachage(cle, std::hash<std::string>()(p_prenom));
+	return combinerHachage(cle, std::hash<long>()(p_dateNaissance.reqJoursEpoque()));
+}
+
+/**
+ * Un registre est compacté dès que plus d'une case sur FACTEUR_COMPACTAGE est vide : le
+ * compactage, linéaire, est ainsi amorti sur au moins n / FACTEUR_COMPACTAGE retraits.
+ */
+const std::size_t FACTEUR_COMPACTAGE = 64;
+
+/**
+ * \brief Annonce à ThreadSanitizer qu'un annuaire a fini de lire un registre et va libérer
+ * 		  sa référence. Sans effet hors de ThreadSanitizer, où la libération de la référence
+ * 		  suffit (voir Annuaire::registreModifiable()).
+ * \param[in] p_registre est le registre abandonné
+ */
+inline void annoterLiberation(const void* p_registre)
+{
+#if defined(ANNUAIRE_TSAN)
+	__tsan_release(const_cast<void*>(p_registre));
+#else
+	(void) p_registre;
+#endif
+}
+
+/**
+ * \brief Barrière d'acquisition d'un annuaire devenu le seul à référencer un registre, qui
+ * 		  ordonne les lectures des annuaires qui l'ont abandonné avant ses écritures.
+ * 		  ThreadSanitizer ne modélise pas std::atomic_thread_fence() : l'acquisition, qui
+ * 		  répond à annoterLiberation(), lui est alors annoncée à la place.
+ * \param[in] p_registre est le registre acquis
+ */
+inline void barriereAcquisition(const void* p_registre)
+{
+#if defined(ANNUAIRE_TSAN)
+	__tsan_acquire(const_cast<void*>(p_registre));
+#else
+	(void) p_registre;
+	std::atomic_thread_fence(std::memory_order_acquire);
+#endif
+}
+
+/**
+ * \brief Calcule la clé de l'index de téléphone
+ */
+std::size_t hacherTelephone(const std::string& p_telephone)
+{
+	return std::hash<std::string>()(p_telephone);
+}
+
+/**
+ * \brief Retourne un numéro de RAMQ en majuscules. Les lettres du numéro de RAMQ sont validées
+ * 		  sans égard à la casse : c'est la forme sous laquelle il est haché et ordonné.
+ */
+std::string majusculesNumRAMQ(const std::string& p_numRAMQ)
+{
+	std::string majuscules(p_numRAMQ);
+	for (std::string::size_type i = 0; i < majuscules.length(); i++)
+	{
+		majuscules[i] = toupper(static_cast<unsigned char>(majuscules[i]));
+	}
+	return majuscules;
+}
+
+/**
+ * \brief Calcule la clé de l'index de RAMQ, sans égard à la casse
+ */
+std::size_t hacherNumRAMQ(const std::string& p_numRAMQ)
+{
+	return std::hash<std::string>()(majusculesNumRAMQ(p_numRAMQ));
+}
+
+/**
+ * \brief Compare deux numéros de RAMQ sans égard à la casse
+ */
+bool memeNumRAMQ(const std::string& p_numA, const std::string& p_numB)
+{
+	bool meme = p_numA.length() == p_numB.length();
+	for (std::string::size_type i = 0; meme && i < p_numA.length(); i++)
+	{
+		meme = toupper(static_cast<unsigned char>(p_numA[i])) == toupper(static_cast<unsigned char>(p_numB[i]));
+	}
+	return meme;
+}
+
+/**
+ * \struct CleChaine
+ * \brief Chaîne à placer dans la table des chaînes d'un instantané. m_debut contient les 8 premiers
+ * 		  octets de la chaîne, complétés par des 0, du plus significatif au moins significatif :
+ * 		  deux clés dont les débuts diffèrent sont ordonnées sans lire les chaînes, et deux chaînes
+ * 		  d'au plus 8 octets sont égales si leurs débuts et leurs longueurs le sont.
+ */
+struct CleChaine
+{
+	std::uint64_t m_debut;
+	std::uint32_t m_longueur;
+	std::uint32_t m_reference;
+};
+
+/**
+ * \brief Construit la table des chaînes d'un instantané, triée et sans doublon
+ * 		  Les chaînes sont triées par base sur leurs 8 premiers octets ; seules les suites de
+ * 		  débuts égaux dont les chaînes diffèrent sont ensuite triées par comparaison. Les chaînes
+ * 		  ne sont lues que pour ces suites, pour départager les chaînes de plus de 8 octets et pour
+ * 		  copier chaque chaîne distincte dans le texte.
+ * \param[in] p_vChaines sont les chaînes à placer dans la table, avec leurs doublons
+ * \param[out] p_vIds reçoit, pour chaque chaîne de p_vChaines, sa position dans la table
+ * \param[out] p_vIndexChaines reçoit la position du début de chaque chaîne dans le texte, suivie de la taille du texte
+ * \param[out] p_texte reçoit les chaînes distinctes, bout à bout dans l'ordre de la table
+ */
+void construireTableChaines(const std::vector<const std::string*>& p_vChaines, std::vector<std::uint32_t>& p_vIds,
+							std::vector<std::uint32_t>& p_vIndexChaines, std::string& p_texte)
+{
+	std::vector<CleChaine> vCles(p_vChaines.size());
+	for (std::uint32_t i = 0; i < p_vChaines.size(); i++)
+	{
+		const std::string& chaine = *p_vChaines[i];
+		std::uint64_t debut = 0;
+		for (std::size_t j = 0; j < 8; j++)
+		{
+			debut = debut << 8 | (j < chaine.length() ? static_cast<unsigned char>(chaine[j]) : 0);
+		}
+		vCles[i] = CleChaine { debut, static_cast<std::uint32_t>(chaine.length()), i };
+	}
+	util::trierParBase(vCles, 64, [](const CleChaine& p_cle) { return p_cle.m_debut; });
+
+	auto egales = [&p_vChaines](const CleChaine& p_a, const CleChaine& p_b)
+	{
+		return p_a.m_debut == p_b.m_debut && p_a.m_longueur == p_b.m_longueur
+				&& (p_a.m_longueur <= 8 || *p_vChaines[p_a.m_reference] == *p_vChaines[p_b.m_reference]);
+	};
+	for (auto debut = vCles.begin(); debut != vCles.end();)
+	{
+		auto fin = std::find_if(debut, vCles.end(), [debut](const CleChaine& p_cle) { return p_cle.m_debut != debut->m_debut; });
+		if (!std::all_of(debut, fin, [debut, &egales](const CleChaine& p_cle) { return egales(*debut, p_cle); }))
+		{
+			std::sort(debut, fin, [&p_vChaines](const CleChaine& p_a, const CleChaine& p_b)
+			{
+				return *p_vChaines[p_a.m_reference] < *p_vChaines[p_b.m_reference];
+			});
+		}
+		debut = fin;
+	}
+
+	p_vIds.resize(p_vChaines.size());
+	p_vIndexChaines.assign(1, 0);
+	p_texte.clear();
+	for (std::size_t i = 0; i < vCles.size(); i++)
+	{
+		if (i == 0 || !egales(vCles[i - 1], vCles[i]))
+		{
+			p_texte += *p_vChaines[vCles[i].m_reference];
+			p_vIndexChaines.push_back(p_texte.length());
+		}
+		p_vIds[vCles[i].m_reference] = p_vIndexChaines.size() - 2;
+	}
+}
+
+/**
+ * \struct CleOrdre
+ * \brief Clé d'une fiche à trier pour l'une des permutations d'un instantané, avec sa position
+ */
+struct CleOrdre
+{
+	std::uint64_t m_cle;
+	std::uint32_t m_position;
+};
+
+/**
+ * \brief Trie les clés des fiches d'un instantané
+ * \param[in,out] p_vCles sont les clés à trier, dont l'ordre est conservé entre clés égales
+ * \param[in] p_max est la plus grande clé
+ */
+void trierCles(std::vector<CleOrdre>& p_vCles, std::uint64_t p_max)
+{
+	util::trierParBase(p_vCles, util::nbBits(p_max), [](const CleOrdre& p_cle) { return p_cle.m_cle; });
+}
+
+/**
+ * \brief Écrit des octets nuls jusqu'à la position alignée suivante d'un instantané
+ * \param[in,out] p_os est le flux dans lequel l'instantané est écrit
+ * \param[in,out] p_position est la position courante dans l'instantané
+ */
+void alignerSection(std::ostream& p_os, std::size_t& p_position)
+{
+	static const char ZEROS[8] = { 0 };
+	std::size_t alignee = hockey::VueInstantane::aligner(p_position);
+	p_os.write(ZEROS, alignee - p_position);
+	p_position = alignee;
+}
+
+/**
+ * \brief Écrit un tableau dans un instantané
+ * \param[in,out] p_os est le flux dans lequel l'instantané est écrit
+ * \param[in,out] p_position est la position courante dans l'instantané
+ * \param[in] p_vValeurs sont les valeurs à écrire
+ */
+template<typename T>
+void ecrireSection(std::ostream& p_os, std::size_t& p_position, const std::vector<T>& p_vValeurs)
+{
+	p_os.write(reinterpret_cast<const char*>(p_vValeurs.data()), p_vValeurs.size() * sizeof(T));
+	p_position += p_vValeurs.size() * sizeof(T);
+}
+}
+
+
 namespace hockey
 {
 
 /**
- * \brief Constructeur avec paramètres string
- * 		  On construit un objet Entraineur avec son nom de club
- * \param[in] p_nomClub est un string qui contient le nom du club
+ * \struct Annuaire::RegistreMembres
+ * \brief Membres d'un annuaire, leurs index et l'arène dans laquelle ils sont clonés
+ *
+ * 		Un registre est partagé par toutes les copies d'un annuaire et n'est jamais modifié
+ * 		tant qu'il est partagé : un annuaire le duplique avec le constructeur copie avant de
+ * 		le modifier (voir Annuaire::registreModifiable()). Le registre détruit ses membres,
+ * 		puis son arène les libère d'un bloc.
+ * 		Les index de hachage associent une clé à la position d'un membre dans m_vMembres. Un
+ * 		membre retiré laisse une case vide (nullptr) à sa position, ce qui garde l'ordre d'ajout
+ * 		des autres membres sans décaler leurs positions. Quand les cases vides dépassent
+ * 		1 / FACTEUR_COMPACTAGE des cases, compacter() les supprime dans l'ordre et renumérote
+ * 		les index de hachage d'un seul parcours chacun.
+ *
+ * 		Attributs: m_vMembres: un vector de Personne contenant les personnes membres du club,
+ * 				   			   dans leur ordre d'ajout, nullptr pour un membre retiré
+ * 				   m_vRetires : les positions des cases vides de m_vMembres, en ordre croissant
+ * 				   m_indexIdentite : index de hachage nom + prénom + date de naissance
+ * 				   m_indexTelephone : index de hachage sur le numéro de téléphone
+ * 				   m_indexRAMQ : index de hachage sur le numéro de RAMQ des entraineurs
+ * 				   m_indexNaissance : index ordonné sur la date de naissance
+ * 				   m_indexNoms : index ordonné sur le nom et le prénom normalisés
+ * 				   m_arena : l'arène dans laquelle les membres sont clonés
  */
-Annuaire::Annuaire(const std::string p_nomClub):
-		 	       m_nomClub(p_nomClub)
+struct Annuaire::RegistreMembres
+{
+	RegistreMembres();
+	RegistreMembres(const RegistreMembres& p_registre);
+	~RegistreMembres();
+
+	void ajouterMembre(Personne* p_membre);
+	void retirerMembre(std::uint32_t p_position);
+	void indexer(std::uint32_t p_position);
+	void indexerHachage(std::uint32_t p_position);
+	void construireIndexHachage();
+	void construireIndexOrdonnes();
+	void desindexer(std::uint32_t p_position);
+	std::uint32_t position(const std::string& p_nom, const std::string& p_prenom, const util::Date& p_dateNaissance) const;
+	std::uint32_t position(const Personne* p_membre) const;
+	Personne* trouver(const std::string& p_nom, const std::string& p_prenom, const util::Date& p_dateNaissance) const;
+	std::uint32_t reqNbMembres() const;
+	Personne* reqMembre(std::uint32_t p_indice) const;
+	std::vector<const Personne*> reqMembresPresents() const;
+
+	std::vector<Personne*> m_vMembres;
+	std::vector<std::uint32_t> m_vRetires;
+	IndexHachage m_indexIdentite;
+	IndexHachage m_indexTelephone;
+	IndexHachage m_indexRAMQ;
+	IndexNaissance m_indexNaissance;
+	IndexNoms m_indexNoms;
+	ArenaMembres m_arena;
+
+private:
+	RegistreMembres& operator=(const RegistreMembres&);
+
+	void compacter();
+
+	/**
+	 * \brief Appelle une fonction avec chaque index de hachage où figure un membre et la clé du
+	 * 		  membre dans cet index
+	 * \param[in] p_membre est un pointeur vers un membre
+	 * \param[in] p_fonction est appelée avec un IndexHachage& et une clé std::size_t
+	 */
+	template<typename Fonction>
+	void parcourirClesHachage(const Personne* p_membre, Fonction p_fonction)
+	{
+		p_fonction(m_indexIdentite, hacherIdentite(p_membre->reqNom(), p_membre->reqPrenom(), p_membre->reqDateNaissance()));
+		p_fonction(m_indexTelephone, hacherTelephone(p_membre->reqTelephone()));
+
+		const Entraineur* entraineur = dynamic_cast<const Entraineur*>(p_membre);
+		if (entraineur != nullptr)
+		{
+			p_fonction(m_indexRAMQ, hacherNumRAMQ(entraineur->reqNumRAMQ()));
+		}
+	}
+};
+
+/**
+ * \brief Constructeur par défaut, le registre est vide et n'alloue rien
+ */
+Annuaire::RegistreMembres::RegistreMembres()
 {
 }
 
 /**
- * \brief Constructeur avec paramètres Annuaire
- * 		  On construit un objet Entraineur avec un autre objet Annuaire
- * \param[in] p_annuaire est un objet Annuaire
+ * \brief Constructeur copie
+ * 		  Chaque membre de p_registre est cloné dans l'arène du nouveau registre, dans le même ordre
+ * 		  et avec les mêmes cases vides : les index de hachage, qui ne contiennent que des
+ * 		  positions, sont copiés tels quels. Les
+ * 		  index ordonnés ne sont pas retriés : leurs blocs sont copiés et chaque ancien membre y est
+ * 		  remplacé par le clone de même position.
+ * \param[in] p_registre est le registre à dupliquer
  */
-Annuaire::Annuaire(const Annuaire& p_annuaire)
+Annuaire::RegistreMembres::RegistreMembres(const RegistreMembres& p_registre):
+		m_vRetires(p_registre.m_vRetires), m_indexIdentite(p_registre.m_indexIdentite),
+		m_indexTelephone(p_registre.m_indexTelephone), m_indexRAMQ(p_registre.m_indexRAMQ)
 {
-	std::vector<Personne*> vPersonne = p_annuaire.m_vMembres;
-	m_nomClub = p_annuaire.reqNomClub();
+	m_vMembres.reserve(p_registre.m_vMembres.size());
+	for (const Personne* membre : p_registre.m_vMembres)
+	{
+		m_vMembres.push_back(membre != nullptr ? membre->clone(m_arena) : nullptr);
+	}
 
-	int nbPersonne = vPersonne.size();
+	auto cloneDe = [this, &p_registre](const Personne* p_membre)
+	{
+		return m_vMembres[p_registre.position(p_membre)];
+	};
+	m_indexNaissance.copier(p_registre.m_indexNaissance, cloneDe);
+	m_indexNoms.copier(p_registre.m_indexNoms, cloneDe);
+}
+
+/**
+ * \brief Destructeur qui détruit les membres, l'arène libère ensuite leur mémoire en un seul bloc
+ */
+Annuaire::RegistreMembres::~RegistreMembres()
+{
+	int nbPersonne = m_vMembres.size();
 
 	for(int i = 0; i < nbPersonne; i++)
 	{
-		this->ajouterPersonne(*vPersonne[i]);
+		if (m_vMembres[i] != nullptr)
+		{
+			m_vMembres[i]->~Personne();
+		}
+	}
+}
+
+/**
+ * \brief Ajoute à la fin du registre un membre déjà construit dans son arène, puis l'indexe
+ * \param[in] p_membre est un pointeur vers un membre alloué dans m_arena
+ */
+void Annuaire::RegistreMembres::ajouterMembre(Personne* p_membre)
+{
+	PRECONDITION(m_vMembres.size() < IndexHachage::POSITION_VIDE);
+
+	m_vMembres.push_back(p_membre);
+	indexer(m_vMembres.size() - 1);
+}
+
+/**
+ * \brief Retire un membre du registre et de ses index, puis le détruit, sans changer l'ordre
+ * 		  des autres membres : sa case devient vide. Les cases vides sont supprimées par
+ * 		  compacter() quand elles sont trop nombreuses, ce qui donne un coût amorti constant
+ * 		  hormis les index ordonnés. La mémoire du membre retiré reste réservée dans l'arène
+ * 		  jusqu'à sa libération.
+ * \param[in] p_position est la position du membre dans m_vMembres
+ */
+void Annuaire::RegistreMembres::retirerMembre(std::uint32_t p_position)
+{
+	PRECONDITION(p_position < m_vMembres.size());
+	PRECONDITION(m_vMembres[p_position] != nullptr);
+
+	Personne* membre = m_vMembres[p_position];
+	desindexer(p_position);
+
+	m_vMembres[p_position] = nullptr;
+	m_vRetires.insert(std::upper_bound(m_vRetires.begin(), m_vRetires.end(), p_position), p_position);
+	membre->~Personne();
+
+	if (m_vRetires.size() * FACTEUR_COMPACTAGE > m_vMembres.size())
+	{
+		compacter();
+	}
+}
+
+/**
+ * \brief Supprime les cases vides de m_vMembres sans changer l'ordre des membres, puis
+ * 		  renumérote les index de hachage. Les index ordonnés, qui contiennent des pointeurs,
+ * 		  ne changent pas.
+ */
+void Annuaire::RegistreMembres::compacter()
+{
+	std::vector<std::uint32_t> vNouvellesPositions(m_vMembres.size(), IndexHachage::POSITION_VIDE);
+	std::uint32_t nbPresents = 0;
+
+	for (std::uint32_t i = 0; i < m_vMembres.size(); i++)
+	{
+		if (m_vMembres[i] != nullptr)
+		{
+			vNouvellesPositions[i] = nbPresents;
+			m_vMembres[nbPresents] = m_vMembres[i];
+			nbPresents++;
+		}
 	}
+	m_vMembres.resize(nbPresents);
+	m_vRetires.clear();
+
+	m_indexIdentite.renumeroter(vNouvellesPositions);
+	m_indexTelephone.renumeroter(vNouvellesPositions);
+	m_indexRAMQ.renumeroter(vNouvellesPositions);
+}
+
+/**
+ * \brief Ajoute un membre à chacun des index
+ * \param[in] p_position est la position du membre dans m_vMembres
+ */
+void Annuaire::RegistreMembres::indexer(std::uint32_t p_position)
+{
+	indexerHachage(p_position);
+	m_indexNaissance.ajouter(m_vMembres[p_position]);
+	m_indexNoms.ajouter(m_vMembres[p_position]);
+}
+
+/**
+ * \brief Ajoute un membre aux index de hachage seulement
+ * \param[in] p_position est la position du membre dans m_vMembres
+ */
+void Annuaire::RegistreMembres::indexerHachage(std::uint32_t p_position)
+{
+	parcourirClesHachage(m_vMembres[p_position], [p_position](IndexHachage& p_index, std::size_t p_cle)
+	{
+		p_index.ajouter(p_cle, p_position);
+	});
+}
+
+/**
+ * \brief Construit les index de hachage de tous les membres du registre d'un bloc chacun : les
+ * 		  clés sont calculées en un parcours des membres, puis rangées dans l'ordre des tableaux
+ */
+void Annuaire::RegistreMembres::construireIndexHachage()
+{
+	PRECONDITION(m_vRetires.empty());
+
+	IndexHachage* const vIndex[] = { &m_indexIdentite, &m_indexTelephone, &m_indexRAMQ };
+	std::vector<std::pair<std::size_t, std::uint32_t>> vEntrees[3];
+	vEntrees[0].reserve(m_vMembres.size());
+	vEntrees[1].reserve(m_vMembres.size());
+
+	for (std::uint32_t i = 0; i < m_vMembres.size(); i++)
+	{
+		parcourirClesHachage(m_vMembres[i], [&vIndex, &vEntrees, i](IndexHachage& p_index, std::size_t p_cle)
+		{
+			vEntrees[std::find(vIndex, vIndex + 3, &p_index) - vIndex].emplace_back(p_cle, i);
+		});
+	}
+	for (std::size_t i = 0; i < 3; i++)
+	{
+		vIndex[i]->construire(vEntrees[i]);
+	}
+}
+
+/**
+ * \brief Construit les index ordonnés des dates de naissance et des noms de tous les membres du
+ * 		  registre, d'un seul tri chacun plutôt qu'un membre à la fois
+ */
+void Annuaire::RegistreMembres::construireIndexOrdonnes()
+{
+	std::vector<const Personne*> vMembres = reqMembresPresents();
+	m_indexNaissance.construire(vMembres);
+	m_indexNoms.construire(vMembres);
+}
+
+/**
+ * \brief Retire un membre de chacun des index, sans le retirer du registre
+ * \param[in] p_position est la position du membre dans m_vMembres
+ */
+void Annuaire::RegistreMembres::desindexer(std::uint32_t p_position)
+{
+	const Personne* membre = m_vMembres[p_position];
+	parcourirClesHachage(membre, [p_position](IndexHachage& p_index, std::size_t p_cle)
+	{
+		p_index.retirer(p_cle, p_position);
+	});
+	m_indexNaissance.retirer(membre);
+	m_indexNoms.retirer(membre);
+}
+
+/**
+ * \brief Recherche la position d'un membre par son identité à l'aide de l'index de hachage
+ * \param[in] p_nom est le nom du membre recherché
+ * \param[in] p_prenom est le prénom du membre recherché
+ * \param[in] p_dateNaissance est la date de naissance du membre recherché
+ * \return la position du membre dans m_vMembres, ou IndexHachage::POSITION_VIDE s'il est absent
+ */
+std::uint32_t Annuaire::RegistreMembres::position(const std::string& p_nom, const std::string& p_prenom,
+												   const util::Date& p_dateNaissance) const
+{
+	std::uint32_t trouve = IndexHachage::POSITION_VIDE;
+
+	m_indexIdentite.parcourir(hacherIdentite(p_nom, p_prenom, p_dateNaissance), [&](std::uint32_t p_position)
+	{
+		const Personne* membre = m_vMembres[p_position];
+		if (membre->reqNom() == p_nom && membre->reqPrenom() == p_prenom && membre->reqDateNaissance() == p_dateNaissance)
+		{
+			trouve = p_position;
+		}
+		return trouve == IndexHachage::POSITION_VIDE;
+	});
+
+	return trouve;
+}
+
+/**
+ * \brief Recherche la position d'un membre du registre à l'aide de l'index d'identité
+ * \param[in] p_membre est un pointeur vers un membre du registre
+ * \return la position du membre dans m_vMembres
+ */
+std::uint32_t Annuaire::RegistreMembres::position(const Personne* p_membre) const
+{
+	std::uint32_t trouve = IndexHachage::POSITION_VIDE;
+
+	m_indexIdentite.parcourir(hacherIdentite(p_membre->reqNom(), p_membre->reqPrenom(), p_membre->reqDateNaissance()),
+							  [&](std::uint32_t p_position)
+	{
+		if (m_vMembres[p_position] == p_membre)
+		{
+			trouve = p_position;
+		}
+		return trouve == IndexHachage::POSITION_VIDE;
+	});
+
+	POSTCONDITION(trouve != IndexHachage::POSITION_VIDE);
+	return trouve;
+}
+
+/**
+ * \brief Recherche un membre par son identité à l'aide de l'index de hachage
+ * \param[in] p_nom est le nom du membre recherché
+ * \param[in] p_prenom est le prénom du membre recherché
+ * \param[in] p_dateNaissance est la date de naissance du membre recherché
+ * \return un pointeur vers le membre trouvé ou nullptr s'il est absent
+ */
+Personne* Annuaire::RegistreMembres::trouver(const std::string& p_nom, const std::string& p_prenom,
+											  const util::Date& p_dateNaissance) const
+{
+	std::uint32_t trouve = position(p_nom, p_prenom, p_dateNaissance);
+	return trouve != IndexHachage::POSITION_VIDE ? m_vMembres[trouve] : nullptr;
+}
+
+/**
+ * \brief Retourne le nombre de membres présents dans le registre
+ * \return le nombre de cases de m_vMembres qui ne sont pas vides
+ */
+std::uint32_t Annuaire::RegistreMembres::reqNbMembres() const
+{
+	return m_vMembres.size() - m_vRetires.size();
+}
+
+/**
+ * \brief Retourne un membre présent selon son rang dans l'ordre d'ajout, en O(log r) pour r cases vides
+ * 		  Le membre de rang p_indice est à la position p_indice + j, où j est le nombre de cases
+ * 		  vides qui le précèdent : le j-ième retiré est précédé de m_vRetires[j] - j membres
+ * 		  présents, une suite croissante dans laquelle j est cherché par dichotomie.
+ * \param[in] p_indice est le rang du membre, doit être plus petit que reqNbMembres()
+ * \return un pointeur vers le membre
+ */
+Personne* Annuaire::RegistreMembres::reqMembre(std::uint32_t p_indice) const
+{
+	PRECONDITION(p_indice < reqNbMembres());
+
+	std::size_t bas = 0;
+	std::size_t haut = m_vRetires.size();
+	while (bas < haut)
+	{
+		std::size_t milieu = (bas + haut) / 2;
+		if (m_vRetires[milieu] - milieu <= p_indice)
+		{
+			bas = milieu + 1;
+		}
+		else
+		{
+			haut = milieu;
+		}
+	}
+
+	POSTCONDITION(m_vMembres[p_indice + bas] != nullptr);
+	return m_vMembres[p_indice + bas];
+}
+
+/**
+ * \brief Retourne les membres présents, sans les cases vides, dans l'ordre d'ajout
+ * \return un vector de reqNbMembres() pointeurs vers les membres
+ */
+std::vector<const Personne*> Annuaire::RegistreMembres::reqMembresPresents() const
+{
+	std::vector<const Personne*> vMembres;
+	vMembres.reserve(reqNbMembres());
+	for (const Personne* membre : m_vMembres)
+	{
+		if (membre != nullptr)
+		{
+			vMembres.push_back(membre);
+		}
+	}
+	return vMembres;
+}
+
+/**
+ * \brief Constructeur avec paramètres string
+ * 		  On construit un objet Entraineur avec son nom de club. L'annuaire partage le registre
+ * 		  vide commun, sa construction n'alloue donc pas de registre.
+ * \param[in] p_nomClub est un string qui contient le nom du club, déplacé dans l'annuaire
+ */
+Annuaire::Annuaire(std::string p_nomClub):
+		 	       m_nomClub(std::move(p_nomClub)), m_registre(registreVide())
+{
+}
+
+/**
+ * \brief Constructeur avec paramètres Annuaire
+ * 		  On construit un objet Entraineur avec un autre objet Annuaire. Le registre des membres
+ * 		  est partagé avec p_annuaire : aucun membre n'est copié.
+ * \param[in] p_annuaire est un objet Annuaire
+ */
+Annuaire::Annuaire(const Annuaire& p_annuaire):
+		 	       m_nomClub(p_annuaire.m_nomClub), m_registre(p_annuaire.m_registre)
+{
+}
+
+/**
+ * \brief Constructeur de déplacement
+ * 		  Le registre de p_annuaire est repris tel quel : les membres ne sont ni copiés ni
+ * 		  déplacés en mémoire, les pointeurs des index restent donc valides.
+ * \param[in,out] p_annuaire est l'annuaire repris, qui reste vide
+ */
+Annuaire::Annuaire(Annuaire&& p_annuaire) noexcept:
+		 	       m_nomClub(std::move(p_annuaire.m_nomClub)), m_registre(std::move(p_annuaire.m_registre))
+{
+	p_annuaire.m_registre = registreVide();
 }
 
 /**
  * \brief Retourne le nom de club associé à l'annuaire
  * \return un string contenant le nom du club associé à l'annuaire
  */
-const std::string Annuaire::reqNomClub() const
+const std::string& Annuaire::reqNomClub() const
 {
 	return m_nomClub;
 }
@@ -68,66 +717,681 @@ const std::string Annuaire::reqNomClub() const
  *		  [...]
  * \return un string contenant les informations formatés
  */
-const std::string Annuaire::reqAnnuaireFormate() const
+std::string Annuaire::reqAnnuaireFormate() const
 {
-	std::vector<Personne*> vPersonne = m_vMembres;
-
 	ostringstream oss;
+	ecrireAnnuaireFormate(oss);
+	return oss.str();
+}
 
-	oss << "Club   : " << m_nomClub << endl;
-	oss << "--------------------" << endl;
+/**
+ * \brief Écrit les informations de l'annuaire, au format de reqAnnuaireFormate(), directement
+ * 		  dans un flux de sortie. Chaque membre est formaté dans un même tampon, réutilisé d'un
+ * 		  membre à l'autre, puis écrit dans le flux : la mémoire utilisée ne dépend donc pas du
+ * 		  nombre de membres et le formatage ne fait aucune allocation.
+ * \param[in,out] p_os est le flux dans lequel les informations sont écrites
+ */
+void Annuaire::ecrireAnnuaireFormate(std::ostream& p_os) const
+{
+	p_os << "Club   : " << m_nomClub << '\n';
+	p_os << "--------------------\n";
 
-	int nbPersonne = vPersonne.size();
+	util::TamponFormatage tampon;
+	const std::vector<Personne*>& vMembres = m_registre->m_vMembres;
+	int nbPersonne = vMembres.size();
 
 	for(int i = 0; i < nbPersonne; i++)
 	{
-		std::string formater = vPersonne[i]->reqPersonneFormate();
-		oss << formater;
+		if (vMembres[i] != nullptr)
+		{
+			vMembres[i]->formaterPersonne(tampon);
+			tampon.ecrire(p_os);
+			tampon.vider();
+		}
 	}
-
-	return oss.str();
 }
 
 /**
  * \brief Assigne un nouveau membre au club de l'annuaire
+ * 		  Le registre est d'abord dupliqué s'il est partagé avec une autre copie de l'annuaire.
  * \param[in] p_personne est un objet héritant de la classe Personne
  */
 void Annuaire::ajouterPersonne (const Personne& p_personne)
 {
-	m_vMembres.push_back(p_personne.clone());
+	PRECONDITION(!personneEstDejaPresente(p_personne));
+
+	RegistreMembres& registre = registreModifiable();
+	registre.ajouterMembre(p_personne.clone(registre.m_arena));
+
+	POSTCONDITION(personneEstDejaPresente(p_personne));
 }
 
 /**
- * \brief surcharge de l'opérateur =
- * \param[in] p_annuaire est un objet Annuaire
+ * \brief Assigne un nouveau membre au club de l'annuaire s'il n'y est pas déjà
+ * 		  Contrairement à personneEstDejaPresente() suivi d'ajouterPersonne(), le membre n'est
+ * 		  recherché qu'une fois. Le registre n'est dupliqué que si le membre est ajouté.
+ * \param[in] p_personne est un objet héritant de la classe Personne
+ * \return un booléen indiquant si le membre a été ajouté
  */
-void Annuaire::operator=(const Annuaire& p_annuaire)
+bool Annuaire::ajouterPersonneSiAbsente(const Personne& p_personne)
 {
-	m_vMembres.clear();
+	bool ajoute = m_registre->position(p_personne.reqNom(), p_personne.reqPrenom(), p_personne.reqDateNaissance())
+			== IndexHachage::POSITION_VIDE;
 
-	std::vector<Personne*> vPersonne = p_annuaire.m_vMembres;
-	m_nomClub = p_annuaire.reqNomClub();
+	if (ajoute)
+	{
+		RegistreMembres& registre = registreModifiable();
+		registre.ajouterMembre(p_personne.clone(registre.m_arena));
+	}
 
-	int nbPersonne = vPersonne.size();
+	POSTCONDITION(personneEstDejaPresente(p_personne));
+	return ajoute;
+}
 
-	for(int i = 0; i < nbPersonne; i++)
+/**
+ * \brief Déplace un nouveau membre dans l'arène de l'annuaire s'il n'y est pas déjà
+ * 		  Comme ajouterPersonneSiAbsente(const Personne&), mais le membre ajouté est déplacé
+ * 		  plutôt que copié : ses chaînes changent de propriétaire sans être réallouées.
+ * \param[in] p_personne est le membre à ajouter ; s'il est ajouté, il ne peut plus qu'être détruit
+ * \return un booléen indiquant si le membre a été ajouté, en dernière position
+ */
+bool Annuaire::ajouterPersonneSiAbsente(Personne&& p_personne)
+{
+	bool ajoute = m_registre->position(p_personne.reqNom(), p_personne.reqPrenom(), p_personne.reqDateNaissance())
+			== IndexHachage::POSITION_VIDE;
+
+	if (ajoute)
 	{
-		this->ajouterPersonne(*vPersonne[i]);
+		RegistreMembres& registre = registreModifiable();
+		registre.ajouterMembre(std::move(p_personne).clone(registre.m_arena));
 	}
+
+	POSTCONDITION(ajoute ? personneEstDejaPresente(reqMembre(reqNbMembres() - 1)) : personneEstDejaPresente(p_personne));
+	return ajoute;
 }
 
 /**
- * \brief Destructeur qui supprime le contenu du vector de membres
+ * \brief Retire un membre du club de l'annuaire
+ * \param[in] p_personne est un objet Personne égal (même nom, prénom et date de naissance) au membre à retirer
+ * \return un booléen indiquant si un membre a été retiré
  */
-Annuaire::~Annuaire()
+bool Annuaire::retirerPersonne(const Personne& p_personne)
 {
-	std::vector<Personne*> vPersonne = m_vMembres;
+	bool retire = personneEstDejaPresente(p_personne);
+
+	if (retire)
+	{
+		// Le membre est recherché après la duplication éventuelle du registre partagé
+		RegistreMembres& registre = registreModifiable();
+		registre.retirerMembre(registre.position(p_personne.reqNom(), p_personne.reqPrenom(), p_personne.reqDateNaissance()));
+	}
 
-	int nbPersonne = vPersonne.size();
+	POSTCONDITION(!personneEstDejaPresente(p_personne));
+	return retire;
+}
 
-	for(int i = 0; i < nbPersonne; i++)
+/**
+ * \brief Assigne un nouveau numéro de téléphone à un membre du club et met à jour l'index de téléphone
+ * 		  Le registre est d'abord dupliqué s'il est partagé : les autres copies de l'annuaire
+ * 		  conservent l'ancien numéro. Seul l'index de téléphone dépend du numéro : les autres
+ * 		  index ne sont pas touchés.
+ * \param[in] p_personne est un objet Personne égal (même nom, prénom et date de naissance) au membre à modifier
+ * \param[in] p_telephone est le nouveau numéro de téléphone, doit être un numéro valide
+ * \return un booléen indiquant si un membre a été modifié
+ */
+bool Annuaire::asgTelephoneMembre(const Personne& p_personne, const std::string& p_telephone)
+{
+	PRECONDITION(util::validerTelephone(p_telephone));
+
+	bool modifie = personneEstDejaPresente(p_personne);
+
+	if (modifie)
+	{
+		RegistreMembres& registre = registreModifiable();
+		std::uint32_t position = registre.position(p_personne.reqNom(), p_personne.reqPrenom(), p_personne.reqDateNaissance());
+		Personne* membre = registre.m_vMembres[position];
+		registre.m_indexTelephone.retirer(hacherTelephone(membre->reqTelephone()), position);
+		membre->asgTelephone(p_telephone);
+		registre.m_indexTelephone.ajouter(hacherTelephone(p_telephone), position);
+	}
+
+	return modifie;
+}
+
+/**
+ * \brief Retourne le nombre de membres de l'annuaire
+ * \return un entier contenant le nombre de membres
+ */
+unsigned int Annuaire::reqNbMembres() const
+{
+	return m_registre->reqNbMembres();
+}
+
+/**
+ * \brief Retourne un membre de l'annuaire selon sa position
+ * 		  Les membres sont rangés dans leur ordre d'ajout, que des membres aient été retirés ou non.
+ * \param[in] p_indice est la position du membre, doit être plus petit que reqNbMembres()
+ * \return une référence constante vers le membre
+ */
+const Personne& Annuaire::reqMembre(unsigned int p_indice) const
+{
+	PRECONDITION(p_indice < reqNbMembres());
+	return *m_registre->reqMembre(p_indice);
+}
+
+/**
+ * \brief Vérifie si une personne égale (au sens de Personne::operator==) est déjà membre du club
+ * \param[in] p_personne est un objet Personne à rechercher
+ * \return un booléen indiquant si la personne est déjà présente
+ */
+bool Annuaire::personneEstDejaPresente(const Personne& p_personne) const
+{
+	return trouverPersonne(p_personne.reqNom(), p_personne.reqPrenom(), p_personne.reqDateNaissance()) != nullptr;
+}
+
+/**
+ * \brief Recherche un membre par son identité à l'aide de l'index de hachage
+ * \param[in] p_nom est le nom du membre recherché
+ * \param[in] p_prenom est le prénom du membre recherché
+ * \param[in] p_dateNaissance est la date de naissance du membre recherché
+ * \return un pointeur vers le membre trouvé ou nullptr s'il est absent
+ */
+const Personne* Annuaire::trouverPersonne(const std::string& p_nom, const std::string& p_prenom,
+										   const util::Date& p_dateNaissance) const
+{
+	return m_registre->trouver(p_nom, p_prenom, p_dateNaissance);
+}
+
+/**
+ * \brief Recherche les membres ayant un numéro de téléphone donné à l'aide de l'index de hachage
+ * \param[in] p_telephone est le numéro de téléphone recherché
+ * \return un vector contenant les membres trouvés, dans un ordre quelconque
+ */
+std::vector<const Personne*> Annuaire::trouverParTelephone(const std::string& p_telephone) const
+{
+	std::vector<const Personne*> vTrouves;
+
+	const std::vector<Personne*>& vMembres = m_registre->m_vMembres;
+	m_registre->m_indexTelephone.parcourir(hacherTelephone(p_telephone), [&](std::uint32_t p_position)
+	{
+		if (vMembres[p_position]->reqTelephone() == p_telephone)
+		{
+			vTrouves.push_back(vMembres[p_position]);
+		}
+		return true;
+	});
+
+	return vTrouves;
+}
+
+/**
+ * \brief Recherche un entraineur par son numéro de RAMQ à l'aide de l'index de hachage
+ * \param[in] p_numRAMQ est le numéro de RAMQ recherché, sans égard à la casse
+ * \return un pointeur vers l'entraineur trouvé ou nullptr s'il est absent
+ */
+const Entraineur* Annuaire::trouverParNumRAMQ(const std::string& p_numRAMQ) const
+{
+	const Entraineur* trouve = nullptr;
+
+	const std::vector<Personne*>& vMembres = m_registre->m_vMembres;
+	m_registre->m_indexRAMQ.parcourir(hacherNumRAMQ(p_numRAMQ), [&](std::uint32_t p_position)
+	{
+		// Seuls les entraineurs sont indexés par numéro de RAMQ
+		const Entraineur* entraineur = static_cast<const Entraineur*>(vMembres[p_position]);
+		if (memeNumRAMQ(entraineur->reqNumRAMQ(), p_numRAMQ))
+		{
+			trouve = entraineur;
+		}
+		return trouve == nullptr;
+	});
+
+	return trouve;
+}
+
+/**
+ * \brief Recherche les membres nés dans un intervalle de dates à l'aide de l'index ordonné, en
+ * 		  O(log n + k) pour k membres trouvés
+ * \param[in] p_debut est la première date de naissance retenue
+ * \param[in] p_fin est la dernière date de naissance retenue, ne doit pas précéder p_debut
+ * \return un vector contenant les membres trouvés, par date de naissance croissante
+ */
+std::vector<const Personne*> Annuaire::trouverParNaissance(const util::Date& p_debut, const util::Date& p_fin) const
+{
+	PRECONDITION(!(p_fin < p_debut));
+
+	std::vector<const Personne*> vTrouves;
+	m_registre->m_indexNaissance.collecter(p_debut.reqJoursEpoque(), p_fin.reqJoursEpoque(), vTrouves);
+	return vTrouves;
+}
+
+/**
+ * \brief Recherche les membres qui atteignent un âge après une date et au plus tard à une autre,
+ * 		  à l'aide de l'index ordonné, en O(log n + k) pour k membres trouvés. Les joueurs qui
+ * 		  dépassent l'âge maximal d'ici une date sont, par exemple, ceux qui atteignent
+ * 		  AGE_MAXIMAL_JOUEUR + 1 ans entre aujourd'hui et cette date. Un membre né un 29 février
+ * 		  atteint son âge le 1er mars des années non bissextiles (voir BornesAge::joursNaissanceLimite()).
+ * \param[in] p_age est l'âge franchi, en années, positif
+ * \param[in] p_debut est la date à laquelle les membres retenus n'ont pas encore l'âge p_age
+ * \param[in] p_fin est la date à laquelle les membres retenus ont l'âge p_age, ne doit pas précéder p_debut
+ * \return un vector contenant les membres trouvés, par date de naissance croissante
+ */
+std::vector<const Personne*> Annuaire::trouverFranchissementAge(int p_age, const util::Date& p_debut,
+																 const util::Date& p_fin) const
+{
+	PRECONDITION(p_age > 0);
+	PRECONDITION(!(p_fin < p_debut));
+
+	std::vector<const Personne*> vTrouves;
+	m_registre->m_indexNaissance.collecter(BornesAge::joursNaissanceLimite(p_debut, p_age) + 1,
+										   BornesAge::joursNaissanceLimite(p_fin, p_age), vTrouves);
+	return vTrouves;
+}
+
+/**
+ * \brief Recherche les premiers membres dont le nom ou le prénom commence par un préfixe, à
+ * 		  l'aide de l'index des noms, en O(log n + k) pour k membres retournés
+ * \param[in] p_prefixe est le début de nom ou de prénom recherché, sans égard à la casse ni aux
+ * 			  accents : "gag", "GAG" et "Gâg" trouvent Gagnon
+ * \param[in] p_nbResultats est le nombre maximal de membres retournés, plus grand que 0
+ * \return un vector contenant au plus p_nbResultats membres, chacun une seule fois, par ordre
+ * 		   alphabétique du nom ou du prénom qui commence par p_prefixe
+ */
+std::vector<const Personne*> Annuaire::trouverParPrefixe(const std::string& p_prefixe, unsigned int p_nbResultats) const
+{
+	PRECONDITION(p_nbResultats > 0);
+
+	return m_registre->m_indexNoms.trouver(p_prefixe, p_nbResultats);
+}
+
+/**
+ * \brief Retourne les membres retenus par une requête
+ * 		  Les membres sont parcourus une seule fois : seulement ceux dont le nom commence par
+ * 		  le préfixe de la requête dans l'index des noms quand elle en a un, sinon seulement
+ * 		  ceux de l'intervalle de l'index des dates de naissance quand elle filtre les dates de
+ * 		  naissance, sinon tous les membres. Sans tri, le parcours s'arrête dès que la limite
+ * 		  de la requête est atteinte ; avec un tri et une limite, seuls les premiers résultats
+ * 		  sont triés (std::partial_sort).
+ * \param[in] p_requete est la requête à exécuter
+ * \return un vector contenant des pointeurs vers les membres retenus, valides tant que l'annuaire
+ * 		   n'est pas modifié, dans l'ordre du tri de la requête ou dans un ordre quelconque sans tri
+ */
+std::vector<const Personne*> Annuaire::executerRequete(const RequeteAnnuaire& p_requete) const
+{
+	std::vector<const Personne*> vResultats;
+	std::size_t limite = p_requete.reqLimite();
+	std::size_t limiteParcours = p_requete.estTriee() ? m_registre->m_vMembres.size() : limite;
+
+	// Retient un membre s'il satisfait la requête, et indique si le parcours doit continuer
+	auto retenir = [&p_requete, &vResultats, limiteParcours](const Personne* p_membre)
+	{
+		if (p_requete.accepte(*p_membre))
+		{
+			vResultats.push_back(p_membre);
+		}
+		return vResultats.size() < limiteParcours;
+	};
+
+	if (!p_requete.reqPrefixeNom().empty())
 	{
-		delete vPersonne[i];
+		m_registre->m_indexNoms.parcourir(p_requete.reqPrefixeNom(), [&retenir](const Personne* p_membre, bool p_prenom)
+		{
+			return p_prenom || retenir(p_membre);
+		});
 	}
+	else if (p_requete.estFiltreeParNaissance())
+	{
+		m_registre->m_indexNaissance.parcourir(p_requete.reqNaissanceDebut().reqJoursEpoque(),
+											   p_requete.reqNaissanceFin().reqJoursEpoque(), retenir);
+	}
+	else
+	{
+		const std::vector<Personne*>& vMembres = m_registre->m_vMembres;
+		bool continuer = true;
+		for (auto it = vMembres.begin(); continuer && it != vMembres.end(); ++it)
+		{
+			continuer = *it == nullptr || retenir(*it);
+		}
+	}
+
+	if (p_requete.estTriee())
+	{
+		auto precede = [&p_requete](const Personne* p_personneA, const Personne* p_personneB)
+		{
+			return p_requete.precede(*p_personneA, *p_personneB);
+		};
+
+		if (vResultats.size() > limite)
+		{
+			std::partial_sort(vResultats.begin(), vResultats.begin() + limite, vResultats.end(), precede);
+			vResultats.resize(limite);
+		}
+		else
+		{
+			std::sort(vResultats.begin(), vResultats.end(), precede);
+		}
+	}
+
+	POSTCONDITION(vResultats.size() <= p_requete.reqLimite());
+	return vResultats;
+}
+
+/**
+ * \brief Écrit les champs projetés des membres retenus par une requête, un membre par ligne
+ * 		  (voir RequeteAnnuaire::formaterProjection()). Un même tampon est réutilisé d'un membre à l'autre.
+ * \param[in] p_requete est la requête à exécuter
+ * \param[in,out] p_os est le flux dans lequel les résultats sont écrits
+ */
+void Annuaire::ecrireRequete(const RequeteAnnuaire& p_requete, std::ostream& p_os) const
+{
+	util::TamponFormatage tampon;
+	for (const Personne* membre : executerRequete(p_requete))
+	{
+		p_requete.formaterProjection(*membre, tampon);
+		tampon.ecrire(p_os);
+		tampon.vider();
+	}
+}
+
+/**
+ * \brief Sauvegarde l'annuaire dans un fichier d'instantané binaire
+ * \param[in] p_fichier est le chemin du fichier à créer ou à remplacer
+ * \return un booléen indiquant si l'instantané a été écrit au complet
+ */
+bool Annuaire::sauvegarder(const std::string& p_fichier) const
+{
+	std::ofstream sortie(p_fichier.c_str(), std::ios::binary | std::ios::trunc);
+	bool sauvegarde = sortie.is_open() && sauvegarder(sortie);
+	sortie.close();
+	return sauvegarde && !sortie.fail();
+}
+
+/**
+ * \brief Écrit l'annuaire dans un flux binaire au format d'instantané (voir InstantaneAnnuaire.h)
+ * 		  Les chaînes sont dédupliquées et triées dans une table, les membres sont écrits en fiches
+ * 		  de taille fixe, suivies des permutations par téléphone, par identité et, pour les
+ * 		  entraineurs, par numéro de RAMQ, qui permettent les recherches dichotomiques
+ * 		  directement dans l'instantané.
+ * \param[in,out] p_os est le flux binaire dans lequel l'instantané est écrit
+ * \return un booléen indiquant si le flux est resté valide
+ */
+bool Annuaire::sauvegarder(std::ostream& p_os) const
+{
+	std::vector<const Personne*> vMembres = m_registre->reqMembresPresents();
+	std::uint32_t nbMembres = vMembres.size();
+	std::vector<MembreInstantane> vFiches(nbMembres);
+	std::vector<const std::string*> vChaines;
+	vChaines.reserve(3 * nbMembres + 1);
+
+	EnteteInstantane entete = EnteteInstantane();
+	vChaines.push_back(&m_nomClub);
+
+	for (std::uint32_t i = 0; i < nbMembres; i++)
+	{
+		const Personne* membre = vMembres[i];
+		MembreInstantane& fiche = vFiches[i];
+		fiche.m_telephone = AnnuaireColonnes::encoderTelephone(membre->reqTelephone());
+		fiche.m_joursNaissance = membre->reqDateNaissance().reqJoursEpoque();
+		vChaines.push_back(&membre->reqNom());
+		vChaines.push_back(&membre->reqPrenom());
+
+		const Joueur* joueur = dynamic_cast<const Joueur*>(membre);
+		if (joueur != nullptr)
+		{
+			fiche.m_role = ROLE_INSTANTANE_JOUEUR;
+			fiche.m_sexe = ' ';
+			vChaines.push_back(&joueur->reqPosition());
+		}
+		else
+		{
+			const Entraineur& entraineur = dynamic_cast<const Entraineur&>(*membre);
+			fiche.m_role = ROLE_INSTANTANE_ENTRAINEUR;
+			fiche.m_sexe = entraineur.reqSexe();
+			vChaines.push_back(&entraineur.reqNumRAMQ());
+		}
+	}
+
+	// Table des chaînes triée et sans doublon : l'ordre des identifiants est celui des chaînes
+	std::vector<std::uint32_t> vIds;
+	std::vector<std::uint32_t> vIndexChaines;
+	std::string texte;
+	construireTableChaines(vChaines, vIds, vIndexChaines, texte);
+	entete.m_idNomClub = vIds[0];
+	for (std::uint32_t i = 0; i < nbMembres; i++)
+	{
+		vFiches[i].m_idNom = vIds[3 * i + 1];
+		vFiches[i].m_idPrenom = vIds[3 * i + 2];
+		vFiches[i].m_idSpecifique = vIds[3 * i + 3];
+	}
+
+	// Les permutations sont triées par base sur des clés contiguës, plutôt qu'en comparant les
+	// fiches : par téléphone, puis par identité en triant sur le prénom et la date avant le nom
+	std::uint64_t maxChaine = vIndexChaines.size() - 2;
+	std::vector<CleOrdre> vCles(nbMembres);
+	std::uint64_t maxTelephone = 0;
+	for (std::uint32_t i = 0; i < nbMembres; i++)
+	{
+		vCles[i] = CleOrdre { vFiches[i].m_telephone, i };
+		maxTelephone = std::max(maxTelephone, vFiches[i].m_telephone);
+	}
+	trierCles(vCles, maxTelephone);
+	std::vector<std::uint32_t> vOrdreTelephone(nbMembres);
+	for (std::uint32_t i = 0; i < nbMembres; i++)
+	{
+		vOrdreTelephone[i] = vCles[i].m_position;
+		vCles[i] = CleOrdre { static_cast<std::uint64_t>(vFiches[i].m_idPrenom) << 16 | vFiches[i].m_joursNaissance, i };
+	}
+	trierCles(vCles, maxChaine << 16 | 0xFFFF);
+	for (CleOrdre& cle : vCles)
+	{
+		cle.m_cle = vFiches[cle.m_position].m_idNom;
+	}
+	trierCles(vCles, maxChaine);
+	std::vector<std::uint32_t> vOrdreIdentite(nbMembres);
+	for (std::uint32_t i = 0; i < nbMembres; i++)
+	{
+		vOrdreIdentite[i] = vCles[i].m_position;
+	}
+
+	// Seuls les entraineurs ont un numéro de RAMQ, ordonné en majuscules comme la recherche
+	std::vector<std::pair<std::string, std::uint32_t>> vNumerosRAMQ;
+	for (std::uint32_t i = 0; i < nbMembres; i++)
+	{
+		if (vFiches[i].m_role == ROLE_INSTANTANE_ENTRAINEUR)
+		{
+			vNumerosRAMQ.emplace_back(majusculesNumRAMQ(*vChaines[3 * i + 3]), i);
+		}
+	}
+	std::sort(vNumerosRAMQ.begin(), vNumerosRAMQ.end());
+	std::vector<std::uint32_t> vOrdreRAMQ(vNumerosRAMQ.size());
+	for (std::size_t i = 0; i < vNumerosRAMQ.size(); i++)
+	{
+		vOrdreRAMQ[i] = vNumerosRAMQ[i].second;
+	}
+
+	std::copy(SIGNATURE_INSTANTANE, SIGNATURE_INSTANTANE + sizeof(SIGNATURE_INSTANTANE), entete.m_signature);
+	entete.m_version = VERSION_INSTANTANE;
+	entete.m_marqueOctets = MARQUE_OCTETS_INSTANTANE;
+	entete.m_nbMembres = nbMembres;
+	entete.m_nbChaines = vIndexChaines.size() - 1;
+	entete.m_nbEntraineurs = vOrdreRAMQ.size();
+	entete.m_decalageMembres = VueInstantane::aligner(sizeof(EnteteInstantane));
+	entete.m_decalageOrdreTelephone = VueInstantane::aligner(entete.m_decalageMembres + vFiches.size() * sizeof(MembreInstantane));
+	entete.m_decalageOrdreIdentite = VueInstantane::aligner(entete.m_decalageOrdreTelephone + nbMembres * sizeof(std::uint32_t));
+	entete.m_decalageOrdreRAMQ = VueInstantane::aligner(entete.m_decalageOrdreIdentite + nbMembres * sizeof(std::uint32_t));
+	entete.m_decalageIndexChaines = VueInstantane::aligner(entete.m_decalageOrdreRAMQ + vOrdreRAMQ.size() * sizeof(std::uint32_t));
+	entete.m_decalageTexte = VueInstantane::aligner(entete.m_decalageIndexChaines + vIndexChaines.size() * sizeof(std::uint32_t));
+	entete.m_tailleTexte = texte.length();
+	entete.m_tailleFichier = entete.m_decalageTexte + entete.m_tailleTexte;
+
+	std::size_t position = sizeof(EnteteInstantane);
+	p_os.write(reinterpret_cast<const char*>(&entete), sizeof(EnteteInstantane));
+	alignerSection(p_os, position);
+	ecrireSection(p_os, position, vFiches);
+	alignerSection(p_os, position);
+	ecrireSection(p_os, position, vOrdreTelephone);
+	alignerSection(p_os, position);
+	ecrireSection(p_os, position, vOrdreIdentite);
+	alignerSection(p_os, position);
+	ecrireSection(p_os, position, vOrdreRAMQ);
+	alignerSection(p_os, position);
+	ecrireSection(p_os, position, vIndexChaines);
+	alignerSection(p_os, position);
+	p_os.write(texte.data(), texte.length());
+
+	return static_cast<bool>(p_os);
+}
+
+/**
+ * \brief Remplace le contenu de l'annuaire par celui d'un fichier d'instantané
+ * 		  Le fichier est projeté en mémoire et sa structure est vérifiée avant toute modification :
+ * 		  si le fichier est absent ou mal formé, l'annuaire est laissé intact. Les membres sont
+ * 		  reconstruits sans revalidation, puisqu'ils l'ont été avant la sauvegarde.
+ * \param[in] p_fichier est le chemin d'un fichier écrit par sauvegarder()
+ * \return un booléen indiquant si l'instantané a été chargé
+ */
+bool Annuaire::charger(const std::string& p_fichier)
+{
+	util::FichierProjete fichier;
+	VueInstantane vue;
+	bool charge = fichier.ouvrir(p_fichier) && vue.ouvrir(fichier.reqDonnees(), fichier.reqTaille());
+
+	if (charge)
+	{
+		chargerInstantane(vue);
+	}
+
+	return charge;
+}
+
+/**
+ * \brief Remplace les membres de l'annuaire par ceux d'un instantané déjà vérifié
+ * 		  Les membres sont reconstruits dans un nouveau registre : les copies qui partageaient
+ * 		  l'ancien le conservent. Les index sont construits d'un bloc une fois tous les membres
+ * 		  lus, plutôt qu'un membre à la fois.
+ * \param[in] p_vue est une vue ouverte sur l'instantané
+ */
+void Annuaire::chargerInstantane(const VueInstantane& p_vue)
+{
+	PRECONDITION(p_vue.estOuverte());
+
+	std::shared_ptr<RegistreMembres> registre = std::make_shared<RegistreMembres>();
+	unsigned int nbMembres = p_vue.reqNbMembres();
+	registre->m_vMembres.reserve(nbMembres);
+
+	for (unsigned int i = 0; i < nbMembres; i++)
+	{
+		const MembreInstantane& fiche = p_vue.reqMembre(i);
+		util::Date dateNaissance = util::Date::dateDepuisJoursEpoque(fiche.m_joursNaissance);
+		std::string telephone = AnnuaireColonnes::decoderTelephone(fiche.m_telephone);
+
+		Personne* membre;
+		if (fiche.m_role == ROLE_INSTANTANE_JOUEUR)
+		{
+			membre = new (registre->m_arena.allouer(sizeof(Joueur), alignof(Joueur)))
+					Joueur(p_vue.reqChaine(fiche.m_idNom).reqTexte(), p_vue.reqChaine(fiche.m_idPrenom).reqTexte(),
+						   dateNaissance, telephone, p_vue.reqChaine(fiche.m_idSpecifique).reqTexte(), SansValidation());
+		}
+		else
+		{
+			membre = new (registre->m_arena.allouer(sizeof(Entraineur), alignof(Entraineur)))
+					Entraineur(p_vue.reqChaine(fiche.m_idNom).reqTexte(), p_vue.reqChaine(fiche.m_idPrenom).reqTexte(),
+							   dateNaissance, telephone, p_vue.reqChaine(fiche.m_idSpecifique).reqTexte(), fiche.m_sexe,
+							   SansValidation());
+		}
+		registre->m_vMembres.push_back(membre);
+	}
+	registre->construireIndexHachage();
+	registre->construireIndexOrdonnes();
+
+	m_nomClub = p_vue.reqNomClub().reqTexte();
+	annoterLiberation(m_registre.get());
+	m_registre = std::move(registre);
+
+	POSTCONDITION(reqNbMembres() == nbMembres);
+}
+
+/**
+ * \brief Retourne le registre vide partagé par tous les annuaires sans membre
+ * 		  Ce registre n'est jamais modifié : il est toujours partagé par cette fonction et est
+ * 		  donc dupliqué avant tout ajout.
+ * \return le pointeur partagé vers le registre vide
+ */
+const std::shared_ptr<Annuaire::RegistreMembres>& Annuaire::registreVide()
+{
+	static const std::shared_ptr<RegistreMembres> vide = std::make_shared<RegistreMembres>();
+	return vide;
+}
+
+/**
+ * \brief Retourne le registre de l'annuaire pour le modifier, après l'avoir dupliqué s'il
+ * 		  est partagé avec une autre copie
+ * 		  use_count() est une lecture relâchée du compteur : une copie détruite par un autre fil
+ * 		  a pu lire le registre juste avant de libérer sa référence, ce qui décrémente le
+ * 		  compteur avec libération. La barrière d'acquisition qui suit la lecture du compteur
+ * 		  ordonne ces lectures avant nos écritures. ThreadSanitizer ne modélise pas les
+ * 		  barrières : la paire libération/acquisition lui est annoncée explicitement (voir
+ * 		  annoterLiberation() et barriereAcquisition()).
+ * \return une référence vers un registre qui n'appartient qu'à l'annuaire courant
+ */
+Annuaire::RegistreMembres& Annuaire::registreModifiable()
+{
+	if (m_registre.use_count() != 1)
+	{
+		std::shared_ptr<RegistreMembres> copie = std::make_shared<RegistreMembres>(*m_registre);
+		annoterLiberation(m_registre.get());
+		m_registre = std::move(copie);
+	}
+	else
+	{
+		barriereAcquisition(m_registre.get());
+	}
+
+	POSTCONDITION(m_registre.use_count() == 1);
+	return *m_registre;
+}
+
+/**
+ * \brief surcharge de l'opérateur =
+ * 		  Le registre de p_annuaire est partagé, celui de l'annuaire courant est détruit s'il
+ * 		  n'était partagé avec aucune autre copie.
+ * \param[in] p_annuaire est un objet Annuaire
+ * \return l'annuaire courant
+ */
+Annuaire& Annuaire::operator=(const Annuaire& p_annuaire)
+{
+	if (this != &p_annuaire)
+	{
+		m_nomClub = p_annuaire.m_nomClub;
+		annoterLiberation(m_registre.get());
+		m_registre = p_annuaire.m_registre;
+	}
+	return *this;
+}
+
+/**
+ * \brief Assignation par déplacement
+ * 		  Le registre de p_annuaire est repris sans copie, celui de l'annuaire courant est
+ * 		  détruit s'il n'était partagé avec aucune autre copie.
+ * \param[in,out] p_annuaire est l'annuaire repris, qui reste vide
+ * \return l'annuaire courant
+ */
+Annuaire& Annuaire::operator=(Annuaire&& p_annuaire) noexcept
+{
+	if (this != &p_annuaire)
+	{
+		m_nomClub = std::move(p_annuaire.m_nomClub);
+		annoterLiberation(m_registre.get());
+		m_registre = std::move(p_annuaire.m_registre);
+		p_annuaire.m_registre = registreVide();
+	}
+	return *this;
+}
+
+/**
+ * \brief Destructeur, le registre est détruit avec la dernière copie qui le partage
+ */
+Annuaire::~Annuaire()
+{
+	annoterLiberation(m_registre.get());
 }
 }
@@ -11,8 +11,10 @@
 
 #include "Date.h"
 #include <vector>
+#include <memory>
 #include "ContratException.h"
 #include "Personne.h"
+#include "Entraineur.h"
 
 /**
  * \namespace Hockey
@@ -20,35 +22,96 @@
  */
 namespace hockey
 {
+class VueInstantane;
+class RequeteAnnuaire;
 
 /**
  * \class Annuaire
  * \brief Cette classe permet le stockage de joueurs et d'entraineurs dans un vector
  *
- * 		On peut ajouter un membre à l'annuaire avec la méthode ajouterPersonne()
+ * 		On peut ajouter un membre à l'annuaire avec la méthode ajouterPersonne(), ou
+ * 		ajouterPersonneSiAbsente() qui ne le recherche qu'une fois, et le retirer avec
+ * 		retirerPersonne(), en temps constant amorti. Le retrait garde l'ordre des autres
+ * 		membres : reqMembre() et reqAnnuaireFormate() suivent toujours l'ordre d'ajout. Le
+ * 		membre retiré laisse une case vide, et les cases vides sont supprimées d'un bloc quand
+ * 		elles deviennent trop nombreuses. Les recherches par identité (nom, prénom,
+ * 		date de naissance), par téléphone et par numéro de RAMQ passent par des index
+ * 		de hachage maintenus à chaque ajout et retrait. Un index ordonné sur la date de
+ * 		naissance sert les recherches par intervalle de dates (trouverParNaissance()) et
+ * 		par âge atteint entre deux dates (trouverFranchissementAge()), et un index ordonné sur
+ * 		les noms et prénoms sert l'autocomplétion par début de nom, sans égard à la casse ni
+ * 		aux accents (trouverParPrefixe()). Les membres sont clonés dans
+ * 		une arène propre à l'annuaire, libérée d'un bloc à la destruction.
+ * 		sauvegarder() écrit l'annuaire dans un instantané binaire (voir InstantaneAnnuaire.h)
+ * 		que charger() relit sans revalider les membres.
+ * 		executerRequete() filtre, trie et limite les membres selon une RequeteAnnuaire en un seul
+ * 		parcours, sans copier de membre ; ecrireRequete() écrit les champs projetés des résultats.
+ * 		Un annuaire déplacé cède son arène, ses membres et ses index sans allouer ni copier
+ * 		un seul membre ; l'annuaire d'origine reste vide et utilisable.
  *
- * 		Attributs: m_vMembres: un vector de Personne contenant les personnes membres du club
- * 				   m_nomClub : un string contenant le nom du club
+ * 		Les membres, leurs index et leur arène forment un registre partagé entre les copies
+ * 		d'un annuaire : copier un annuaire ne copie aucun membre. Le registre n'est dupliqué
+ * 		qu'à la première modification d'un annuaire qui le partage (ajouterPersonne(),
+ * 		retirerPersonne(), asgTelephoneMembre()), les autres copies gardent alors l'ancien
+ * 		registre intact. Les références retournées par un annuaire restent valides tant que
+ * 		cet annuaire n'est pas modifié ou tant qu'une copie partage encore l'ancien registre.
+ * 		Des copies distinctes d'un même annuaire peuvent être lues et modifiées par des
+ * 		fils d'exécution différents ; un même annuaire ne doit pas être modifié pendant
+ * 		qu'il est lu ou copié.
+ *
+ * 		Attributs: m_nomClub : un string contenant le nom du club
+ * 				   m_registre : le registre des membres, partagé entre les copies de l'annuaire
  */
 class Annuaire
 {
 public:
-	Annuaire(const std::string p_nomClub);
+	Annuaire(std::string p_nomClub);
 	Annuaire(const Annuaire& p_annuaire);
+	Annuaire(Annuaire&& p_annuaire) noexcept;
 
-	const std::string reqNomClub() const;
-	const std::string reqAnnuaireFormate() const;
+	const std::string& reqNomClub() const;
+	std::string reqAnnuaireFormate() const;
+	void ecrireAnnuaireFormate(std::ostream& p_os) const;
 	void ajouterPersonne (const Personne& p_personne);
+	bool ajouterPersonneSiAbsente(const Personne& p_personne);
+	bool ajouterPersonneSiAbsente(Personne&& p_personne);
+	bool retirerPersonne(const Personne& p_personne);
+	bool asgTelephoneMembre(const Personne& p_personne, const std::string& p_telephone);
 
-	void operator=(const Annuaire& p_annuaire);
+	unsigned int reqNbMembres() const;
+	const Personne& reqMembre(unsigned int p_indice) const;
 
-	~Annuaire();
+	bool personneEstDejaPresente(const Personne& p_personne) const;
+	const Personne* trouverPersonne(const std::string& p_nom, const std::string& p_prenom,
+									const util::Date& p_dateNaissance) const;
+	std::vector<const Personne*> trouverParTelephone(const std::string& p_telephone) const;
+	const Entraineur* trouverParNumRAMQ(const std::string& p_numRAMQ) const;
+	std::vector<const Personne*> trouverParNaissance(const util::Date& p_debut, const util::Date& p_fin) const;
+	std::vector<const Personne*> trouverFranchissementAge(int p_age, const util::Date& p_debut, const util::Date& p_fin) const;
+	std::vector<const Personne*> trouverParPrefixe(const std::string& p_prefixe, unsigned int p_nbResultats) const;
+
+	std::vector<const Personne*> executerRequete(const RequeteAnnuaire& p_requete) const;
+	void ecrireRequete(const RequeteAnnuaire& p_requete, std::ostream& p_os) const;
+
+	bool sauvegarder(const std::string& p_fichier) const;
+	bool sauvegarder(std::ostream& p_os) const;
+	bool charger(const std::string& p_fichier);
 
-	std::vector<Personne*> m_vMembres;
+	Annuaire& operator=(const Annuaire& p_annuaire);
+	Annuaire& operator=(Annuaire&& p_annuaire) noexcept;
+
+	~Annuaire();
 
 private:
+	struct RegistreMembres;
+
+	static const std::shared_ptr<RegistreMembres>& registreVide();
+	RegistreMembres& registreModifiable();
+	void chargerInstantane(const VueInstantane& p_vue);
 	void verifieInvariantAnnuaire() const;
+
 	std::string m_nomClub;
+	std::shared_ptr<RegistreMembres> m_registre;
 };
 
 }
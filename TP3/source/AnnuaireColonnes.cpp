@@ -0,0 +1,372 @@
+/**
+ * \file AnnuaireColonnes.cpp
+ * \brief Fichier d'implementation des classes AnnuaireColonnes et MembreVue
+ * \author David Jalbert Ross
+ * \version 1.0
+ * \date 16 avril 2020
+ */
+
+#include "AnnuaireColonnes.h"
+#include "Annuaire.h"
+#include "Joueur.h"
+#include "Entraineur.h"
+#include <functional>
+
+using namespace std;
+
+namespace hockey
+{
+
+/**
+ * \brief Constructeur avec paramètres
+ * 		  On construit une vue sur un membre d'un annuaire en colonnes
+ * \param[in] p_colonnes est l'annuaire en colonnes consulté
+ * \param[in] p_indice est la position du membre, doit être plus petit que le nombre de membres
+ */
+MembreVue::MembreVue(const AnnuaireColonnes& p_colonnes, unsigned int p_indice):
+		m_colonnes(&p_colonnes), m_indice(p_indice)
+{
+	PRECONDITION(p_indice < p_colonnes.reqNbMembres());
+}
+
+/**
+ * \brief Retourne le nom du membre
+ * \return un string contenant le nom du membre
+ */
+const std::string& MembreVue::reqNom() const
+{
+	return m_colonnes->reqChaine(m_colonnes->m_noms[m_indice]);
+}
+
+/**
+ * \brief Retourne le prénom du membre
+ * \return un string contenant le prénom du membre
+ */
+const std::string& MembreVue::reqPrenom() const
+{
+	return m_colonnes->reqChaine(m_colonnes->m_prenoms[m_indice]);
+}
+
+/**
+ * \brief Retourne la date de naissance du membre
+ * \return un objet Date contenant la date de naissance
+ */
+util::Date MembreVue::reqDateNaissance() const
+{
+	return AnnuaireColonnes::decompacterDate(m_colonnes->m_datesNaissance[m_indice]);
+}
+
+/**
+ * \brief Retourne le numéro de téléphone du membre
+ * \return un string contenant le numéro de téléphone au format NNN NNN-NNNN
+ */
+std::string MembreVue::reqTelephone() const
+{
+	return AnnuaireColonnes::decoderTelephone(m_colonnes->m_telephones[m_indice]);
+}
+
+/**
+ * \brief Retourne le rôle du membre
+ * \return l'étiquette de rôle du membre
+ */
+RoleMembre MembreVue::reqRole() const
+{
+	return m_colonnes->m_roles[m_indice];
+}
+
+/**
+ * \brief Indique si le membre est un joueur
+ * \return un booléen indiquant si le membre est un joueur
+ */
+bool MembreVue::estJoueur() const
+{
+	return reqRole() == RoleMembre::Joueur;
+}
+
+/**
+ * \brief Indique si le membre est un entraineur
+ * \return un booléen indiquant si le membre est un entraineur
+ */
+bool MembreVue::estEntraineur() const
+{
+	return reqRole() == RoleMembre::Entraineur;
+}
+
+/**
+ * \brief Retourne la position du joueur
+ * \pre le membre doit être un joueur
+ * \return un string contenant la position du joueur
+ */
+const std::string& MembreVue::reqPosition() const
+{
+	PRECONDITION(estJoueur());
+	return m_colonnes->reqChaine(m_colonnes->m_specifiques[m_indice]);
+}
+
+/**
+ * \brief Retourne le numéro de RAMQ de l'entraineur
+ * \pre le membre doit être un entraineur
+ * \return un string contenant le numéro de RAMQ de l'entraineur
+ */
+const std::string& MembreVue::reqNumRAMQ() const
+{
+	PRECONDITION(estEntraineur());
+	return m_colonnes->reqChaine(m_colonnes->m_specifiques[m_indice]);
+}
+
+/**
+ * \brief Retourne le sexe de l'entraineur
+ * \pre le membre doit être un entraineur
+ * \return un char contenant le sexe de l'entraineur
+ */
+char MembreVue::reqSexe() const
+{
+	PRECONDITION(estEntraineur());
+	return m_colonnes->m_sexes[m_indice];
+}
+
+/**
+ * \brief Constructeur avec paramètres string
+ * 		  On construit un annuaire en colonnes vide avec son nom de club
+ * \param[in] p_nomClub est un string qui contient le nom du club
+ */
+AnnuaireColonnes::AnnuaireColonnes(const std::string& p_nomClub):
+		m_nomClub(p_nomClub)
+{
+	INVARIANTS();
+}
+
+/**
+ * \brief Constructeur avec paramètres Annuaire
+ * 		  On construit un annuaire en colonnes à partir des membres d'un Annuaire, dans le même ordre
+ * \param[in] p_annuaire est un objet Annuaire
+ */
+AnnuaireColonnes::AnnuaireColonnes(const Annuaire& p_annuaire):
+		m_nomClub(p_annuaire.reqNomClub())
+{
+	unsigned int nbMembres = p_annuaire.reqNbMembres();
+
+	m_roles.reserve(nbMembres);
+	m_noms.reserve(nbMembres);
+	m_prenoms.reserve(nbMembres);
+	m_datesNaissance.reserve(nbMembres);
+	m_telephones.reserve(nbMembres);
+	m_specifiques.reserve(nbMembres);
+	m_sexes.reserve(nbMembres);
+
+	for (unsigned int i = 0; i < nbMembres; i++)
+	{
+		ajouterPersonne(p_annuaire.reqMembre(i));
+	}
+
+	POSTCONDITION(reqNbMembres() == nbMembres);
+	INVARIANTS();
+}
+
+/**
+ * \brief Retourne le nom du club
+ * \return un string contenant le nom du club
+ */
+const std::string& AnnuaireColonnes::reqNomClub() const
+{
+	return m_nomClub;
+}
+
+/**
+ * \brief Retourne le nombre de membres
+ * \return un entier contenant le nombre de membres
+ */
+unsigned int AnnuaireColonnes::reqNbMembres() const
+{
+	return m_roles.size();
+}
+
+/**
+ * \brief Retourne une vue sur un membre
+ * \param[in] p_indice est la position du membre, doit être plus petit que reqNbMembres()
+ * \return un objet MembreVue sur le membre
+ */
+MembreVue AnnuaireColonnes::reqMembre(unsigned int p_indice) const
+{
+	return MembreVue(*this, p_indice);
+}
+
+/**
+ * \brief Ajoute un membre à la fin des colonnes
+ * \param[in] p_personne est un objet Joueur ou Entraineur
+ * \pre p_personne doit être un Joueur ou un Entraineur
+ */
+void AnnuaireColonnes::ajouterPersonne(const Personne& p_personne)
+{
+	const Joueur* joueur = dynamic_cast<const Joueur*>(&p_personne);
+	const Entraineur* entraineur = dynamic_cast<const Entraineur*>(&p_personne);
+	PRECONDITION(joueur != nullptr || entraineur != nullptr);
+
+	m_noms.push_back(internerChaine(p_personne.reqNom()));
+	m_prenoms.push_back(internerChaine(p_personne.reqPrenom()));
+	m_datesNaissance.push_back(compacterDate(p_personne.reqDateNaissance()));
+	m_telephones.push_back(encoderTelephone(p_personne.reqTelephone()));
+
+	if (joueur != nullptr)
+	{
+		m_roles.push_back(RoleMembre::Joueur);
+		m_specifiques.push_back(internerChaine(joueur->reqPosition()));
+		m_sexes.push_back(' ');
+	}
+	else
+	{
+		m_roles.push_back(RoleMembre::Entraineur);
+		m_specifiques.push_back(internerChaine(entraineur->reqNumRAMQ()));
+		m_sexes.push_back(entraineur->reqSexe());
+	}
+
+	INVARIANTS();
+}
+
+/**
+ * \brief Retourne la colonne des rôles, pour les balayages
+ * \return une référence constante vers la colonne des rôles
+ */
+const std::vector<RoleMembre>& AnnuaireColonnes::reqColonneRoles() const
+{
+	return m_roles;
+}
+
+/**
+ * \brief Retourne la colonne des dates de naissance compactées, pour les balayages
+ * \return une référence constante vers la colonne des dates compactées (voir compacterDate())
+ */
+const std::vector<std::uint32_t>& AnnuaireColonnes::reqColonneDatesNaissance() const
+{
+	return m_datesNaissance;
+}
+
+/**
+ * \brief Retourne la colonne des téléphones encodés, pour les balayages
+ * \return une référence constante vers la colonne des téléphones encodés (voir encoderTelephone())
+ */
+const std::vector<std::uint64_t>& AnnuaireColonnes::reqColonneTelephones() const
+{
+	return m_telephones;
+}
+
+/**
+ * \brief Retourne une chaîne de la table des chaînes internées
+ * \param[in] p_id est l'identifiant de la chaîne, doit exister dans la table
+ * \return une référence constante vers la chaîne
+ */
+const std::string& AnnuaireColonnes::reqChaine(std::uint32_t p_id) const
+{
+	PRECONDITION(p_id < m_chaines.size());
+	return m_chaines[p_id];
+}
+
+/**
+ * \brief Compacte une date en un entier dont l'ordre est celui des dates
+ * 		  Format : annee << 9 | mois << 5 | jour
+ * \param[in] p_date est la date à compacter
+ * \return un entier contenant la date compactée
+ */
+std::uint32_t AnnuaireColonnes::compacterDate(const util::Date& p_date)
+{
+	return (static_cast<std::uint32_t>(p_date.reqAnnee()) << 9) | (static_cast<std::uint32_t>(p_date.reqMois()) << 5)
+			| static_cast<std::uint32_t>(p_date.reqJour());
+}
+
+/**
+ * \brief Reconstruit une date compactée par compacterDate()
+ * \param[in] p_dateCompacte est la date compactée
+ * \return un objet Date
+ */
+util::Date AnnuaireColonnes::decompacterDate(std::uint32_t p_dateCompacte)
+{
+	return util::Date(p_dateCompacte & 0x1F, (p_dateCompacte >> 5) & 0x0F, p_dateCompacte >> 9);
+}
+
+/**
+ * \brief Encode un numéro de téléphone NNN NNN-NNNN en entier
+ * \param[in] p_telephone est le numéro de téléphone, doit avoir le format NNN NNN-NNNN
+ * \return un entier contenant les 10 chiffres du numéro
+ */
+std::uint64_t AnnuaireColonnes::encoderTelephone(const std::string& p_telephone)
+{
+	PRECONDITION(p_telephone.length() == 12);
+
+	std::uint64_t encode = 0;
+	for (std::string::size_type i = 0; i < p_telephone.length(); i++)
+	{
+		if (i != 3 && i != 7)
+		{
+			encode = encode * 10 + (p_telephone[i] - '0');
+		}
+	}
+
+	return encode;
+}
+
+/**
+ * \brief Décode un numéro de téléphone encodé par encoderTelephone()
+ * \param[in] p_telephoneEncode est le numéro encodé
+ * \return un string contenant le numéro au format NNN NNN-NNNN
+ */
+std::string AnnuaireColonnes::decoderTelephone(std::uint64_t p_telephoneEncode)
+{
+	std::string telephone("000 000-0000");
+	for (int i = 11; i >= 0; i--)
+	{
+		if (i != 3 && i != 7)
+		{
+			telephone[i] = static_cast<char>('0' + p_telephoneEncode % 10);
+			p_telephoneEncode /= 10;
+		}
+	}
+
+	return telephone;
+}
+
+/**
+ * \brief Retourne l'identifiant d'une chaîne dans la table des chaînes, en l'y ajoutant au besoin
+ * 		  L'index de hachage ne contient que des identifiants : chaque chaîne n'est conservée
+ * 		  qu'une fois, dans m_chaines, et les candidates d'une même clé y sont comparées.
+ * \param[in] p_chaine est la chaîne à interner
+ * \return l'identifiant de la chaîne
+ */
+std::uint32_t AnnuaireColonnes::internerChaine(const std::string& p_chaine)
+{
+	std::size_t cle = std::hash<std::string>()(p_chaine);
+	std::uint32_t id = IndexHachage::POSITION_VIDE;
+
+	m_indexChaines.parcourir(cle, [this, &p_chaine, &id](std::uint32_t p_id)
+	{
+		if (m_chaines[p_id] == p_chaine)
+		{
+			id = p_id;
+		}
+		return id == IndexHachage::POSITION_VIDE;
+	});
+
+	if (id == IndexHachage::POSITION_VIDE)
+	{
+		id = m_chaines.size();
+		m_chaines.push_back(p_chaine);
+		m_indexChaines.ajouter(cle, id);
+	}
+
+	return id;
+}
+
+/**
+ * \brief Vérification des invariants de la classe AnnuaireColonnes : toutes les colonnes ont la même longueur
+ */
+void AnnuaireColonnes::verifieInvariant() const
+{
+	INVARIANT(m_noms.size() == m_roles.size());
+	INVARIANT(m_prenoms.size() == m_roles.size());
+	INVARIANT(m_datesNaissance.size() == m_roles.size());
+	INVARIANT(m_telephones.size() == m_roles.size());
+	INVARIANT(m_specifiques.size() == m_roles.size());
+	INVARIANT(m_sexes.size() == m_roles.size());
+	INVARIANT(m_indexChaines.reqNbEntrees() == m_chaines.size());
+}
+
+}
@@ -0,0 +1,141 @@
+/**
+ * \file AnnuaireColonnes.h
+ * \brief Fichier contenant l'interface de la classe AnnuaireColonnes, un stockage en colonnes des membres d'un club
+ * \author David Jalbert Ross
+ * \version 1.0
+ * \date 16 avril 2020
+ */
+
+#ifndef ANNUAIRECOLONNES_H_
+#define ANNUAIRECOLONNES_H_
+
+#include "Date.h"
+#include <vector>
+#include <string>
+#include <cstdint>
+#include "ContratException.h"
+#include "Personne.h"
+#include "IndexHachage.h"
+
+/**
+ * \namespace Hockey
+ * \brief Ce namespace contient le code spécifique au développement d'un outils de gestion d'annuaire
+ */
+namespace hockey
+{
+
+class Annuaire;
+class AnnuaireColonnes;
+
+/**
+ * \enum RoleMembre
+ * \brief Étiquette de rôle qui remplace la table virtuelle dans le stockage en colonnes
+ */
+enum class RoleMembre : std::uint8_t
+{
+	Joueur,
+	Entraineur
+};
+
+/**
+ * \class MembreVue
+ * \brief Vue légère sur un membre d'un AnnuaireColonnes
+ *
+ * 		La vue offre les mêmes accesseurs que Joueur et Entraineur, mais lit directement
+ * 		les colonnes de l'annuaire. Elle reste valide tant que l'annuaire n'est pas modifié.
+ *
+ * 		Attributs: m_colonnes: l'annuaire en colonnes consulté
+ * 				   m_indice : la position du membre dans les colonnes
+ */
+class MembreVue
+{
+public:
+	MembreVue(const AnnuaireColonnes& p_colonnes, unsigned int p_indice);
+
+	const std::string& reqNom() const;
+	const std::string& reqPrenom() const;
+	util::Date reqDateNaissance() const;
+	std::string reqTelephone() const;
+
+	RoleMembre reqRole() const;
+	bool estJoueur() const;
+	bool estEntraineur() const;
+
+	const std::string& reqPosition() const;
+	const std::string& reqNumRAMQ() const;
+	char reqSexe() const;
+
+private:
+	const AnnuaireColonnes* m_colonnes;
+	unsigned int m_indice;
+};
+
+/**
+ * \class AnnuaireColonnes
+ * \brief Stockage en colonnes (structure de tableaux) des membres d'un club
+ *
+ * 		Chaque attribut des membres est conservé dans un tableau contigu : les noms, prénoms,
+ * 		positions et numéros de RAMQ sont internés dans une table de chaînes, les dates de
+ * 		naissance sont compactées en un entier ordonné et les téléphones sont encodés en entier.
+ * 		Un balayage des membres devient ainsi un parcours séquentiel de la mémoire.
+ *
+ * 		C'est une copie en lecture d'un Annuaire, construite à partir de lui, et non un mode
+ * 		de stockage interne d'Annuaire : l'interface d'Annuaire retourne des références et des
+ * 		pointeurs vers des Personne (reqMembre(), trouverPersonne(), executerRequete()), que des
+ * 		colonnes ne pourraient fournir qu'en reconstruisant chaque membre. Les balayages
+ * 		construisent donc un AnnuaireColonnes et parcourent ses MembreVue. Annuaire en réutilise
+ * 		l'encodage des téléphones pour ses instantanés.
+ *
+ * 		Attributs: m_nomClub : un string contenant le nom du club
+ * 				   m_chaines : la table des chaînes internées
+ * 				   m_indexChaines : l'index de hachage de la table des chaînes, qui associe le
+ * 				   					hachage d'une chaîne à son identifiant dans m_chaines
+ * 				   m_roles, m_noms, m_prenoms, m_datesNaissance, m_telephones,
+ * 				   m_specifiques, m_sexes : les colonnes, une entrée par membre
+ */
+class AnnuaireColonnes
+{
+public:
+	AnnuaireColonnes(const std::string& p_nomClub);
+	explicit AnnuaireColonnes(const Annuaire& p_annuaire);
+
+	const std::string& reqNomClub() const;
+	unsigned int reqNbMembres() const;
+	MembreVue reqMembre(unsigned int p_indice) const;
+
+	void ajouterPersonne(const Personne& p_personne);
+
+	const std::vector<RoleMembre>& reqColonneRoles() const;
+	const std::vector<std::uint32_t>& reqColonneDatesNaissance() const;
+	const std::vector<std::uint64_t>& reqColonneTelephones() const;
+
+	const std::string& reqChaine(std::uint32_t p_id) const;
+
+	static std::uint32_t compacterDate(const util::Date& p_date);
+	static util::Date decompacterDate(std::uint32_t p_dateCompacte);
+	static std::uint64_t encoderTelephone(const std::string& p_telephone);
+	static std::string decoderTelephone(std::uint64_t p_telephoneEncode);
+
+private:
+	friend class MembreVue;
+
+	std::uint32_t internerChaine(const std::string& p_chaine);
+	void verifieInvariant() const;
+
+	std::string m_nomClub;
+
+	std::vector<std::string> m_chaines;
+	IndexHachage m_indexChaines;
+
+	std::vector<RoleMembre> m_roles;
+	std::vector<std::uint32_t> m_noms;
+	std::vector<std::uint32_t> m_prenoms;
+	std::vector<std::uint32_t> m_datesNaissance;
+	std::vector<std::uint64_t> m_telephones;
+	std::vector<std::uint32_t> m_specifiques;
+	std::vector<char> m_sexes;
+};
+
+}
+
+#endif
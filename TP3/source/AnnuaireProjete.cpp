@@ -0,0 +1,429 @@
+/**
+ * \file AnnuaireProjete.cpp
+ * \brief Fichier d'implementation des classes MembreProjete et AnnuaireProjete
+ * \author David Jalbert Ross
+ * \version 1.0
+ * \date 16 avril 2020
+ */
+
+#include "AnnuaireProjete.h"
+#include <algorithm>
+#include <sstream>
+#include <cctype>
+#include <cstring>
+#include "validationFormat.h"
+
+using namespace std;
+
+namespace
+{
+/**
+ * \brief Compare une chaîne de l'instantané à une chaîne quelconque, octet par octet
+ * \return un entier négatif, nul ou positif, comme std::string::compare()
+ */
+int comparerChaine(const hockey::ChaineInstantane& p_chaine, const std::string& p_autre)
+{
+	std::size_t longueur = std::min(p_chaine.m_longueur, p_autre.length());
+	int resultat = std::memcmp(p_chaine.m_texte, p_autre.data(), longueur);
+	if (resultat == 0 && p_chaine.m_longueur != p_autre.length())
+	{
+		resultat = p_chaine.m_longueur < p_autre.length() ? -1 : 1;
+	}
+	return resultat;
+}
+
+/**
+ * \brief Compare un numéro de RAMQ de l'instantané à un numéro quelconque, sans égard à la casse
+ * \return un entier négatif, nul ou positif, comme comparerChaine() sur les numéros en majuscules
+ */
+int comparerNumRAMQ(const hockey::ChaineInstantane& p_numRAMQ, const std::string& p_autre)
+{
+	std::size_t longueur = std::min(p_numRAMQ.m_longueur, p_autre.length());
+	int resultat = 0;
+	for (std::size_t i = 0; resultat == 0 && i < longueur; i++)
+	{
+		resultat = toupper(static_cast<unsigned char>(p_numRAMQ.m_texte[i]))
+				- toupper(static_cast<unsigned char>(p_autre[i]));
+	}
+	if (resultat == 0 && p_numRAMQ.m_longueur != p_autre.length())
+	{
+		resultat = p_numRAMQ.m_longueur < p_autre.length() ? -1 : 1;
+	}
+	return resultat;
+}
+}
+
+namespace hockey
+{
+
+/**
+ * \brief Constructeur avec paramètres
+ * \param[in] p_vue est une vue ouverte sur l'instantané
+ * \param[in] p_indice est la position du membre, doit être inférieure au nombre de membres
+ */
+MembreProjete::MembreProjete(const VueInstantane& p_vue, unsigned int p_indice):
+		m_vue(&p_vue), m_fiche(&p_vue.reqMembre(p_indice))
+{
+}
+
+/**
+ * \brief Retourne le nom du membre
+ * \return le nom, lu dans l'instantané
+ */
+ChaineInstantane MembreProjete::reqNom() const
+{
+	return m_vue->reqChaine(m_fiche->m_idNom);
+}
+
+/**
+ * \brief Retourne le prénom du membre
+ * \return le prénom, lu dans l'instantané
+ */
+ChaineInstantane MembreProjete::reqPrenom() const
+{
+	return m_vue->reqChaine(m_fiche->m_idPrenom);
+}
+
+/**
+ * \brief Retourne la date de naissance du membre
+ * \return un objet Date contenant la date de naissance
+ */
+util::Date MembreProjete::reqDateNaissance() const
+{
+	return util::Date::dateDepuisJoursEpoque(m_fiche->m_joursNaissance);
+}
+
+/**
+ * \brief Retourne le numéro de téléphone du membre
+ * \return un string contenant le numéro au format NNN NNN-NNNN
+ */
+std::string MembreProjete::reqTelephone() const
+{
+	return AnnuaireColonnes::decoderTelephone(m_fiche->m_telephone);
+}
+
+/**
+ * \brief Retourne le rôle du membre
+ * \return l'étiquette de rôle du membre
+ */
+RoleMembre MembreProjete::reqRole() const
+{
+	return m_fiche->m_role == ROLE_INSTANTANE_JOUEUR ? RoleMembre::Joueur : RoleMembre::Entraineur;
+}
+
+/**
+ * \brief Indique si le membre est un joueur
+ * \return un booléen indiquant si le membre est un joueur
+ */
+bool MembreProjete::estJoueur() const
+{
+	return reqRole() == RoleMembre::Joueur;
+}
+
+/**
+ * \brief Indique si le membre est un entraineur
+ * \return un booléen indiquant si le membre est un entraineur
+ */
+bool MembreProjete::estEntraineur() const
+{
+	return reqRole() == RoleMembre::Entraineur;
+}
+
+/**
+ * \brief Retourne la position d'un joueur
+ * \pre le membre doit être un joueur
+ * \return la position, lue dans l'instantané
+ */
+ChaineInstantane MembreProjete::reqPosition() const
+{
+	PRECONDITION(estJoueur());
+	return m_vue->reqChaine(m_fiche->m_idSpecifique);
+}
+
+/**
+ * \brief Retourne le numéro de RAMQ d'un entraineur
+ * \pre le membre doit être un entraineur
+ * \return le numéro de RAMQ, lu dans l'instantané
+ */
+ChaineInstantane MembreProjete::reqNumRAMQ() const
+{
+	PRECONDITION(estEntraineur());
+	return m_vue->reqChaine(m_fiche->m_idSpecifique);
+}
+
+/**
+ * \brief Retourne le sexe d'un entraineur
+ * \pre le membre doit être un entraineur
+ * \return un char contenant le sexe de l'entraineur
+ */
+char MembreProjete::reqSexe() const
+{
+	PRECONDITION(estEntraineur());
+	return m_fiche->m_sexe;
+}
+
+/**
+ * \brief Ajoute les informations du membre à la fin d'un tampon de formatage, dans le format
+ * 		  de Joueur::formaterPersonne() ou de Entraineur::formaterPersonne()
+ * \param[in,out] p_tampon est le tampon dans lequel les informations sont écrites
+ */
+void MembreProjete::formaterPersonne(util::TamponFormatage& p_tampon) const
+{
+	ChaineInstantane nom = reqNom();
+	ChaineInstantane prenom = reqPrenom();
+	ChaineInstantane specifique = m_vue->reqChaine(m_fiche->m_idSpecifique);
+
+	p_tampon.ajouter("Nom               : ", 20);
+	p_tampon.ajouter(nom.m_texte, nom.m_longueur);
+	p_tampon.ajouter("\nPrenom            : ", 21);
+	p_tampon.ajouter(prenom.m_texte, prenom.m_longueur);
+	p_tampon.ajouter("\nDate de naissance : ", 21);
+	reqDateNaissance().formaterDate(p_tampon);
+	p_tampon.ajouter("\nTelephone         : ", 21);
+	p_tampon.ajouter(reqTelephone());
+	p_tampon.ajouter(estJoueur() ? "\nPosition          : " : "\nNumero de RAMQ    : ", 21);
+	p_tampon.ajouter(specifique.m_texte, specifique.m_longueur);
+	p_tampon.ajouter("\n---------------------\n", 23);
+}
+
+/**
+ * \brief Constructeur par défaut
+ * 		  On construit un annuaire fermé, à ouvrir avec ouvrir()
+ */
+AnnuaireProjete::AnnuaireProjete()
+{
+	INVARIANTS();
+}
+
+/**
+ * \brief Projette un fichier d'instantané en mémoire et en vérifie la structure
+ * 		  L'instantané ouvert précédemment, s'il y en a un, est d'abord fermé.
+ * \param[in] p_fichier est le chemin d'un fichier écrit par Annuaire::sauvegarder()
+ * \return un booléen indiquant si l'instantané a été ouvert
+ */
+bool AnnuaireProjete::ouvrir(const std::string& p_fichier)
+{
+	m_vue = VueInstantane();
+	bool ouvert = m_fichier.ouvrir(p_fichier) && m_vue.ouvrir(m_fichier.reqDonnees(), m_fichier.reqTaille());
+	if (!ouvert)
+	{
+		m_fichier.fermer();
+	}
+
+	INVARIANTS();
+	return ouvert;
+}
+
+/**
+ * \brief Indique si un instantané est ouvert
+ * \return un booléen indiquant si l'annuaire peut être consulté
+ */
+bool AnnuaireProjete::estOuvert() const
+{
+	return m_vue.estOuverte();
+}
+
+/**
+ * \brief Retourne le nom de club associé à l'annuaire
+ * \return un string contenant le nom du club associé à l'annuaire
+ */
+std::string AnnuaireProjete::reqNomClub() const
+{
+	return m_vue.reqNomClub().reqTexte();
+}
+
+/**
+ * \brief Retourne le nombre de membres de l'annuaire
+ * \return un entier contenant le nombre de membres
+ */
+unsigned int AnnuaireProjete::reqNbMembres() const
+{
+	return m_vue.reqNbMembres();
+}
+
+/**
+ * \brief Retourne un membre de l'annuaire selon son ordre d'ajout dans l'annuaire sauvegardé
+ * \param[in] p_indice est la position du membre, doit être plus petit que reqNbMembres()
+ * \return une vue sur le membre
+ */
+MembreProjete AnnuaireProjete::reqMembre(unsigned int p_indice) const
+{
+	PRECONDITION(p_indice < reqNbMembres());
+	return MembreProjete(m_vue, p_indice);
+}
+
+/**
+ * \brief Retourne les informations de l'annuaire dans le format de Annuaire::reqAnnuaireFormate()
+ * \return un string contenant les informations formatées
+ */
+std::string AnnuaireProjete::reqAnnuaireFormate() const
+{
+	ostringstream oss;
+	ecrireAnnuaireFormate(oss);
+	return oss.str();
+}
+
+/**
+ * \brief Écrit les informations de l'annuaire, au format de reqAnnuaireFormate(), directement
+ * 		  dans un flux de sortie, en réutilisant un même tampon d'un membre à l'autre
+ * \param[in,out] p_os est le flux dans lequel les informations sont écrites
+ */
+void AnnuaireProjete::ecrireAnnuaireFormate(std::ostream& p_os) const
+{
+	ChaineInstantane nomClub = m_vue.reqNomClub();
+	util::TamponFormatage tampon;
+	tampon.ajouter("Club   : ", 9);
+	tampon.ajouter(nomClub.m_texte, nomClub.m_longueur);
+	tampon.ajouter("\n--------------------\n", 22);
+	tampon.ecrire(p_os);
+
+	unsigned int nbMembres = reqNbMembres();
+	for (unsigned int i = 0; i < nbMembres; i++)
+	{
+		tampon.vider();
+		MembreProjete(m_vue, i).formaterPersonne(tampon);
+		tampon.ecrire(p_os);
+	}
+}
+
+/**
+ * \brief Recherche un membre par son identité, par dichotomie dans l'ordre par identité de l'instantané
+ * \param[in] p_nom est le nom du membre recherché
+ * \param[in] p_prenom est le prénom du membre recherché
+ * \param[in] p_dateNaissance est la date de naissance du membre recherché
+ * \return la position du membre trouvé, utilisable avec reqMembre(), ou -1 s'il est absent
+ */
+int AnnuaireProjete::trouverPersonne(const std::string& p_nom, const std::string& p_prenom,
+									  const util::Date& p_dateNaissance) const
+{
+	PRECONDITION(estOuvert());
+
+	int trouve = -1;
+	std::uint32_t idNom;
+	std::uint32_t idPrenom;
+	if (trouverChaine(p_nom, idNom) && trouverChaine(p_prenom, idPrenom))
+	{
+		const std::uint32_t* debut = m_vue.reqOrdreIdentite();
+		const std::uint32_t* fin = debut + reqNbMembres();
+		long jours = p_dateNaissance.reqJoursEpoque();
+
+		const std::uint32_t* position = std::lower_bound(debut, fin, 0u, [&](std::uint32_t p_indice, std::uint32_t)
+		{
+			const MembreInstantane& m = m_vue.reqMembre(p_indice);
+			if (m.m_idNom != idNom)
+			{
+				return m.m_idNom < idNom;
+			}
+			if (m.m_idPrenom != idPrenom)
+			{
+				return m.m_idPrenom < idPrenom;
+			}
+			return m.m_joursNaissance < jours;
+		});
+
+		if (position != fin)
+		{
+			const MembreInstantane& m = m_vue.reqMembre(*position);
+			if (m.m_idNom == idNom && m.m_idPrenom == idPrenom && m.m_joursNaissance == jours)
+			{
+				trouve = *position;
+			}
+		}
+	}
+
+	return trouve;
+}
+
+/**
+ * \brief Recherche les membres ayant un numéro de téléphone donné, par dichotomie dans l'ordre
+ * 		  par téléphone de l'instantané
+ * \param[in] p_telephone est le numéro de téléphone recherché
+ * \return les positions des membres trouvés, utilisables avec reqMembre(), dans l'ordre d'ajout
+ */
+std::vector<unsigned int> AnnuaireProjete::trouverParTelephone(const std::string& p_telephone) const
+{
+	PRECONDITION(estOuvert());
+
+	std::vector<unsigned int> vTrouves;
+	if (util::validerTelephone(p_telephone))
+	{
+		std::uint64_t telephone = AnnuaireColonnes::encoderTelephone(p_telephone);
+		const std::uint32_t* debut = m_vue.reqOrdreTelephone();
+		const std::uint32_t* fin = debut + reqNbMembres();
+
+		const std::uint32_t* position = std::lower_bound(debut, fin, telephone, [this](std::uint32_t p_indice, std::uint64_t p_telephone)
+		{
+			return m_vue.reqMembre(p_indice).m_telephone < p_telephone;
+		});
+		for (; position != fin && m_vue.reqMembre(*position).m_telephone == telephone; ++position)
+		{
+			vTrouves.push_back(*position);
+		}
+	}
+
+	return vTrouves;
+}
+
+/**
+ * \brief Recherche un entraineur par son numéro de RAMQ, sans égard à la casse, par dichotomie
+ * 		  dans l'ordre par numéro de RAMQ de l'instantané
+ * \param[in] p_numRAMQ est le numéro de RAMQ recherché
+ * \return la position de l'entraineur trouvé, utilisable avec reqMembre(), ou -1 s'il est absent ;
+ * 		   le premier ajouté si plusieurs entraineurs ont ce numéro
+ */
+int AnnuaireProjete::trouverParNumRAMQ(const std::string& p_numRAMQ) const
+{
+	PRECONDITION(estOuvert());
+
+	int trouve = -1;
+	const std::uint32_t* debut = m_vue.reqOrdreRAMQ();
+	const std::uint32_t* fin = debut + m_vue.reqNbEntraineurs();
+
+	const std::uint32_t* position = std::lower_bound(debut, fin, p_numRAMQ, [this](std::uint32_t p_indice, const std::string& p_numero)
+	{
+		return comparerNumRAMQ(m_vue.reqChaine(m_vue.reqMembre(p_indice).m_idSpecifique), p_numero) < 0;
+	});
+	if (position != fin && comparerNumRAMQ(m_vue.reqChaine(m_vue.reqMembre(*position).m_idSpecifique), p_numRAMQ) == 0)
+	{
+		trouve = *position;
+	}
+
+	return trouve;
+}
+
+/**
+ * \brief Recherche une chaîne dans la table des chaînes triée de l'instantané
+ * \param[in] p_chaine est la chaîne recherchée
+ * \param[out] p_id reçoit l'identifiant de la chaîne si elle est présente
+ * \return un booléen indiquant si la chaîne est présente
+ */
+bool AnnuaireProjete::trouverChaine(const std::string& p_chaine, std::uint32_t& p_id) const
+{
+	std::uint32_t bas = 0;
+	std::uint32_t haut = m_vue.reqNbChaines();
+	while (bas < haut)
+	{
+		std::uint32_t milieu = bas + (haut - bas) / 2;
+		if (comparerChaine(m_vue.reqChaine(milieu), p_chaine) < 0)
+		{
+			bas = milieu + 1;
+		}
+		else
+		{
+			haut = milieu;
+		}
+	}
+
+	p_id = bas;
+	return bas < m_vue.reqNbChaines() && comparerChaine(m_vue.reqChaine(bas), p_chaine) == 0;
+}
+
+/**
+ * \brief Vérification des invariants de la classe AnnuaireProjete
+ */
+void AnnuaireProjete::verifieInvariant() const
+{
+	INVARIANT(!m_vue.estOuverte() || m_fichier.estOuvert());
+}
+
+}
@@ -0,0 +1,112 @@
+/**
+ * \file AnnuaireProjete.h
+ * \brief Fichier contenant l'interface de la classe AnnuaireProjete, un annuaire en lecture seule
+ * 		  servi directement depuis un instantané projeté en mémoire
+ * \author David Jalbert Ross
+ * \version 1.0
+ * \date 16 avril 2020
+ */
+
+#ifndef ANNUAIREPROJETE_H_
+#define ANNUAIREPROJETE_H_
+
+#include <string>
+#include <vector>
+#include <iosfwd>
+#include "ContratException.h"
+#include "Date.h"
+#include "TamponFormatage.h"
+#include "FichierProjete.h"
+#include "InstantaneAnnuaire.h"
+#include "AnnuaireColonnes.h"
+
+/**
+ * \namespace Hockey
+ * \brief Ce namespace contient le code spécifique au développement d'un outils de gestion d'annuaire
+ */
+namespace hockey
+{
+
+/**
+ * \class MembreProjete
+ * \brief Vue légère sur la fiche d'un membre dans un instantané projeté
+ *
+ * 		Les chaînes pointent directement dans les pages projetées. La vue reste valide tant
+ * 		que l'AnnuaireProjete qui l'a produite reste ouvert.
+ *
+ * 		Attributs: m_vue: l'instantané consulté
+ * 				   m_fiche : la fiche du membre dans l'instantané
+ */
+class MembreProjete
+{
+public:
+	MembreProjete(const VueInstantane& p_vue, unsigned int p_indice);
+
+	ChaineInstantane reqNom() const;
+	ChaineInstantane reqPrenom() const;
+	util::Date reqDateNaissance() const;
+	std::string reqTelephone() const;
+
+	RoleMembre reqRole() const;
+	bool estJoueur() const;
+	bool estEntraineur() const;
+
+	ChaineInstantane reqPosition() const;
+	ChaineInstantane reqNumRAMQ() const;
+	char reqSexe() const;
+
+	void formaterPersonne(util::TamponFormatage& p_tampon) const;
+
+private:
+	const VueInstantane* m_vue;
+	const MembreInstantane* m_fiche;
+};
+
+/**
+ * \class AnnuaireProjete
+ * \brief Annuaire en lecture seule servi directement depuis un instantané écrit par Annuaire::sauvegarder()
+ *
+ * 		Le fichier est projeté en mémoire avec mmap() et n'est jamais désérialisé : l'ouverture
+ * 		ne coûte que la vérification de la structure, et tous les processus qui ouvrent le même
+ * 		fichier partagent les mêmes pages physiques. Les recherches par identité et par
+ * 		téléphone et par numéro de RAMQ sont dichotomiques, dans la table des chaînes triée et
+ * 		dans les permutations de l'instantané.
+ *
+ * 		Les recherches retournent la position des membres, à utiliser avec reqMembre().
+ *
+ * 		Attributs: m_fichier: le fichier projeté
+ * 				   m_vue : la vue sur l'instantané contenu dans le fichier
+ */
+class AnnuaireProjete
+{
+public:
+	AnnuaireProjete();
+
+	bool ouvrir(const std::string& p_fichier);
+	bool estOuvert() const;
+
+	std::string reqNomClub() const;
+	unsigned int reqNbMembres() const;
+	MembreProjete reqMembre(unsigned int p_indice) const;
+
+	std::string reqAnnuaireFormate() const;
+	void ecrireAnnuaireFormate(std::ostream& p_os) const;
+
+	int trouverPersonne(const std::string& p_nom, const std::string& p_prenom, const util::Date& p_dateNaissance) const;
+	std::vector<unsigned int> trouverParTelephone(const std::string& p_telephone) const;
+	int trouverParNumRAMQ(const std::string& p_numRAMQ) const;
+
+private:
+	AnnuaireProjete(const AnnuaireProjete&);
+	AnnuaireProjete& operator=(const AnnuaireProjete&);
+
+	bool trouverChaine(const std::string& p_chaine, std::uint32_t& p_id) const;
+	void verifieInvariant() const;
+
+	util::FichierProjete m_fichier;
+	VueInstantane m_vue;
+};
+
+}
+
+#endif
@@ -0,0 +1,138 @@
+/**
+ * \file ArenaMembres.cpp
+ * \brief Fichier d'implementation de la classe ArenaMembres
+ * \author David Jalbert Ross
+ * \version 1.0
+ * \date 16 avril 2020
+ */
+
+#include "ArenaMembres.h"
+#include <cstdint>
+#include <utility>
+
+using namespace std;
+
+namespace hockey
+{
+
+/**
+ * \brief Constructeur avec paramètres
+ * 		  On construit une arène vide, aucun bloc n'est réservé avant la première allocation
+ * \param[in] p_tailleBloc est la taille en octets d'un bloc ordinaire, doit être plus grande que 0
+ */
+ArenaMembres::ArenaMembres(std::size_t p_tailleBloc):
+		m_courant(nullptr), m_restant(0), m_tailleBloc(p_tailleBloc)
+{
+	PRECONDITION(p_tailleBloc > 0);
+	INVARIANTS();
+}
+
+/**
+ * \brief Constructeur de déplacement
+ * 		  Les blocs de p_arena, et les objets qu'ils contiennent, appartiennent désormais à
+ * 		  l'arène construite. p_arena reste une arène vide utilisable.
+ * \param[in,out] p_arena est l'arène dont les blocs sont repris
+ */
+ArenaMembres::ArenaMembres(ArenaMembres&& p_arena) noexcept:
+		m_vBlocs(std::move(p_arena.m_vBlocs)), m_courant(p_arena.m_courant), m_restant(p_arena.m_restant),
+		m_tailleBloc(p_arena.m_tailleBloc)
+{
+	p_arena.m_vBlocs.clear();
+	p_arena.m_courant = nullptr;
+	p_arena.m_restant = 0;
+}
+
+/**
+ * \brief Assignation par déplacement
+ * 		  Les blocs de l'arène courante sont libérés, puis ceux de p_arena sont repris.
+ * \param[in,out] p_arena est l'arène dont les blocs sont repris
+ * \return l'arène courante
+ */
+ArenaMembres& ArenaMembres::operator=(ArenaMembres&& p_arena) noexcept
+{
+	if (this != &p_arena)
+	{
+		liberer();
+		m_vBlocs.swap(p_arena.m_vBlocs);
+		m_courant = p_arena.m_courant;
+		m_restant = p_arena.m_restant;
+		m_tailleBloc = p_arena.m_tailleBloc;
+		p_arena.m_courant = nullptr;
+		p_arena.m_restant = 0;
+	}
+	return *this;
+}
+
+/**
+ * \brief Destructeur qui libère tous les blocs de l'arène
+ */
+ArenaMembres::~ArenaMembres()
+{
+	liberer();
+}
+
+/**
+ * \brief Réserve un espace mémoire dans l'arène
+ * \param[in] p_taille est le nombre d'octets demandés
+ * \param[in] p_alignement est l'alignement demandé, doit être une puissance de 2
+ * \return un pointeur vers l'espace réservé, valide jusqu'à la libération de l'arène
+ */
+void* ArenaMembres::allouer(std::size_t p_taille, std::size_t p_alignement)
+{
+	PRECONDITION(p_alignement > 0 && (p_alignement & (p_alignement - 1)) == 0);
+
+	std::size_t decalage = (p_alignement - reinterpret_cast<std::uintptr_t>(m_courant) % p_alignement) % p_alignement;
+	if (m_courant == nullptr || decalage + p_taille > m_restant)
+	{
+		// Un objet plus gros qu'un bloc ordinaire reçoit un bloc à sa taille
+		std::size_t tailleBloc = p_taille + p_alignement > m_tailleBloc ? p_taille + p_alignement : m_tailleBloc;
+		m_vBlocs.push_back(static_cast<char*>(::operator new(tailleBloc)));
+		m_courant = m_vBlocs.back();
+		m_restant = tailleBloc;
+		decalage = (p_alignement - reinterpret_cast<std::uintptr_t>(m_courant) % p_alignement) % p_alignement;
+	}
+
+	void* espace = m_courant + decalage;
+	m_courant += decalage + p_taille;
+	m_restant -= decalage + p_taille;
+
+	INVARIANTS();
+	return espace;
+}
+
+/**
+ * \brief Libère d'un coup tous les blocs de l'arène
+ */
+void ArenaMembres::liberer()
+{
+	for (std::vector<char*>::size_type i = 0; i < m_vBlocs.size(); i++)
+	{
+		::operator delete(m_vBlocs[i]);
+	}
+	m_vBlocs.clear();
+	m_courant = nullptr;
+	m_restant = 0;
+
+	POSTCONDITION(reqNbBlocs() == 0);
+	INVARIANTS();
+}
+
+/**
+ * \brief Retourne le nombre de blocs réservés par l'arène
+ * \return un entier contenant le nombre de blocs
+ */
+std::size_t ArenaMembres::reqNbBlocs() const
+{
+	return m_vBlocs.size();
+}
+
+/**
+ * \brief Vérification des invariants de la classe ArenaMembres
+ */
+void ArenaMembres::verifieInvariant() const
+{
+	INVARIANT(m_tailleBloc > 0);
+	INVARIANT((m_courant == nullptr) == m_vBlocs.empty());
+}
+
+}
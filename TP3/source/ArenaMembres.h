@@ -0,0 +1,66 @@
+/**
+ * \file ArenaMembres.h
+ * \brief Fichier contenant l'interface de la classe ArenaMembres, une arène d'allocation pour les membres d'un annuaire
+ * \author David Jalbert Ross
+ * \version 1.0
+ * \date 16 avril 2020
+ */
+
+#ifndef ARENAMEMBRES_H_
+#define ARENAMEMBRES_H_
+
+#include <cstddef>
+#include <vector>
+#include "ContratException.h"
+
+/**
+ * \namespace Hockey
+ * \brief Ce namespace contient le code spécifique au développement d'un outils de gestion d'annuaire
+ */
+namespace hockey
+{
+
+/**
+ * \class ArenaMembres
+ * \brief Arène d'allocation monotone utilisée pour cloner les membres d'un annuaire
+ *
+ * 		La mémoire est réservée par gros blocs et distribuée séquentiellement. Elle n'est
+ * 		jamais rendue individuellement : tous les blocs sont libérés d'un coup par liberer()
+ * 		ou par le destructeur. Les objets construits dans l'arène doivent être détruits
+ * 		explicitement (appel du destructeur) avant la libération. Une arène ne se copie pas,
+ * 		mais elle se déplace : ses blocs changent de propriétaire sans que les objets qu'ils
+ * 		contiennent ne bougent.
+ *
+ * 		Attributs: m_vBlocs: les blocs de mémoire réservés
+ * 				   m_courant : la position libre dans le dernier bloc
+ * 				   m_restant : le nombre d'octets libres dans le dernier bloc
+ * 				   m_tailleBloc : la taille d'un bloc ordinaire
+ */
+class ArenaMembres
+{
+public:
+	explicit ArenaMembres(std::size_t p_tailleBloc = 16384);
+	ArenaMembres(ArenaMembres&& p_arena) noexcept;
+	ArenaMembres& operator=(ArenaMembres&& p_arena) noexcept;
+	~ArenaMembres();
+
+	void* allouer(std::size_t p_taille, std::size_t p_alignement);
+	void liberer();
+
+	std::size_t reqNbBlocs() const;
+
+private:
+	ArenaMembres(const ArenaMembres&);
+	ArenaMembres& operator=(const ArenaMembres&);
+
+	void verifieInvariant() const;
+
+	std::vector<char*> m_vBlocs;
+	char* m_courant;
+	std::size_t m_restant;
+	std::size_t m_tailleBloc;
+};
+
+}
+
+#endif
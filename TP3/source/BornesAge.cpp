@@ -0,0 +1,112 @@
+/**
+ * \file BornesAge.cpp
+ * \brief Fichier d'implementation de la classe BornesAge
+ * \author David Jalbert Ross
+ * \version 1.0
+ * \date 16 avril 2020
+ */
+
+#include "BornesAge.h"
+#include "Horloge.h"
+#include "Joueur.h"
+#include "Entraineur.h"
+
+namespace
+{
+/**
+ * \brief Retourne la date du même jour un nombre d'années plus tôt (voir BornesAge::joursNaissanceLimite())
+ * \param[in] p_date est la date de départ
+ * \param[in] p_nbAnnees est le nombre d'années à retrancher
+ * \return la date p_nbAnnees plus tôt
+ */
+util::Date anneesAvant(const util::Date& p_date, long p_nbAnnees)
+{
+	return util::Date::dateDepuisJoursEpoque(hockey::BornesAge::joursNaissanceLimite(p_date, p_nbAnnees));
+}
+}
+
+namespace hockey
+{
+
+/**
+ * \brief Constructeur avec paramètres
+ * 		  On calcule les bornes pour une date du jour donnée
+ * \param[in] p_aujourdhui est la date du jour
+ */
+BornesAge::BornesAge(const util::Date& p_aujourdhui):
+		m_aujourdhui(p_aujourdhui),
+		m_naissanceMinimaleJoueur(anneesAvant(p_aujourdhui, AGE_MINIMAL_JOUEUR)),
+		m_naissanceMaximaleJoueur(anneesAvant(p_aujourdhui, AGE_MAXIMAL_JOUEUR + 1)),
+		m_naissanceMinimaleEntraineur(anneesAvant(p_aujourdhui, AGE_MINIMAL_ENTRAINEUR))
+{
+	POSTCONDITION(reqAujourdhui() == p_aujourdhui);
+}
+
+/**
+ * \brief Retourne les bornes de la date du jour donnée par util::Horloge
+ * 		  Les bornes ne sont recalculées que lorsque la date du jour change.
+ * \return les bornes d'aujourd'hui
+ */
+BornesAge BornesAge::reqBornesAujourdhui()
+{
+	thread_local BornesAge bornes((util::Date(1, 1, 2000)));
+
+	util::Date aujourdhui = util::Horloge::reqAujourdhui();
+	if (!(bornes.m_aujourdhui == aujourdhui))
+	{
+		bornes = BornesAge(aujourdhui);
+	}
+	return bornes;
+}
+
+/**
+ * \brief Retourne la date de naissance de qui atteint un âge à une date donnée, soit le même jour
+ * 		  p_age années plus tôt. Le 29 février devient le 28 février quand l'année visée n'est
+ * 		  pas bissextile. La date est retournée en jours depuis le 1er janvier 1970 : elle peut
+ * 		  précéder 1970 et donc ne pas être représentable par util::Date.
+ * \param[in] p_date est la date à laquelle l'âge est atteint
+ * \param[in] p_age est l'âge atteint, en années
+ * \return le nombre de jours entre le 1er janvier 1970 et la date de naissance, négatif avant 1970
+ */
+long BornesAge::joursNaissanceLimite(const util::Date& p_date, long p_age)
+{
+	long annee = p_date.reqAnnee() - p_age;
+	long jour = p_date.reqJour();
+	if (p_date.reqMois() == 2 && jour == 29 && !util::Date::estBissextile(annee))
+	{
+		jour--;
+	}
+	return util::Date::joursDepuisCivil(jour, p_date.reqMois(), annee);
+}
+
+/**
+ * \brief Retourne la date du jour des bornes
+ * \return un objet Date contenant la date du jour
+ */
+const util::Date& BornesAge::reqAujourdhui() const
+{
+	return m_aujourdhui;
+}
+
+/**
+ * \brief Détermine si une date de naissance donne l'âge d'un joueur,
+ * 		  entre AGE_MINIMAL_JOUEUR et AGE_MAXIMAL_JOUEUR ans
+ * \param[in] p_dateNaissance est la date de naissance à valider
+ * \return un bool indiquant si l'âge est valide ou non
+ */
+bool BornesAge::validerAgeJoueur(const util::Date& p_dateNaissance) const
+{
+	return p_dateNaissance < m_naissanceMinimaleJoueur && m_naissanceMaximaleJoueur < p_dateNaissance;
+}
+
+/**
+ * \brief Détermine si une date de naissance donne au moins AGE_MINIMAL_ENTRAINEUR ans
+ * \param[in] p_dateNaissance est la date de naissance à valider
+ * \return un bool indiquant si l'âge est valide ou non
+ */
+bool BornesAge::validerAgeEntraineur(const util::Date& p_dateNaissance) const
+{
+	return p_dateNaissance < m_naissanceMinimaleEntraineur;
+}
+
+}
@@ -0,0 +1,56 @@
+/**
+ * \file BornesAge.h
+ * \brief Fichier contenant l'interface de la classe BornesAge, les dates de naissance limites des membres
+ * \author David Jalbert Ross
+ * \version 1.0
+ * \date 16 avril 2020
+ */
+
+#ifndef BORNESAGE_H_
+#define BORNESAGE_H_
+
+#include "Date.h"
+
+/**
+ * \namespace Hockey
+ * \brief Ce namespace contient le code spécifique au développement d'un outils de gestion d'annuaire
+ */
+namespace hockey
+{
+
+/**
+ * \class BornesAge
+ * \brief Dates de naissance limites des joueurs et des entraineurs pour une date du jour
+ *
+ * 		Les bornes se calculent à partir de la date du jour et des constantes AGE_MINIMAL_JOUEUR,
+ * 		AGE_MAXIMAL_JOUEUR et AGE_MINIMAL_ENTRAINEUR. reqBornesAujourdhui() les calcule une fois
+ * 		par jour et par fil d'exécution, à partir de util::Horloge; un traitement en lot peut
+ * 		aussi les obtenir une fois et les conserver.
+ *
+ * 		Attributs: m_aujourdhui: la date du jour des bornes
+ * 				   m_naissanceMinimaleJoueur : un joueur doit être né avant cette date
+ * 				   m_naissanceMaximaleJoueur : un joueur doit être né après cette date
+ * 				   m_naissanceMinimaleEntraineur : un entraineur doit être né avant cette date
+ */
+class BornesAge
+{
+public:
+	explicit BornesAge(const util::Date& p_aujourdhui);
+
+	static BornesAge reqBornesAujourdhui();
+	static long joursNaissanceLimite(const util::Date& p_date, long p_age);
+
+	const util::Date& reqAujourdhui() const;
+	bool validerAgeJoueur(const util::Date& p_dateNaissance) const;
+	bool validerAgeEntraineur(const util::Date& p_dateNaissance) const;
+
+private:
+	util::Date m_aujourdhui;
+	util::Date m_naissanceMinimaleJoueur;
+	util::Date m_naissanceMaximaleJoueur;
+	util::Date m_naissanceMinimaleEntraineur;
+};
+
+}
+
+#endif
@@ -71,7 +71,30 @@ public:
 
 // --- Définition des macros de contrôle de la théorie du contrat
 
-#if !defined(NDEBUG)
+#if defined(CONTRAT_ECHANTILLONNE)
+// --- Mode échantillonné : les préconditions sont toujours vérifiées. Les postconditions,
+// --- les assertions et les appels à verifieInvariant() ne le sont qu'une fois sur
+// --- SiteContrat::reqPeriodeEchantillonnage() à chaque site, dont les passages et le
+// --- coût sont comptés (voir SiteContrat::ecrireRapport()).
+#  include "SiteContrat.h"
+
+#  define CONTRAT_ECHANTILLON_(texte, verification) \
+      { static SiteContrat siteContrat_(__FILE__, __LINE__, texte); \
+        if (siteContrat_.echantillonner()) { ChronometreContrat chronometreContrat_(siteContrat_); verification; } }
+
+#  define INVARIANTS() \
+      CONTRAT_ECHANTILLON_("verifieInvariant()", verifieInvariant())
+
+#  define ASSERTION(f)     \
+      CONTRAT_ECHANTILLON_(#f, if (!(f)) throw AssertionException(__FILE__,__LINE__, #f))
+#  define PRECONDITION(f)  \
+      if (!(f)) throw PreconditionException(__FILE__, __LINE__, #f);
+#  define POSTCONDITION(f) \
+      CONTRAT_ECHANTILLON_(#f, if (!(f)) throw PostconditionException(__FILE__, __LINE__, #f))
+#  define INVARIANT(f)   \
+      if (!(f)) throw InvariantException(__FILE__,__LINE__, #f);
+
+#elif !defined(NDEBUG)
 // --- Mode debug
 
 #  define INVARIANTS() \
@@ -95,6 +118,6 @@ public:
 #  define INVARIANT(f);
 #  define ASSERTION(f);
 
-#endif  // --- if !defined (NDEBUG)
+#endif  // --- if defined (CONTRAT_ECHANTILLONNE), !defined (NDEBUG)
 #endif  // --- ifndef CONTRATEXCEPTION_H_DEJA_INCLU
 
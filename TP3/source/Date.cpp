@@ -10,29 +10,68 @@
  */
 
 #include "Date.h"
-#include <sstream>
+#include "TamponFormatage.h"
 #include <ctime>
-#include <iostream>
-static const long MAX_SECONDE = 2145848400;
-static const long JOUR_EN_SECONDES = 60 * 60 * 24;
-static const long MIN_SECONDE = 5 * 60 * 60; // 5 heure par rapport à Greenwich
+#include <ostream>
+#include <type_traits>
+
+/**
+ * \brief Nom en français accompagné de sa longueur, pour le formatage sans recherche du caractère nul
+ */
+struct NomFormate
+{
+	const char* m_texte;
+	std::size_t m_longueur;
+};
+
+#define NOM_FORMATE(p_texte) { p_texte, sizeof(p_texte) - 1 }
+
+static const NomFormate JOURS_SEMAINE[] =
+{ NOM_FORMATE("Dimanche"), NOM_FORMATE("Lundi"), NOM_FORMATE("Mardi"), NOM_FORMATE("Mercredi"),
+		NOM_FORMATE("Jeudi"), NOM_FORMATE("Vendredi"), NOM_FORMATE("Samedi") };
+
+static const NomFormate NOMS_MOIS[] =
+{ NOM_FORMATE("janvier"), NOM_FORMATE("fevrier"), NOM_FORMATE("mars"), NOM_FORMATE("avril"),
+		NOM_FORMATE("mai"), NOM_FORMATE("juin"), NOM_FORMATE("juillet"), NOM_FORMATE("aout"),
+		NOM_FORMATE("septembre"), NOM_FORMATE("octobre"), NOM_FORMATE("novembre"), NOM_FORMATE("decembre") };
+
+#undef NOM_FORMATE
+
+static const long MIN_JOURS = 0;      // 1er janvier 1970
+static const long MAX_JOURS = 24836;  // 31 décembre 2037
+
+static_assert(util::Date::joursDepuisCivil(1, 1, 1970) == MIN_JOURS, "conversion du calendrier civil");
+static_assert(util::Date::joursDepuisCivil(31, 12, 2037) == MAX_JOURS, "conversion du calendrier civil");
+static_assert(util::Date::validerDate(29, 2, 2000) && !util::Date::validerDate(29, 2, 2100), "année bissextile");
+// Une Date ne possède aucune ressource : sa copie et son déplacement sont triviaux et ne lèvent rien
+static_assert(std::is_trivially_copyable<util::Date>::value, "Date se copie octet par octet");
+static_assert(std::is_nothrow_move_constructible<util::Date>::value && std::is_nothrow_move_assignable<util::Date>::value,
+		"Date se déplace sans exception");
 
 using namespace std;
 namespace util
 {
 /**
  * \brief constructeur par défaut \n
- * La date prise par défaut est la date du système
+ * La date prise par défaut est la date du système. La conversion en heure locale
+ * utilise la version réentrante de localtime(), qui écrit dans une structure locale
+ * plutôt que dans un tampon statique partagé entre les fils d'exécution.
  */
 Date::Date()
 {
-	m_temps = time(NULL);
+	time_t temps = time(NULL);
 
-	struct tm* infoTempsP = localtime(&m_temps);
-	ASSERTION(infoTempsP != NULL);
+	struct tm infoTemps;
+#if defined(_WIN32)
+	bool conversionReussie = localtime_s(&infoTemps, &temps) == 0;
+#else
+	bool conversionReussie = localtime_r(&temps, &infoTemps) != NULL;
+#endif
+	ASSERTION(conversionReussie);
+	static_cast<void>(conversionReussie);	// ASSERTION disparaît avec NDEBUG
 
-	asgDate(infoTempsP->tm_mday, infoTempsP->tm_mon + 1,
-			infoTempsP->tm_year + 1900);
+	asgDate(infoTemps.tm_mday, infoTemps.tm_mon + 1,
+			infoTemps.tm_year + 1900);
 
 	INVARIANTS();
 }
@@ -70,23 +109,51 @@ void Date::asgDate(long p_jour, long p_mois, long p_annee)
 {
 	PRECONDITION(Date::validerDate(p_jour, p_mois, p_annee));
 
-	struct tm infoTemps;
-
-	infoTemps.tm_year = (p_annee - 1900);
-	infoTemps.tm_mon = (p_mois - 1);
-	infoTemps.tm_mday = p_jour;
-	infoTemps.tm_hour = 0;
-	infoTemps.tm_min = 0;
-	infoTemps.tm_sec = 0;
-	infoTemps.tm_isdst = -1;
-
-	m_temps = mktime(&infoTemps);
+	m_jours = joursDepuisCivil(p_jour, p_mois, p_annee);
+	m_annee = p_annee;
+	m_mois = p_mois;
+	m_jour = p_jour;
 
 	POSTCONDITION(reqJour() == p_jour);
 	POSTCONDITION(reqMois() == p_mois);
 	POSTCONDITION(reqAnnee() == p_annee);
 	INVARIANTS();
 }
+/**
+ * \brief Construit une date à partir d'un nombre de jours depuis le 1er janvier 1970
+ * \param[in] p_jours est le nombre de jours, doit correspondre à une date entre 1970 et 2037
+ * \return un objet Date
+ */
+Date Date::dateDepuisJoursEpoque(long p_jours)
+{
+	PRECONDITION(p_jours >= MIN_JOURS && p_jours <= MAX_JOURS);
+
+	Date date(1, 1, 1970);
+	date.asgJoursEpoque(p_jours);
+
+	POSTCONDITION(date.reqJoursEpoque() == p_jours);
+	return date;
+}
+/**
+ * \brief Assigne la date correspondant à un nombre de jours depuis le 1er janvier 1970 et
+ * 		  recalcule le jour, le mois et l'année (inverse de joursDepuisCivil())
+ * \param[in] p_jours est le nombre de jours, doit correspondre à une date entre 1970 et 2037
+ */
+void Date::asgJoursEpoque(long p_jours)
+{
+	const long jours = p_jours + 719468;
+	const long ere = jours / 146097;
+	const long jourEre = jours - ere * 146097;
+	const long anneeEre = (jourEre - jourEre / 1460 + jourEre / 36524 - jourEre / 146096) / 365;
+	const long jourAnnee = jourEre - (365 * anneeEre + anneeEre / 4 - anneeEre / 100);
+	const long moisDecale = (5 * jourAnnee + 2) / 153;
+	const long mois = moisDecale < 10 ? moisDecale + 3 : moisDecale - 9;
+
+	m_jours = p_jours;
+	m_jour = jourAnnee - (153 * moisDecale + 2) / 5 + 1;
+	m_mois = mois;
+	m_annee = anneeEre + ere * 400 + (mois <= 2 ? 1 : 0);
+}
 /**
  * \brief Ajoute ou retire un certain nombre de jours à la date courante
  * \param p_nbJour est une entier long qui représente le nombre de jours à ajouter ou à soustraire s'il est négatif
@@ -96,184 +163,90 @@ bool Date::ajouteNbJour(long p_nbJour)
 {
 	bool bRet = true;
 
-	long tModif = m_temps + (p_nbJour * JOUR_EN_SECONDES);
-	if (tModif < MIN_SECONDE || tModif > MAX_SECONDE)
+	long jModif = m_jours + p_nbJour;
+	if (jModif < MIN_JOURS || jModif > MAX_JOURS)
 	{
 		bRet = false;
 	}
 	else
 	{
-		m_temps = m_temps + (p_nbJour * JOUR_EN_SECONDES);
+		asgJoursEpoque(jModif);
 	}
 
 	INVARIANTS();
 	return bRet;
 }
-/**
- * \brief retourne le jour de la date
- * \return un entier long qui représente le jour de la date
- */
-long Date::reqJour() const
-{
-	struct tm* infoTempsP = localtime(&m_temps);
-	ASSERTION(infoTempsP != NULL);
-	return infoTempsP->tm_mday;
-}
-/**
- * \brief retourne le mois de la date
- * \return un entier long qui représente le mois de la date
- */
-long Date::reqMois() const
-{
-	struct tm* infoTempsP = localtime(&m_temps);
-	ASSERTION(infoTempsP != NULL);
-	return infoTempsP->tm_mon + 1;
-}
-/**
- * \brief retourne l'année de la date
- * \return un entier long qui représente l'année de la date
- */
-long Date::reqAnnee() const
-{
-	struct tm* infoTempsP = localtime(&m_temps);
-	ASSERTION(infoTempsP != NULL);
-	return infoTempsP->tm_year + 1900;
-}
 /**
  * \brief retourne le ième jour de l'année correspondant au jour de la date
  * \return un entier long qui représente le ième jour de l'année
  */
 long Date::reqJourAnnee() const
 {
-	struct tm* infoTempsP = localtime(&m_temps);
-	ASSERTION(infoTempsP != NULL);
-	return infoTempsP->tm_yday + 1;
-}
-/**
- * \brief Déterminer si une année est bissextile ou non
- * \param[in] p_annee un entier long qui représente l'année à vérifier
- * \return estBissextile un booléen qui a la valeur true si l'année est bissextile et false sinon
- */
-bool Date::estBissextile(long p_annee)
-{
-	bool estBissextile = false;
-
-	if (((p_annee % 4 == 0) && (p_annee % 100 != 0)) || ((p_annee % 4 == 0) && (p_annee
-			% 100 == 0) && (p_annee % 400 == 0)))
-	{
-		estBissextile = true;
-	}
-
-	return estBissextile;
+	return m_jours - joursDepuisCivil(1, 1, m_annee) + 1;
 }
 /**
  * \brief retourne le nom du jour de la semaine en français
  * \return une chaîne de caractères qui représente le nom du jour de la semaine en français
  */
-string Date::reqNomJourSemaine() const
+const char* Date::reqNomJourSemaine() const
 {
-	static string JourSemaine[] =
-	{ "Dimanche", "Lundi", "Mardi", "Mercredi", "Jeudi", "Vendredi", "Samedi" };
-
-	struct tm* infoTempsP = localtime(&m_temps);
-	ASSERTION(infoTempsP != NULL);//AssertionException si l'heure système n'a pas correctement été récupérée
-	return JourSemaine[infoTempsP->tm_wday];
-
+	return JOURS_SEMAINE[reqJourSemaine()].m_texte;
 }
 /**
  * \brief retourne le nom du mois en français
  * \return une chaîne de caractères qui représente le nom du mois en français
  */
-string Date::reqNomMois() const
+const char* Date::reqNomMois() const
 {
-	static string NomMois[] =
-	{ "janvier", "fevrier", "mars", "avril", "mai", "juin", "juillet", "aout",
-			"septembre", "octobre", "novembre", "decembre" };
-
-	struct tm* infoTempsP = localtime(&m_temps);
-	ASSERTION(infoTempsP != NULL);//AssertionException si l'heure système n'a pas correctement été récupérée
-	return NomMois[infoTempsP->tm_mon];
+	return NOMS_MOIS[m_mois - 1].m_texte;
 }
 /**
- * \brief retourne une date formatée dans une chaîne de caracères (string)
- * \return la date formatée dans une chaîne de caractères
+ * \brief retourne le rang du jour de la semaine, de 0 (dimanche) à 6 (samedi)
+ * \return un entier qui représente le jour de la semaine
  */
- string Date::reqDateFormatee() const
+int Date::reqJourSemaine() const
 {
-	ostringstream os;
-
-	os << reqNomJourSemaine() << " le ";
-	if (reqJour() < 10)
-	{
-		os << "0";
-	}
-	os << reqJour() << " ";
-	os << reqNomMois() << " ";
-	os << reqAnnee();
-
-	return os.str();
+	// Le 1er janvier 1970 était un jeudi
+	return (m_jours + 4) % 7;
 }
-
 /**
- * \brief Vérifie la validité d'une date
- * \param[in] p_jour un entier long représentant le jour de la date
- * \param[in] p_mois un entier long représentant  le mois de la date
- * \param[in] p_annee un entier long représentant l'année de la date
- * \return un booléen indiquant si la date est valide ou non
+ * \brief retourne une date formatée dans une chaîne de caracères (string)
+ * \return la date formatée dans une chaîne de caractères
  */
-bool Date::validerDate(long p_jour, long p_mois, long p_annee)
+ string Date::reqDateFormatee() const
 {
-	long JourParMois[] =
-	{ 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
-	static const long DEBUT_TEMPS = 1970;
-	static const long FIN_TEMPS = 2037;
-
-	bool valide = false;
-
-	if (p_mois > 0 && p_mois <= 12 && p_annee >= DEBUT_TEMPS && p_annee <= FIN_TEMPS)
-	{
-		if (p_mois == 2 && Date::estBissextile(p_annee))
-		{
-			JourParMois[p_mois - 1]++;
-		}
-		if (p_jour > 0 && p_jour <= JourParMois[p_mois - 1])
-		{
-			valide = true;
-		}
-	}
-	return valide;
+	TamponFormatage tampon;
+	formaterDate(tampon);
+	return tampon.reqTexte();
 }
 
 /**
- * \brief surcharge de l'opérateur ==
- * \param[in] p_date à comparer à la date courante
- * \return un booléen indiquant si les deux dates sont égales ou non
+ * \brief écrit la date formatée, comme reqDateFormatee(), directement dans un flux de sortie
+ * \param[in,out] p_os est le flux dans lequel la date est écrite
  */
-bool Date::operator==(const Date& p_date) const
+void Date::ecrireDateFormatee(std::ostream& p_os) const
 {
-	return m_temps == p_date.m_temps;
+	TamponFormatage tampon;
+	formaterDate(tampon);
+	tampon.ecrire(p_os);
 }
 
 /**
- * \brief surcharge de l'opérateur <
- * \param[in] p_date à comparer à la date courante
- * \return un booléen indiquant si la date courante est plus petite que la date passée en paramètre
+ * \brief ajoute la date formatée, comme reqDateFormatee(), à la fin d'un tampon de formatage
+ * \param[in,out] p_tampon est le tampon dans lequel la date est écrite
  */
-bool Date::operator<(const Date& p_date) const
+void Date::formaterDate(TamponFormatage& p_tampon) const
 {
-	return m_temps < p_date.m_temps;
-}
+	const NomFormate& jour = JOURS_SEMAINE[reqJourSemaine()];
+	const NomFormate& mois = NOMS_MOIS[m_mois - 1];
 
-/**
- * \brief retourne le nombre de jours entre deux dates
- * \param[in] p_date à soustraire à la date courante
- * \return un entier qui représente le nombre de jours entre la date courante
- * 	et celle passée en paramètre
- */
-int Date::operator-(const Date& p_date) const
-{
-	double nbSec = difftime(m_temps, p_date.m_temps);
-	return static_cast<int> (nbSec / JOUR_EN_SECONDES);
+	p_tampon.ajouter(jour.m_texte, jour.m_longueur);
+	p_tampon.ajouter(" le ", 4);
+	p_tampon.ajouterEntierDeuxChiffres(m_jour);
+	p_tampon.ajouter(' ');
+	p_tampon.ajouter(mois.m_texte, mois.m_longueur);
+	p_tampon.ajouter(' ');
+	p_tampon.ajouterEntier(m_annee);
 }
 
 /**
@@ -305,11 +278,13 @@ int Date::operator-(const Date& p_date) const
 
 /**
  * \brief Teste l'invariant de la classe Date. L'invariant de cette classe s'assure que la date est valide
+ * 		  et que le jour, le mois et l'année conservés correspondent au nombre de jours
  */
 void Date::verifieInvariant() const
 {
-	INVARIANT(m_temps >= MIN_SECONDE);
-	INVARIANT(m_temps <= MAX_SECONDE);
-	INVARIANT(Date::validerDate(reqJour(), reqMois(), reqAnnee()));
+	INVARIANT(m_jours >= MIN_JOURS);
+	INVARIANT(m_jours <= MAX_JOURS);
+	INVARIANT(Date::validerDate(m_jour, m_mois, m_annee));
+	INVARIANT(joursDepuisCivil(m_jour, m_mois, m_annee) == m_jours);
 }
 }// namespace util
@@ -9,9 +9,12 @@
 #define DATE_H_
 #include "ContratException.h"
 #include <string>
+#include <iosfwd>
 
 namespace util
 {
+class TamponFormatage;
+
 /**
  * \class Date
  * \brief Cette classe sert au maintien et à la manipulation des dates.
@@ -25,9 +28,16 @@ namespace util
  *              La classe n'accepte que des dates valides, c'est la
  *              responsabilité de l'utilisateur de la classe de s'en assurer.
  *              <p>
- *  Attributs:   time_t m_temps   Nombre de secondes écoulé depuis le premier janvier 1970 <p>
- * 				time_t m_temps pour long m_temps
- * \invariant m_temps >= 1er janvier 1970 et >= au 31 décembre 2037
+ *              Aucune méthode ne dépend d'un état statique modifiable : des objets Date
+ *              peuvent être construits, comparés et formatés simultanément depuis plusieurs
+ *              fils d'exécution.
+ *              <p>
+ *  Attributs:   int m_jours   Nombre de jours écoulés depuis le premier janvier 1970 <p>
+ * 				short m_annee, unsigned char m_mois, unsigned char m_jour : l'année, le mois
+ * 				et le jour correspondants, conservés pour que les accesseurs n'aient rien à calculer <p>
+ * 				Les conversions entre le calendrier civil et le nombre de jours se font en
+ * 				arithmétique entière (algorithme days_from_civil), sans appel à localtime() ni mktime().
+ * \invariant m_jours >= 1er janvier 1970 et <= au 31 décembre 2037
  * \invariant La validité peut être vérifiée avec la méthode statique
  *              bool Date::verifierDate(jour, mois, annee).
  */
@@ -40,30 +50,156 @@ public:
 	void asgDate(long p_jour, long p_mois, long p_annee);
 	bool ajouteNbJour(long p_nbjour);
 
-	long reqJour() const;
-	long reqMois() const;
-	long reqAnnee() const;
+	constexpr long reqJour() const;
+	constexpr long reqMois() const;
+	constexpr long reqAnnee() const;
+	constexpr long reqJoursEpoque() const;
 
 	long reqJourAnnee() const;
 	std::string reqDateFormatee() const;
+	void ecrireDateFormatee(std::ostream& p_os) const;
+	void formaterDate(TamponFormatage& p_tampon) const;
 
-	bool operator ==(const Date& p_date) const;
-	bool operator <(const Date& p_date) const;
-	int operator -(const Date& p_date) const;
+	constexpr bool operator ==(const Date& p_date) const;
+	constexpr bool operator <(const Date& p_date) const;
+	constexpr int operator -(const Date& p_date) const;
 
-	static bool estBissextile(long p_annee);
-	static bool validerDate(long p_jour, long p_mois, long p_annee);
+	static constexpr bool estBissextile(long p_annee);
+	static constexpr bool validerDate(long p_jour, long p_mois, long p_annee);
+	static constexpr long joursDepuisCivil(long p_jour, long p_mois, long p_annee);
+	static Date dateDepuisJoursEpoque(long p_jours);
 
 	friend std::ostream& operator<<(std::ostream& p_os, const Date& p_date);
 
 private:
-	std::string reqNomJourSemaine() const;
-	std::string reqNomMois() const;
+	void asgJoursEpoque(long p_jours);
+	const char* reqNomJourSemaine() const;
+	const char* reqNomMois() const;
+	int reqJourSemaine() const;
 	void verifieInvariant() const;
-	time_t m_temps;
+	int m_jours;
+	short m_annee;
+	unsigned char m_mois;
+	unsigned char m_jour;
 };
 
+/**
+ * \brief retourne le jour de la date
+ * \return un entier long qui représente le jour de la date
+ */
+constexpr long Date::reqJour() const
+{
+	return m_jour;
+}
+/**
+ * \brief retourne le mois de la date
+ * \return un entier long qui représente le mois de la date
+ */
+constexpr long Date::reqMois() const
+{
+	return m_mois;
+}
+/**
+ * \brief retourne l'année de la date
+ * \return un entier long qui représente l'année de la date
+ */
+constexpr long Date::reqAnnee() const
+{
+	return m_annee;
+}
+/**
+ * \brief retourne le nombre de jours écoulés depuis le 1er janvier 1970
+ * \return un entier long qui représente la date en jours depuis l'époque
+ */
+constexpr long Date::reqJoursEpoque() const
+{
+	return m_jours;
+}
+/**
+ * \brief surcharge de l'opérateur ==
+ * \param[in] p_date à comparer à la date courante
+ * \return un booléen indiquant si les deux dates sont égales ou non
+ */
+constexpr bool Date::operator==(const Date& p_date) const
+{
+	return m_jours == p_date.m_jours;
+}
+/**
+ * \brief surcharge de l'opérateur <
+ * \param[in] p_date à comparer à la date courante
+ * \return un booléen indiquant si la date courante est plus petite que la date passée en paramètre
+ */
+constexpr bool Date::operator<(const Date& p_date) const
+{
+	return m_jours < p_date.m_jours;
+}
+/**
+ * \brief retourne le nombre de jours entre deux dates
+ * \param[in] p_date à soustraire à la date courante
+ * \return un entier qui représente le nombre de jours entre la date courante
+ * 	et celle passée en paramètre
+ */
+constexpr int Date::operator-(const Date& p_date) const
+{
+	return m_jours - p_date.m_jours;
+}
+/**
+ * \brief Déterminer si une année est bissextile ou non
+ * \param[in] p_annee un entier long qui représente l'année à vérifier
+ * \return un booléen qui a la valeur true si l'année est bissextile et false sinon
+ */
+constexpr bool Date::estBissextile(long p_annee)
+{
+	return (p_annee % 4 == 0 && p_annee % 100 != 0) || p_annee % 400 == 0;
+}
+/**
+ * \brief Vérifie la validité d'une date
+ * \param[in] p_jour un entier long représentant le jour de la date
+ * \param[in] p_mois un entier long représentant  le mois de la date
+ * \param[in] p_annee un entier long représentant l'année de la date
+ * \return un booléen indiquant si la date est valide ou non
+ */
+constexpr bool Date::validerDate(long p_jour, long p_mois, long p_annee)
+{
+	long JourParMois[] =
+	{ 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+	const long DEBUT_TEMPS = 1970;
+	const long FIN_TEMPS = 2037;
+
+	bool valide = false;
+
+	if (p_mois > 0 && p_mois <= 12 && p_annee >= DEBUT_TEMPS && p_annee <= FIN_TEMPS)
+	{
+		if (p_mois == 2 && Date::estBissextile(p_annee))
+		{
+			JourParMois[p_mois - 1]++;
+		}
+		if (p_jour > 0 && p_jour <= JourParMois[p_mois - 1])
+		{
+			valide = true;
+		}
+	}
+	return valide;
+}
+/**
+ * \brief Convertit une date du calendrier civil en nombre de jours depuis le 1er janvier 1970.
+ * 		  L'année est décalée pour commencer en mars, ce qui place le 29 février à la fin
+ * 		  d'un cycle et permet un calcul sans table ni branchement sur les mois.
+ * \param[in] p_jour un entier long représentant le jour de la date
+ * \param[in] p_mois un entier long représentant le mois de la date
+ * \param[in] p_annee un entier long représentant l'année de la date, postérieure à l'an 0
+ * \return le nombre de jours écoulés depuis le 1er janvier 1970
+ */
+constexpr long Date::joursDepuisCivil(long p_jour, long p_mois, long p_annee)
+{
+	const long annee = p_mois <= 2 ? p_annee - 1 : p_annee;
+	const long ere = annee / 400;
+	const long anneeEre = annee - ere * 400;
+	const long jourAnnee = (153 * (p_mois > 2 ? p_mois - 3 : p_mois + 9) + 2) / 5 + p_jour - 1;
+	const long jourEre = anneeEre * 365 + anneeEre / 4 - anneeEre / 100 + jourAnnee;
+	return ere * 146097 + jourEre - 719468;
+}
+
 } // namespace util
 
 #endif /* DATE_H_ */
-
@@ -5,29 +5,71 @@
 # Add inputs and outputs from these tool invocations to the build variables 
 CPP_SRCS += \
 ../Annuaire.cpp \
+../AnnuaireColonnes.cpp \
+../AnnuaireProjete.cpp \
+../ArenaMembres.cpp \
+../BornesAge.cpp \
 ../ContratException.cpp \
 ../Date.cpp \
 ../Entraineur.cpp \
+../FichierProjete.cpp \
+../Horloge.cpp \
+../ImportateurAnnuaire.cpp \
+../IndexHachage.cpp \
+../IndexNaissance.cpp \
+../IndexNoms.cpp \
+../InstantaneAnnuaire.cpp \
 ../Joueur.cpp \
 ../Personne.cpp \
+../RequeteAnnuaire.cpp \
+../SiteContrat.cpp \
+../TamponFormatage.cpp \
 ../validationFormat.cpp 
 
 OBJS += \
 ./Annuaire.o \
+./AnnuaireColonnes.o \
+./AnnuaireProjete.o \
+./ArenaMembres.o \
+./BornesAge.o \
 ./ContratException.o \
 ./Date.o \
 ./Entraineur.o \
+./FichierProjete.o \
+./Horloge.o \
+./ImportateurAnnuaire.o \
+./IndexHachage.o \
+./IndexNaissance.o \
+./IndexNoms.o \
+./InstantaneAnnuaire.o \
 ./Joueur.o \
 ./Personne.o \
+./RequeteAnnuaire.o \
+./SiteContrat.o \
+./TamponFormatage.o \
 ./validationFormat.o 
 
 CPP_DEPS += \
 ./Annuaire.d \
+./AnnuaireColonnes.d \
+./AnnuaireProjete.d \
+./ArenaMembres.d \
+./BornesAge.d \
 ./ContratException.d \
 ./Date.d \
 ./Entraineur.d \
+./FichierProjete.d \
+./Horloge.d \
+./ImportateurAnnuaire.d \
+./IndexHachage.d \
+./IndexNaissance.d \
+./IndexNoms.d \
+./InstantaneAnnuaire.d \
 ./Joueur.d \
 ./Personne.d \
+./RequeteAnnuaire.d \
+./SiteContrat.d \
+./TamponFormatage.d \
 ./validationFormat.d 
 
 
@@ -9,7 +9,10 @@
 
 #include "Entraineur.h"
 #include <sstream>
+#include <utility>
+#include <new>
 #include "validationFormat.h"
+#include "BornesAge.h"
 
 
 using namespace std;
@@ -27,25 +30,79 @@ namespace hockey
  * \param[in] p_numRAMQ est un string qui contient le numéro de RAMQ de l'entraineur, doit être un numéro valide
  * \param[in] p_sexe est un char qui contient le sexe de l'entraineur, doit être 'M' ou 'F'
  */
-Entraineur::Entraineur(const std::string& p_nom, const std::string& p_prenom, const util::Date& p_dateNaissance,
-			   	       const std::string& p_telephone, const std::string& p_numRAMQ, char p_sexe):
-					   Personne::Personne(p_nom, p_prenom, p_dateNaissance, p_telephone), m_numRAMQ(p_numRAMQ), m_sexe(p_sexe)
+Entraineur::Entraineur(std::string p_nom, std::string p_prenom, const util::Date& p_dateNaissance,
+			   	       std::string p_telephone, std::string p_numRAMQ, char p_sexe):
+					   Personne::Personne(std::move(p_nom), std::move(p_prenom), p_dateNaissance, std::move(p_telephone)),
+					   m_numRAMQ(std::move(p_numRAMQ)), m_sexe(p_sexe)
 {
 	PRECONDITION(util::validerNumRAMQ(reqNumRAMQ(), reqNom(), reqPrenom(), reqDateNaissance().reqJour(), reqDateNaissance().reqMois(),
 			reqDateNaissance().reqAnnee(), reqSexe()));
-	util::Date dateAujourdhui;
-	util::Date dateNaissanceMinimale(dateAujourdhui.reqJour(), dateAujourdhui.reqMois(), (dateAujourdhui.reqAnnee() - AGE_MINIMAL_ENTRAINEUR));
-	PRECONDITION(reqDateNaissance() <  dateNaissanceMinimale)
-	POSTCONDITION(reqNumRAMQ() == p_numRAMQ)
+	PRECONDITION(validerAge(reqDateNaissance()));
 	POSTCONDITION(reqSexe() == p_sexe)
 	INVARIANTS();
 }
 
+/**
+ * \brief Constructeur sans validation, pour des données déjà validées : chargement d'un
+ * 		  instantané par Annuaire, importation en lot par ConstructeurMembres
+ * \param[in] p_nom est un string qui contient le nom de l'entraineur
+ * \param[in] p_prenom est un string qui contient le prénom de l'entraineur
+ * \param[in] p_dateNaissance est un objet Date qui contient la date de naissance de l'entraineur
+ * \param[in] p_telephone est un string qui contient le numéro de téléphone de l'entraineur
+ * \param[in] p_numRAMQ est un string qui contient le numéro de RAMQ de l'entraineur
+ * \param[in] p_sexe est un char qui contient le sexe de l'entraineur
+ */
+Entraineur::Entraineur(std::string p_nom, std::string p_prenom, const util::Date& p_dateNaissance,
+					   std::string p_telephone, std::string p_numRAMQ, char p_sexe,
+					   SansValidation p_sansValidation):
+					   Personne::Personne(std::move(p_nom), std::move(p_prenom), p_dateNaissance, std::move(p_telephone),
+					   p_sansValidation), m_numRAMQ(std::move(p_numRAMQ)), m_sexe(p_sexe)
+{
+}
+
+/**
+ * \brief Fabrique qui valide les données avant de construire l'entraineur, sans lancer d'exception
+ * 		  Les données sont vérifiées dans l'ordre : nom, prénom, téléphone, sexe, numéro de RAMQ
+ * 		  puis âge. Contrairement au constructeur, un sexe autre que 'M' ou 'F' est refusé.
+ * \param[in] p_nom est un string qui contient le nom de l'entraineur
+ * \param[in] p_prenom est un string qui contient le prénom de l'entraineur
+ * \param[in] p_dateNaissance est un objet Date qui contient la date de naissance de l'entraineur
+ * \param[in] p_telephone est un string qui contient le numéro de téléphone de l'entraineur
+ * \param[in] p_numRAMQ est un string qui contient le numéro de RAMQ de l'entraineur
+ * \param[in] p_sexe est un char qui contient le sexe de l'entraineur
+ * \return l'entraineur construit, ou le code de la première donnée invalide
+ */
+Resultat<Entraineur> Entraineur::creer(std::string p_nom, std::string p_prenom, const util::Date& p_dateNaissance,
+									   std::string p_telephone, std::string p_numRAMQ, char p_sexe)
+{
+	CodeErreur erreur = validerPersonne(p_nom, p_prenom, p_telephone);
+	if (erreur == CodeErreur::Aucune && p_sexe != 'M' && p_sexe != 'F')
+	{
+		erreur = CodeErreur::SexeInvalide;
+	}
+	if (erreur == CodeErreur::Aucune && !util::validerNumRAMQ(p_numRAMQ, p_nom, p_prenom, p_dateNaissance.reqJour(),
+															   p_dateNaissance.reqMois(), p_dateNaissance.reqAnnee(), p_sexe))
+	{
+		erreur = CodeErreur::NumRAMQInvalide;
+	}
+	if (erreur == CodeErreur::Aucune && !validerAge(p_dateNaissance))
+	{
+		erreur = CodeErreur::AgeInvalide;
+	}
+
+	if (erreur != CodeErreur::Aucune)
+	{
+		return Resultat<Entraineur>(erreur);
+	}
+	return Resultat<Entraineur>(Entraineur(std::move(p_nom), std::move(p_prenom), p_dateNaissance, std::move(p_telephone),
+										   std::move(p_numRAMQ), p_sexe, SansValidation()));
+}
+
 /**
  * \brief Retourne le numéro de RAMQ de l'entraineur
  * \return un string contenant le numéro de RAMQ de l'entraineur
  */
-const std::string Entraineur::reqNumRAMQ() const
+const std::string& Entraineur::reqNumRAMQ() const
 {
 	return m_numRAMQ;
 }
@@ -60,24 +117,21 @@ char Entraineur::reqSexe() const
 }
 
 /**
- * \brief Retourne les informations de l'entraineur en format formaté
+ * \brief Ajoute les informations de l'entraineur en format formaté à la fin d'un tampon de formatage
  * 		  Selon le format :
  * 		  Nom               : Louis
  *		  Prenom            : Jean
  *		  Date de naissance : Samedi le 12 mai 1979
  *		  Telephone         : 418 656-2131
  *		  Numero de RAMQ    : JEAL 7905 1203
- * \return un string contenant les informations formatés
+ * \param[in,out] p_tampon est le tampon dans lequel les informations sont écrites
  */
-std::string Entraineur::reqPersonneFormate() const
+void Entraineur::formaterPersonne(util::TamponFormatage& p_tampon) const
 {
-	ostringstream oss;
-
-	oss << Personne::reqPersonneFormate();
-	oss << "Numero de RAMQ    : " << m_numRAMQ << endl;
-	oss << "---------------------" << endl;
-
-	return oss.str();
+	Personne::formaterPersonne(p_tampon);
+	p_tampon.ajouter("Numero de RAMQ    : ", 20);
+	p_tampon.ajouter(m_numRAMQ);
+	p_tampon.ajouter("\n---------------------\n", 23);
 }
 
 /**
@@ -89,6 +143,41 @@ Personne* Entraineur::clone() const
 	return new Entraineur(*this);
 }
 
+/**
+ * \brief Retourne une copie de l'objet Entraineur construite dans une arène
+ * 		  La copie doit être détruite par un appel explicite au destructeur, sa mémoire
+ * 		  est rendue lors de la libération de l'arène
+ * \param[in] p_arena est l'arène dans laquelle la copie est construite
+ * \return un pointeur vers la copie de l'entraineur
+ */
+Personne* Entraineur::clone(ArenaMembres& p_arena) const &
+{
+	return new (p_arena.allouer(sizeof(Entraineur), alignof(Entraineur))) Entraineur(*this);
+}
+
+/**
+ * \brief Déplace l'entraineur dans une arène, sans copier ses chaînes
+ * 		  L'entraineur d'origine ne peut plus qu'être détruit ou réassigné. Le membre déplacé doit
+ * 		  être détruit par un appel explicite au destructeur, sa mémoire est rendue lors de la
+ * 		  libération de l'arène
+ * \param[in] p_arena est l'arène dans laquelle l'entraineur est déplacé
+ * \return un pointeur vers l'entraineur déplacé
+ */
+Personne* Entraineur::clone(ArenaMembres& p_arena) &&
+{
+	return new (p_arena.allouer(sizeof(Entraineur), alignof(Entraineur))) Entraineur(std::move(*this));
+}
+
+/**
+ * \brief Détermine si une date de naissance donne au moins AGE_MINIMAL_ENTRAINEUR ans à la date du jour de util::Horloge
+ * \param[in] p_dateNaissance est la date de naissance à valider
+ * \return un bool indiquant si l'âge est valide ou non
+ */
+bool Entraineur::validerAge(const util::Date& p_dateNaissance)
+{
+	return BornesAge::reqBornesAujourdhui().validerAgeEntraineur(p_dateNaissance);
+}
+
 /**
  * \brief Vérification des invariants de la classe Entraineur
  */
@@ -96,9 +185,7 @@ void Entraineur::verifieInvariant() const
 {
 	INVARIANT(util::validerNumRAMQ(reqNumRAMQ(), reqNom(), reqPrenom(), reqDateNaissance().reqJour(), reqDateNaissance().reqMois(),
 			reqDateNaissance().reqAnnee(), reqSexe()));
-	util::Date dateAujourdhui;
-	util::Date dateNaissanceMinimale(dateAujourdhui.reqJour(), dateAujourdhui.reqMois(), (dateAujourdhui.reqAnnee() - AGE_MINIMAL_ENTRAINEUR));
-	INVARIANT(reqDateNaissance() <  dateNaissanceMinimale)
+	INVARIANT(validerAge(reqDateNaissance()));
 }
 
 }
@@ -27,7 +27,8 @@ namespace hockey
  * \class Entraineur
  * \brief Cette classe permet le stockage d'informations associées à un entraineur
  *
- * 		On peut cloner l'entraineur à l'aide de la méthode clone()
+ * 		On peut cloner l'entraineur à l'aide de la méthode clone(). La fabrique creer() valide
+ * 		les données sans lancer d'exception et retourne un code d'erreur si elles sont invalides.
  *
  * 		Attributs: m_numRAMQ: un string contenant le numéro de RAMQ de l'entraineur
  * 				   m_sexe : un char contenant le sexe de l'entraineur (M/F)
@@ -35,16 +36,31 @@ namespace hockey
 class Entraineur: public Personne
 {
 public:
-	Entraineur(const std::string& p_nom, const std::string& p_prenom, const util::Date& p_dateNaissance,
-			   const std::string& p_telephone, const std::string& p_numRAMQ, char p_sexe);
+	Entraineur(std::string p_nom, std::string p_prenom, const util::Date& p_dateNaissance,
+			   std::string p_telephone, std::string p_numRAMQ, char p_sexe);
+	Entraineur(const Entraineur& p_entraineur) = default;
+	Entraineur(Entraineur&& p_entraineur) = default;
+	Entraineur& operator=(const Entraineur& p_entraineur) = default;
+	Entraineur& operator=(Entraineur&& p_entraineur) = default;
 
-	const std::string reqNumRAMQ() const;
+	static Resultat<Entraineur> creer(std::string p_nom, std::string p_prenom, const util::Date& p_dateNaissance,
+									  std::string p_telephone, std::string p_numRAMQ, char p_sexe);
+
+	const std::string& reqNumRAMQ() const;
 	char reqSexe() const;
+	static bool validerAge(const util::Date& p_dateNaissance);
 
-	virtual std::string reqPersonneFormate() const;
+	virtual void formaterPersonne(util::TamponFormatage& p_tampon) const;
 	virtual ~Entraineur() {} ;
 	virtual Personne* clone() const;
+	virtual Personne* clone(ArenaMembres& p_arena) const &;
+	virtual Personne* clone(ArenaMembres& p_arena) &&;
 private:
+	friend class Annuaire;
+	friend class ConstructeurMembres;
+	Entraineur(std::string p_nom, std::string p_prenom, const util::Date& p_dateNaissance,
+			   std::string p_telephone, std::string p_numRAMQ, char p_sexe, SansValidation);
+
 	void verifieInvariant() const;
 	std::string m_numRAMQ;
 	char m_sexe;
@@ -0,0 +1,164 @@
+/**
+ * \file FichierProjete.cpp
+ * \brief Fichier d'implementation de la classe FichierProjete
+ * \author David Jalbert Ross
+ * \version 1.0
+ * \date 16 avril 2020
+ */
+
+#include "FichierProjete.h"
+#include <cstdint>
+#include <fstream>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+namespace util
+{
+
+/**
+ * \brief Constructeur par défaut
+ * 		  On construit un objet qui ne projette aucun fichier
+ */
+FichierProjete::FichierProjete():
+		m_donnees(nullptr), m_taille(0), m_projete(false)
+{
+	INVARIANTS();
+}
+
+/**
+ * \brief Destructeur qui retire la projection, le cas échéant
+ */
+FichierProjete::~FichierProjete()
+{
+	fermer();
+}
+
+/**
+ * \brief Ouvre un fichier et le projette en mémoire, en lecture seule
+ * 		  Le fichier précédemment ouvert, s'il y en a un, est d'abord fermé.
+ * \param[in] p_fichier est le chemin du fichier à ouvrir
+ * \return un booléen indiquant si le fichier a pu être ouvert et projeté, faux s'il est vide
+ */
+bool FichierProjete::ouvrir(const std::string& p_fichier)
+{
+	fermer();
+
+#if !defined(_WIN32)
+	int descripteur = ::open(p_fichier.c_str(), O_RDONLY);
+	if (descripteur < 0)
+	{
+		return false;
+	}
+
+	struct stat infoFichier;
+	bool valide = ::fstat(descripteur, &infoFichier) == 0 && S_ISREG(infoFichier.st_mode);
+	if (valide && infoFichier.st_size > 0)
+	{
+		void* projection = ::mmap(nullptr, infoFichier.st_size, PROT_READ, MAP_PRIVATE, descripteur, 0);
+		valide = projection != MAP_FAILED;
+		if (valide)
+		{
+			m_donnees = static_cast<const char*>(projection);
+			m_taille = infoFichier.st_size;
+			m_projete = true;
+		}
+	}
+	// La projection reste valide après la fermeture du descripteur
+	::close(descripteur);
+#else
+	std::ifstream entree(p_fichier.c_str(), std::ios::binary | std::ios::ate);
+	bool valide = entree.is_open();
+	if (valide)
+	{
+		std::streamoff taille = entree.tellg();
+		entree.seekg(0);
+		if (taille > 0)
+		{
+			// Des mots de 8 octets garantissent l'alignement des sections du fichier
+			std::uint64_t* tampon = new std::uint64_t[(taille + 7) / 8];
+			valide = static_cast<bool>(entree.read(reinterpret_cast<char*>(tampon), taille));
+			if (valide)
+			{
+				m_donnees = reinterpret_cast<const char*>(tampon);
+				m_taille = taille;
+			}
+			else
+			{
+				delete[] tampon;
+			}
+		}
+	}
+#endif
+
+	INVARIANTS();
+	return valide && estOuvert();
+}
+
+/**
+ * \brief Retire la projection du fichier ouvert, le cas échéant
+ */
+void FichierProjete::fermer()
+{
+	if (m_donnees != nullptr)
+	{
+#if !defined(_WIN32)
+		if (m_projete)
+		{
+			::munmap(const_cast<char*>(m_donnees), m_taille);
+		}
+#else
+		delete[] reinterpret_cast<const std::uint64_t*>(m_donnees);
+#endif
+	}
+	m_donnees = nullptr;
+	m_taille = 0;
+	m_projete = false;
+
+	POSTCONDITION(!estOuvert());
+	INVARIANTS();
+}
+
+/**
+ * \brief Indique si un fichier non vide est ouvert
+ * \return un booléen indiquant si le contenu d'un fichier est disponible
+ */
+bool FichierProjete::estOuvert() const
+{
+	return m_donnees != nullptr;
+}
+
+/**
+ * \brief Retourne le début du contenu du fichier
+ * \return un pointeur vers le premier octet du fichier, aligné sur 8 octets, ou nullptr
+ */
+const char* FichierProjete::reqDonnees() const
+{
+	return m_donnees;
+}
+
+/**
+ * \brief Retourne la taille du fichier ouvert
+ * \return la taille du fichier en octets
+ */
+std::size_t FichierProjete::reqTaille() const
+{
+	return m_taille;
+}
+
+/**
+ * \brief Vérification des invariants de la classe FichierProjete
+ */
+void FichierProjete::verifieInvariant() const
+{
+	INVARIANT((m_donnees == nullptr) == (m_taille == 0));
+	INVARIANT(reinterpret_cast<std::uintptr_t>(m_donnees) % 8 == 0);
+}
+
+}
@@ -0,0 +1,58 @@
+/**
+ * \file FichierProjete.h
+ * \brief Fichier contenant l'interface de la classe FichierProjete, un fichier projeté en mémoire en lecture seule
+ * \author David Jalbert Ross
+ * \version 1.0
+ * \date 16 avril 2020
+ */
+
+#ifndef FICHIERPROJETE_H_
+#define FICHIERPROJETE_H_
+
+#include <cstddef>
+#include <string>
+#include "ContratException.h"
+
+namespace util
+{
+
+/**
+ * \class FichierProjete
+ * \brief Fichier ouvert en lecture seule et projeté en mémoire
+ *
+ * 		Sous POSIX, le fichier est projeté avec mmap() : les pages sont chargées à la demande
+ * 		et partagées entre tous les processus qui projettent le même fichier. Sur les autres
+ * 		systèmes, le fichier est lu en entier dans un tampon aligné sur 8 octets.
+ * 		La projection est retirée par fermer() ou par le destructeur.
+ *
+ * 		Attributs: m_donnees: le début du contenu du fichier, nullptr si aucun fichier n'est ouvert
+ * 				   m_taille : la taille du fichier en octets
+ * 				   m_projete : indique si m_donnees provient de mmap() plutôt que du tas
+ */
+class FichierProjete
+{
+public:
+	FichierProjete();
+	~FichierProjete();
+
+	bool ouvrir(const std::string& p_fichier);
+	void fermer();
+
+	bool estOuvert() const;
+	const char* reqDonnees() const;
+	std::size_t reqTaille() const;
+
+private:
+	FichierProjete(const FichierProjete&);
+	FichierProjete& operator=(const FichierProjete&);
+
+	void verifieInvariant() const;
+
+	const char* m_donnees;
+	std::size_t m_taille;
+	bool m_projete;
+};
+
+}
+
+#endif
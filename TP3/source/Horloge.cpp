@@ -0,0 +1,103 @@
+/**
+ * \file Horloge.cpp
+ * \brief Fichier d'implementation de la classe Horloge
+ * \author David Jalbert Ross
+ * \version 1.0
+ * \date 16 avril 2020
+ */
+
+#include "Horloge.h"
+#include <atomic>
+#include <ctime>
+
+namespace
+{
+const long AUCUNE_DATE_FIXEE = -1;
+
+// Date fixée par fixerAujourdhui(), en jours depuis le 1er janvier 1970
+std::atomic<long> s_joursFixes(AUCUNE_DATE_FIXEE);
+
+/**
+ * \struct JourSysteme
+ * \brief Date du jour d'un fil d'exécution et instant où elle cesse d'être valide
+ */
+struct JourSysteme
+{
+	std::time_t m_finJour;
+	util::Date m_aujourdhui;
+};
+}
+
+namespace util
+{
+
+/**
+ * \brief Retourne la date du jour, fixée ou lue du système
+ * 		  La date du système n'est recalculée qu'au premier appel d'un fil et après minuit.
+ * \return un objet Date contenant la date du jour
+ */
+Date Horloge::reqAujourdhui()
+{
+	long joursFixes = s_joursFixes.load(std::memory_order_relaxed);
+	if (joursFixes != AUCUNE_DATE_FIXEE)
+	{
+		return Date::dateDepuisJoursEpoque(joursFixes);
+	}
+
+	thread_local JourSysteme jourSysteme = { 0, Date(1, 1, 1970) };
+	std::time_t maintenant = std::time(NULL);
+	if (maintenant >= jourSysteme.m_finJour)
+	{
+		struct tm infoTemps;
+#if defined(_WIN32)
+		bool conversionReussie = localtime_s(&infoTemps, &maintenant) == 0;
+#else
+		bool conversionReussie = localtime_r(&maintenant, &infoTemps) != NULL;
+#endif
+		ASSERTION(conversionReussie);
+		static_cast<void>(conversionReussie);	// ASSERTION disparaît avec NDEBUG
+		jourSysteme.m_aujourdhui = Date(infoTemps.tm_mday, infoTemps.tm_mon + 1, infoTemps.tm_year + 1900);
+
+		// Minuit du lendemain, heure locale; mktime() normalise le jour qui dépasse la fin du mois
+		infoTemps.tm_mday++;
+		infoTemps.tm_hour = 0;
+		infoTemps.tm_min = 0;
+		infoTemps.tm_sec = 0;
+		infoTemps.tm_isdst = -1;
+		jourSysteme.m_finJour = std::mktime(&infoTemps);
+	}
+	return jourSysteme.m_aujourdhui;
+}
+
+/**
+ * \brief Fixe la date du jour retournée par reqAujourdhui() dans tous les fils, jusqu'à l'appel de suivreSysteme()
+ * \param[in] p_aujourdhui est la date du jour à utiliser
+ */
+void Horloge::fixerAujourdhui(const Date& p_aujourdhui)
+{
+	s_joursFixes.store(p_aujourdhui.reqJoursEpoque(), std::memory_order_relaxed);
+
+	POSTCONDITION(estFixee());
+	POSTCONDITION(reqAujourdhui() == p_aujourdhui);
+}
+
+/**
+ * \brief Rétablit la date du système comme date du jour
+ */
+void Horloge::suivreSysteme()
+{
+	s_joursFixes.store(AUCUNE_DATE_FIXEE, std::memory_order_relaxed);
+
+	POSTCONDITION(!estFixee());
+}
+
+/**
+ * \brief Indique si la date du jour a été fixée par fixerAujourdhui()
+ * \return vrai si la date est fixée, faux si elle suit le système
+ */
+bool Horloge::estFixee()
+{
+	return s_joursFixes.load(std::memory_order_relaxed) != AUCUNE_DATE_FIXEE;
+}
+
+}
@@ -0,0 +1,41 @@
+/**
+ * \file Horloge.h
+ * \brief Fichier contenant l'interface de la classe Horloge, qui fournit la date du jour
+ * \author David Jalbert Ross
+ * \version 1.0
+ * \date 16 avril 2020
+ */
+
+#ifndef HORLOGE_H_
+#define HORLOGE_H_
+
+#include "Date.h"
+
+namespace util
+{
+
+/**
+ * \class Horloge
+ * \brief Source de la date du jour commune aux validations d'âge
+ *
+ * 		Construire une Date par défaut interroge le système (time() et localtime()) à chaque
+ * 		appel. L'horloge garde la date du jour de chaque fil d'exécution jusqu'à minuit,
+ * 		heure locale : un appel ne coûte alors qu'une lecture de time(). Les tests peuvent
+ * 		fixer la date du jour avec fixerAujourdhui() pour obtenir des résultats qui ne
+ * 		dépendent pas du jour où ils sont exécutés; la date fixée vaut pour tous les fils.
+ */
+class Horloge
+{
+public:
+	static Date reqAujourdhui();
+	static void fixerAujourdhui(const Date& p_aujourdhui);
+	static void suivreSysteme();
+	static bool estFixee();
+
+private:
+	Horloge();
+};
+
+}
+
+#endif
@@ -0,0 +1,694 @@
+/**
+ * \file ImportateurAnnuaire.cpp
+ * \brief Fichier d'implementation de la classe ImportateurAnnuaire
+ * \author David Jalbert Ross
+ * \version 1.0
+ * \date 16 avril 2020
+ */
+
+#include "ImportateurAnnuaire.h"
+#include <string>
+#include <memory>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include "validationFormat.h"
+#include "Date.h"
+#include "Joueur.h"
+#include "Entraineur.h"
+#include "BornesAge.h"
+
+using namespace std;
+
+namespace
+{
+const std::size_t NB_CHAMPS_JOUEUR = 6;
+const std::size_t NB_CHAMPS_ENTRAINEUR = 7;
+
+/**
+ * \struct LotImportation
+ * \brief Lignes d'un lot en cours de traitement, rangées en colonnes : chaque champ du lot est
+ * 		  contigu et peut être passé tel quel aux fonctions de validation en lot. Les chaînes sont
+ * 		  réutilisées d'un lot à l'autre pour éviter de les réallouer.
+ *
+ * 		Attributs: m_vLignes : le numéro de chaque ligne dans le flux
+ * 				   m_vNbChamps : le nombre de champs de chaque ligne
+ * 				   m_vChamps : une colonne par champ; les champs absents d'une ligne y sont périmés
+ * 				   m_vDates : les dates de naissance compactées selon annee << 9 | mois << 5 | jour,
+ * 				   			  0 si la date n'a pas été lue
+ * 				   m_vSexes : le sexe de chaque ligne, 0 s'il n'est pas formé d'un seul caractère
+ * 				   m_vErreurs : l'erreur de chaque ligne, nullptr si elle est valide
+ * 				   m_vMembres : le membre construit pour chaque ligne valide
+ * 				   m_valides : le résultat d'une validation en lot, pour chaque ligne
+ */
+struct LotImportation
+{
+	explicit LotImportation(std::size_t p_taille);
+
+	std::size_t reqTaille() const
+	{
+		return m_vLignes.size();
+	}
+
+	std::vector<unsigned long> m_vLignes;
+	std::vector<std::size_t> m_vNbChamps;
+	std::vector<std::string> m_vChamps[NB_CHAMPS_ENTRAINEUR];
+	std::vector<std::uint32_t> m_vDates;
+	std::vector<char> m_vSexes;
+	std::vector<const char*> m_vErreurs;
+	std::vector<std::unique_ptr<hockey::Personne>> m_vMembres;
+	std::unique_ptr<bool[]> m_valides;
+};
+
+/**
+ * \brief Constructeur : alloue les colonnes d'un lot de p_taille lignes
+ */
+LotImportation::LotImportation(std::size_t p_taille):
+		m_vLignes(p_taille), m_vNbChamps(p_taille), m_vDates(p_taille), m_vSexes(p_taille), m_vErreurs(p_taille),
+		m_vMembres(p_taille), m_valides(new bool[p_taille])
+{
+	for (std::vector<std::string>& colonne : m_vChamps)
+	{
+		colonne.resize(p_taille);
+	}
+}
+
+/**
+ * \brief Découpe une ligne selon un délimiteur dans les colonnes d'un lot
+ * 		  Seuls les NB_CHAMPS_ENTRAINEUR premiers champs sont copiés; les suivants ne sont que comptés.
+ * \param[in] p_ligne est la ligne à découper
+ * \param[in] p_delimiteur est le caractère séparant les champs
+ * \param[in,out] p_lot est le lot dont les colonnes reçoivent les champs
+ * \param[in] p_indice est l'indice de la ligne dans le lot
+ * \return le nombre de champs trouvés
+ */
+std::size_t decouper(const std::string& p_ligne, char p_delimiteur, LotImportation& p_lot, std::size_t p_indice)
+{
+	std::size_t nbChamps = 0;
+	std::string::size_type debut = 0;
+	bool fini = false;
+
+	while (!fini)
+	{
+		std::string::size_type fin = p_ligne.find(p_delimiteur, debut);
+		if (fin == std::string::npos)
+		{
+			fin = p_ligne.length();
+			fini = true;
+		}
+		if (nbChamps < NB_CHAMPS_ENTRAINEUR)
+		{
+			p_lot.m_vChamps[nbChamps][p_indice].assign(p_ligne, debut, fin - debut);
+		}
+		nbChamps++;
+		debut = fin + 1;
+	}
+
+	return nbChamps;
+}
+
+/**
+ * \brief Lit un nombre entier positif dans une chaîne
+ * \param[in] p_texte est la chaîne lue
+ * \param[in,out] p_position est la position de lecture, avancée après les chiffres lus
+ * \param[out] p_valeur reçoit le nombre lu
+ * \return un booléen indiquant si au moins un chiffre a été lu
+ */
+bool lireEntier(const std::string& p_texte, std::string::size_type& p_position, long& p_valeur)
+{
+	std::string::size_type debut = p_position;
+	p_valeur = 0;
+	while (p_position < p_texte.length() && p_position - debut < 4 && p_texte[p_position] >= '0' && p_texte[p_position] <= '9')
+	{
+		p_valeur = p_valeur * 10 + (p_texte[p_position] - '0');
+		p_position++;
+	}
+	return p_position > debut;
+}
+
+/**
+ * \brief Lit une date au format JJ/MM/AAAA
+ * \param[in] p_texte est le champ de date lu
+ * \param[out] p_date reçoit la date compactée selon annee << 9 | mois << 5 | jour si elle est valide
+ * \return un booléen indiquant si le champ a le bon format et correspond à une date valide
+ */
+bool lireDate(const std::string& p_texte, std::uint32_t& p_date)
+{
+	std::string::size_type position = 0;
+	long jour = 0;
+	long mois = 0;
+	long annee = 0;
+
+	bool valide = lireEntier(p_texte, position, jour) && position < p_texte.length() && p_texte[position++] == '/'
+			&& lireEntier(p_texte, position, mois) && position < p_texte.length() && p_texte[position++] == '/'
+			&& lireEntier(p_texte, position, annee) && position == p_texte.length()
+			&& util::Date::validerDate(jour, mois, annee);
+
+	if (valide)
+	{
+		p_date = static_cast<std::uint32_t>(annee << 9 | mois << 5 | jour);
+	}
+	return valide;
+}
+
+/**
+ * \brief Indique si une ligne d'un lot décrit un joueur. Le rôle doit avoir été validé.
+ */
+bool estJoueur(const LotImportation& p_lot, std::size_t p_indice)
+{
+	return p_lot.m_vChamps[0][p_indice] == "J";
+}
+
+/**
+ * \brief Lit et découpe un lot de lignes de données
+ * \param[in,out] p_entree est le flux lu
+ * \param[in] p_delimiteur est le caractère séparant les champs
+ * \param[out] p_lot reçoit les lignes lues, au plus sa taille
+ * \param[in,out] p_noLigne est le numéro de la dernière ligne lue du flux
+ * \return le nombre de lignes de données placées dans le lot
+ */
+unsigned int lireLot(std::istream& p_entree, char p_delimiteur, LotImportation& p_lot, unsigned long& p_noLigne)
+{
+	std::string tampon;
+	unsigned int nbLignesLot = 0;
+
+	while (nbLignesLot < p_lot.reqTaille() && std::getline(p_entree, tampon))
+	{
+		p_noLigne++;
+		if (!tampon.empty() && tampon[tampon.length() - 1] == '\r')
+		{
+			tampon.erase(tampon.length() - 1);
+		}
+		if (!tampon.empty() && tampon[0] != '#')
+		{
+			p_lot.m_vLignes[nbLignesLot] = p_noLigne;
+			p_lot.m_vNbChamps[nbLignesLot] = decouper(tampon, p_delimiteur, p_lot, nbLignesLot);
+			p_lot.m_vErreurs[nbLignesLot] = nullptr;
+			p_lot.m_vMembres[nbLignesLot].reset();
+			nbLignesLot++;
+		}
+	}
+
+	return nbLignesLot;
+}
+
+/**
+ * \brief Consigne une erreur pour chaque ligne d'une tranche encore valide dont le résultat
+ * 		  de la dernière validation en lot est faux
+ * \param[in,out] p_lot est le lot
+ * \param[in] p_debut est la première ligne de la tranche
+ * \param[in] p_fin est la ligne suivant la dernière ligne de la tranche
+ * \param[in] p_erreur est le message consigné
+ */
+void consignerInvalides(LotImportation& p_lot, unsigned int p_debut, unsigned int p_fin, const char* p_erreur)
+{
+	for (unsigned int i = p_debut; i < p_fin; i++)
+	{
+		if (p_lot.m_vErreurs[i] == nullptr && !p_lot.m_valides[i])
+		{
+			p_lot.m_vErreurs[i] = p_erreur;
+		}
+	}
+}
+
+/**
+ * \brief Valide une tranche d'un lot, un champ à la fois, et construit les membres des lignes valides.
+ * 		  Les noms, prénoms, téléphones et numéros de RAMQ sont validés par colonne entière avec
+ * 		  validerFormatNoms(), validerTelephones() et validerNumRAMQs(); seul le résultat des
+ * 		  lignes encore valides est retenu, de sorte que chaque ligne reçoit la première erreur
+ * 		  dans l'ordre des champs. Les membres sont construits sans revalidation.
+ * 		  Une tranche n'écrit que ses propres lignes : des tranches distinctes peuvent être
+ * 		  validées en parallèle.
+ * \param[in,out] p_lot est le lot; l'erreur ou le membre construit est assigné à chaque ligne
+ * \param[in] p_debut est la première ligne de la tranche
+ * \param[in] p_fin est la ligne suivant la dernière ligne de la tranche
+ * \param[in] p_bornes sont les dates de naissance limites
+ * \param[in] p_constructeur construit les membres des lignes valides
+ */
+void validerLot(LotImportation& p_lot, unsigned int p_debut, unsigned int p_fin, const hockey::BornesAge& p_bornes,
+				const hockey::ConstructeurMembres& p_constructeur)
+{
+	const std::vector<std::string>& vRoles = p_lot.m_vChamps[0];
+	const std::vector<std::string>& vNoms = p_lot.m_vChamps[1];
+	const std::vector<std::string>& vPrenoms = p_lot.m_vChamps[2];
+	const std::vector<std::string>& vTelephones = p_lot.m_vChamps[4];
+	const std::vector<std::string>& vCinquiemes = p_lot.m_vChamps[5];
+	const std::vector<std::string>& vSexes = p_lot.m_vChamps[6];
+	std::size_t nbLignes = p_fin - p_debut;
+	bool* valides = p_lot.m_valides.get() + p_debut;
+
+	for (unsigned int i = p_debut; i < p_fin; i++)
+	{
+		if (vRoles[i] != "J" && vRoles[i] != "E")
+		{
+			p_lot.m_vErreurs[i] = "Rôle invalide";
+		}
+		else if (p_lot.m_vNbChamps[i] != (estJoueur(p_lot, i) ? NB_CHAMPS_JOUEUR : NB_CHAMPS_ENTRAINEUR))
+		{
+			p_lot.m_vErreurs[i] = "Nombre de champs invalide";
+		}
+	}
+
+	util::validerFormatNoms(vNoms.data() + p_debut, nbLignes, valides);
+	consignerInvalides(p_lot, p_debut, p_fin, "Nom invalide");
+	util::validerFormatNoms(vPrenoms.data() + p_debut, nbLignes, valides);
+	consignerInvalides(p_lot, p_debut, p_fin, "Prénom invalide");
+
+	for (unsigned int i = p_debut; i < p_fin; i++)
+	{
+		p_lot.m_vDates[i] = 0;
+		if (p_lot.m_vErreurs[i] == nullptr && !lireDate(p_lot.m_vChamps[3][i], p_lot.m_vDates[i]))
+		{
+			p_lot.m_vErreurs[i] = "Date de naissance invalide";
+		}
+	}
+
+	util::validerTelephones(vTelephones.data() + p_debut, nbLignes, valides);
+	consignerInvalides(p_lot, p_debut, p_fin, "Téléphone invalide");
+
+	for (unsigned int i = p_debut; i < p_fin; i++)
+	{
+		p_lot.m_vSexes[i] = 0;
+		if (p_lot.m_vErreurs[i] == nullptr)
+		{
+			if (estJoueur(p_lot, i))
+			{
+				if (!hockey::Joueur::validerPosition(vCinquiemes[i]))
+				{
+					p_lot.m_vErreurs[i] = "Position invalide";
+				}
+			}
+			else if (vSexes[i] != "M" && vSexes[i] != "F")
+			{
+				p_lot.m_vErreurs[i] = "Sexe invalide";
+			}
+			else
+			{
+				p_lot.m_vSexes[i] = vSexes[i][0];
+			}
+		}
+	}
+
+	// Les lignes de joueurs et les lignes déjà en erreur passent aussi dans validerNumRAMQs(),
+	// qui accepte n'importe quel contenu; leur résultat est ignoré.
+	util::validerNumRAMQs(vCinquiemes.data() + p_debut, vNoms.data() + p_debut, vPrenoms.data() + p_debut,
+						  p_lot.m_vDates.data() + p_debut, p_lot.m_vSexes.data() + p_debut, nbLignes, valides);
+	for (unsigned int i = p_debut; i < p_fin; i++)
+	{
+		if (p_lot.m_vErreurs[i] == nullptr && !estJoueur(p_lot, i) && !p_lot.m_valides[i])
+		{
+			p_lot.m_vErreurs[i] = "Numéro de RAMQ invalide";
+		}
+	}
+
+	for (unsigned int i = p_debut; i < p_fin; i++)
+	{
+		if (p_lot.m_vErreurs[i] == nullptr)
+		{
+			std::uint32_t date = p_lot.m_vDates[i];
+			util::Date naissance(date & 0x1F, (date >> 5) & 0x0F, date >> 9);
+			if (estJoueur(p_lot, i))
+			{
+				if (p_bornes.validerAgeJoueur(naissance))
+				{
+					p_lot.m_vMembres[i].reset(p_constructeur.construireJoueur(vNoms[i], vPrenoms[i], naissance,
+																			  vTelephones[i], vCinquiemes[i]));
+				}
+				else
+				{
+					p_lot.m_vErreurs[i] = "Âge invalide";
+				}
+			}
+			else if (p_bornes.validerAgeEntraineur(naissance))
+			{
+				p_lot.m_vMembres[i].reset(p_constructeur.construireEntraineur(vNoms[i], vPrenoms[i], naissance,
+																			  vTelephones[i], vCinquiemes[i],
+																			  p_lot.m_vSexes[i]));
+			}
+			else
+			{
+				p_lot.m_vErreurs[i] = "Âge invalide";
+			}
+		}
+	}
+}
+
+/**
+ * \class ReserveFils
+ * \brief Nombre fixe de fils qui exécutent, dans l'ordre de soumission, les tâches d'une file
+ *
+ * 		Les fils sont créés une fois, à la construction, et joints par le destructeur : une
+ * 		exception levée par le fil propriétaire ne peut pas laisser de fil joignable. Les
+ * 		tâches encore en file à la destruction sont abandonnées. L'exception levée par une
+ * 		tâche est transmise par le std::future retourné à sa soumission.
+ *
+ * 		Attributs: m_mutex: protège la file et l'indicateur d'arrêt
+ * 				   m_condition : réveille les fils quand une tâche est soumise ou à l'arrêt
+ * 				   m_taches : la file des tâches en attente
+ * 				   m_arret : indique que les fils doivent terminer
+ * 				   m_vFils : les fils de la réserve
+ */
+class ReserveFils
+{
+public:
+	explicit ReserveFils(unsigned int p_nbFils);
+	~ReserveFils();
+
+	std::future<void> soumettre(std::function<void()> p_tache);
+
+private:
+	ReserveFils(const ReserveFils&);
+	ReserveFils& operator=(const ReserveFils&);
+
+	void travailler();
+	void arreter();
+
+	std::mutex m_mutex;
+	std::condition_variable m_condition;
+	std::deque<std::packaged_task<void()>> m_taches;
+	bool m_arret;
+	std::vector<std::thread> m_vFils;
+};
+
+/**
+ * \brief Constructeur : démarre p_nbFils fils. Si un fil ne peut être créé, ceux déjà
+ * 		  démarrés sont joints avant que l'exception ne soit propagée.
+ * \param[in] p_nbFils est le nombre de fils, plus grand que 0
+ */
+ReserveFils::ReserveFils(unsigned int p_nbFils):
+		m_arret(false)
+{
+	PRECONDITION(p_nbFils > 0);
+
+	m_vFils.reserve(p_nbFils);
+	try
+	{
+		for (unsigned int i = 0; i < p_nbFils; i++)
+		{
+			m_vFils.emplace_back(&ReserveFils::travailler, this);
+		}
+	}
+	catch (...)
+	{
+		arreter();
+		throw;
+	}
+}
+
+/**
+ * \brief Destructeur : abandonne les tâches en attente et joint les fils après leur tâche en cours
+ */
+ReserveFils::~ReserveFils()
+{
+	arreter();
+}
+
+/**
+ * \brief Ajoute une tâche à la file
+ * \param[in] p_tache est la tâche à exécuter sur l'un des fils
+ * \return le futur de la tâche : get() attend sa fin et relance l'exception qu'elle a levée
+ */
+std::future<void> ReserveFils::soumettre(std::function<void()> p_tache)
+{
+	std::packaged_task<void()> tache(std::move(p_tache));
+	std::future<void> futur = tache.get_future();
+	{
+		std::lock_guard<std::mutex> verrou(m_mutex);
+		m_taches.push_back(std::move(tache));
+	}
+	m_condition.notify_one();
+	return futur;
+}
+
+/**
+ * \brief Boucle d'un fil : exécute les tâches de la file jusqu'à l'arrêt
+ */
+void ReserveFils::travailler()
+{
+	std::unique_lock<std::mutex> verrou(m_mutex);
+	while (true)
+	{
+		m_condition.wait(verrou, [this]() { return m_arret || !m_taches.empty(); });
+		if (m_arret)
+		{
+			return;
+		}
+		std::packaged_task<void()> tache(std::move(m_taches.front()));
+		m_taches.pop_front();
+
+		verrou.unlock();
+		tache();
+		verrou.lock();
+	}
+}
+
+/**
+ * \brief Demande l'arrêt des fils et les joint
+ */
+void ReserveFils::arreter()
+{
+	{
+		std::lock_guard<std::mutex> verrou(m_mutex);
+		m_arret = true;
+	}
+	m_condition.notify_all();
+	for (std::thread& fil : m_vFils)
+	{
+		fil.join();
+	}
+	m_vFils.clear();
+}
+
+/**
+ * \brief Ajoute à l'annuaire les membres d'un lot validé, dans l'ordre du lot, et consigne les erreurs
+ * 		  Les membres construits par validerLot() sont déplacés dans l'arène de l'annuaire : leurs
+ * 		  chaînes ne sont ni copiées ni réallouées pendant la fusion, qui est séquentielle.
+ * \param[in,out] p_lot est le lot validé par validerLot()
+ * \param[in] p_nbLignesLot est le nombre de lignes du lot
+ * \param[in,out] p_annuaire est l'annuaire auquel les membres sont ajoutés
+ * \param[in,out] p_rapport est le rapport de l'importation
+ * \param[in] p_nbErreursDetaillees est le nombre maximal d'erreurs détaillées dans le rapport
+ */
+void fusionnerLot(LotImportation& p_lot, unsigned int p_nbLignesLot, hockey::Annuaire& p_annuaire,
+				  hockey::RapportImportation& p_rapport, unsigned int p_nbErreursDetaillees)
+{
+	p_rapport.m_nbLignes += p_nbLignesLot;
+
+	for (unsigned int i = 0; i < p_nbLignesLot; i++)
+	{
+		if (p_lot.m_vErreurs[i] == nullptr)
+		{
+			if (p_annuaire.ajouterPersonneSiAbsente(std::move(*p_lot.m_vMembres[i])))
+			{
+				p_rapport.m_nbAjouts++;
+			}
+			else
+			{
+				p_lot.m_vErreurs[i] = "Membre déjà présent";
+			}
+			p_lot.m_vMembres[i].reset();
+		}
+		if (p_lot.m_vErreurs[i] != nullptr)
+		{
+			p_rapport.m_nbErreurs++;
+			if (p_rapport.m_vErreurs.size() < p_nbErreursDetaillees)
+			{
+				p_rapport.m_vErreurs.push_back(hockey::ErreurImportation { p_lot.m_vLignes[i], p_lot.m_vErreurs[i] });
+			}
+		}
+	}
+}
+}
+
+namespace hockey
+{
+
+/**
+ * \brief Constructeur, réservé à ImportateurAnnuaire
+ */
+ConstructeurMembres::ConstructeurMembres()
+{
+}
+
+/**
+ * \brief Construit un joueur sans revalider ses champs
+ * \param[in] p_nom est le nom du joueur, déjà validé
+ * \param[in] p_prenom est le prénom du joueur, déjà validé
+ * \param[in] p_dateNaissance est la date de naissance du joueur, dont l'âge est déjà validé
+ * \param[in] p_telephone est le numéro de téléphone du joueur, déjà validé
+ * \param[in] p_position est la position du joueur, déjà validée
+ * \return un pointeur vers le joueur construit, que l'appelant doit détruire
+ */
+Personne* ConstructeurMembres::construireJoueur(const std::string& p_nom, const std::string& p_prenom,
+												const util::Date& p_dateNaissance, const std::string& p_telephone,
+												const std::string& p_position) const
+{
+	return new Joueur(p_nom, p_prenom, p_dateNaissance, p_telephone, p_position, SansValidation());
+}
+
+/**
+ * \brief Construit un entraineur sans revalider ses champs
+ * \param[in] p_nom est le nom de l'entraineur, déjà validé
+ * \param[in] p_prenom est le prénom de l'entraineur, déjà validé
+ * \param[in] p_dateNaissance est la date de naissance de l'entraineur, dont l'âge est déjà validé
+ * \param[in] p_telephone est le numéro de téléphone de l'entraineur, déjà validé
+ * \param[in] p_numRAMQ est le numéro de RAMQ de l'entraineur, déjà validé
+ * \param[in] p_sexe est le sexe de l'entraineur, déjà validé
+ * \return un pointeur vers l'entraineur construit, que l'appelant doit détruire
+ */
+Personne* ConstructeurMembres::construireEntraineur(const std::string& p_nom, const std::string& p_prenom,
+													const util::Date& p_dateNaissance, const std::string& p_telephone,
+													const std::string& p_numRAMQ, char p_sexe) const
+{
+	return new Entraineur(p_nom, p_prenom, p_dateNaissance, p_telephone, p_numRAMQ, p_sexe, SansValidation());
+}
+
+/**
+ * \brief Constructeur avec paramètres
+ * 		  On construit un importateur avec son délimiteur et la taille de ses lots
+ * \param[in] p_delimiteur est le caractère séparant les champs, par exemple ',' ou '\t'
+ * \param[in] p_tailleLot est le nombre de lignes traitées par lot, doit être plus grand que 0
+ * \param[in] p_nbErreursDetaillees est le nombre maximal d'erreurs détaillées dans le rapport
+ */
+ImportateurAnnuaire::ImportateurAnnuaire(char p_delimiteur, unsigned int p_tailleLot, unsigned int p_nbErreursDetaillees):
+		m_delimiteur(p_delimiteur), m_tailleLot(p_tailleLot), m_nbErreursDetaillees(p_nbErreursDetaillees)
+{
+	PRECONDITION(p_tailleLot > 0);
+	PRECONDITION(p_delimiteur != '\n' && p_delimiteur != '/');
+	POSTCONDITION(reqDelimiteur() == p_delimiteur);
+	POSTCONDITION(reqTailleLot() == p_tailleLot);
+	INVARIANTS();
+}
+
+/**
+ * \brief Retourne le délimiteur de champs
+ * \return un char contenant le délimiteur
+ */
+char ImportateurAnnuaire::reqDelimiteur() const
+{
+	return m_delimiteur;
+}
+
+/**
+ * \brief Retourne la taille des lots
+ * \return un entier contenant le nombre de lignes par lot
+ */
+unsigned int ImportateurAnnuaire::reqTailleLot() const
+{
+	return m_tailleLot;
+}
+
+/**
+ * \brief Importe tous les membres décrits dans un flux vers un annuaire
+ * 		  Les lignes invalides ou décrivant un membre déjà présent sont rejetées et consignées
+ * 		  dans le rapport; les lignes valides sont ajoutées dans l'ordre du flux.
+ * \param[in] p_entree est le flux à lire jusqu'à sa fin
+ * \param[in,out] p_annuaire est l'annuaire auquel les membres sont ajoutés
+ * \return le rapport de l'importation
+ */
+RapportImportation ImportateurAnnuaire::importer(std::istream& p_entree, Annuaire& p_annuaire) const
+{
+	RapportImportation rapport = { 0, 0, 0, std::vector<ErreurImportation>() };
+	BornesAge bornes = BornesAge::reqBornesAujourdhui();
+	ConstructeurMembres constructeur;
+
+	LotImportation lot(m_tailleLot);
+	unsigned long noLigne = 0;
+	bool finFlux = false;
+
+	while (!finFlux)
+	{
+		unsigned int nbLignesLot = lireLot(p_entree, m_delimiteur, lot, noLigne);
+		finFlux = nbLignesLot < m_tailleLot;
+
+		validerLot(lot, 0, nbLignesLot, bornes, constructeur);
+		fusionnerLot(lot, nbLignesLot, p_annuaire, rapport, m_nbErreursDetaillees);
+	}
+
+	POSTCONDITION(rapport.m_nbAjouts + rapport.m_nbErreurs == rapport.m_nbLignes);
+	return rapport;
+}
+
+/**
+ * \brief Importe tous les membres décrits dans un flux vers un annuaire en validant sur plusieurs fils
+ * 		  Une réserve de p_nbFils fils est créée pour toute l'importation. Le flux est lu par
+ * 		  groupes d'un lot par fil. Pendant que les fils valident et construisent les membres
+ * 		  d'un groupe, le fil appelant lit le groupe suivant; il ajoute ensuite les membres à
+ * 		  l'annuaire dans l'ordre du flux. Le résultat est identique à celui d'importer().
+ * 		  Une exception levée pendant la lecture ou par un fil de validation est propagée à
+ * 		  l'appelant, après que tous les fils ont été joints ; les membres des groupes déjà
+ * 		  fusionnés restent alors dans l'annuaire.
+ * \param[in] p_entree est le flux à lire jusqu'à sa fin
+ * \param[in,out] p_annuaire est l'annuaire auquel les membres sont ajoutés
+ * \param[in] p_nbFils est le nombre de fils de validation, 0 pour le nombre de coeurs disponibles
+ * \return le rapport de l'importation
+ */
+RapportImportation ImportateurAnnuaire::importerParallele(std::istream& p_entree, Annuaire& p_annuaire, unsigned int p_nbFils) const
+{
+	if (p_nbFils == 0)
+	{
+		p_nbFils = std::thread::hardware_concurrency() > 0 ? std::thread::hardware_concurrency() : 1;
+	}
+
+	RapportImportation rapport = { 0, 0, 0, std::vector<ErreurImportation>() };
+	BornesAge bornes = BornesAge::reqBornesAujourdhui();
+	ConstructeurMembres constructeur;
+
+	// Deux groupes en alternance : l'un est validé pendant que l'autre est lu. Ils sont déclarés
+	// avant la réserve, qui est détruite, et ses fils joints, avant eux.
+	LotImportation groupes[2] = { LotImportation(m_tailleLot * p_nbFils), LotImportation(m_tailleLot * p_nbFils) };
+	ReserveFils reserve(p_nbFils);
+	unsigned long noLigne = 0;
+	unsigned int courant = 0;
+	unsigned int nbLignesCourant = lireLot(p_entree, m_delimiteur, groupes[courant], noLigne);
+	bool finFlux = nbLignesCourant < groupes[courant].reqTaille();
+
+	while (nbLignesCourant > 0)
+	{
+		std::vector<std::future<void>> vTaches;
+		for (unsigned int f = 0; f < p_nbFils; f++)
+		{
+			unsigned int debut = nbLignesCourant * f / p_nbFils;
+			unsigned int fin = nbLignesCourant * (f + 1) / p_nbFils;
+			LotImportation& groupe = groupes[courant];
+			vTaches.push_back(reserve.soumettre([&groupe, debut, fin, &bornes, &constructeur]()
+			{
+				validerLot(groupe, debut, fin, bornes, constructeur);
+			}));
+		}
+
+		unsigned int nbLignesSuivant = 0;
+		if (!finFlux)
+		{
+			nbLignesSuivant = lireLot(p_entree, m_delimiteur, groupes[1 - courant], noLigne);
+			finFlux = nbLignesSuivant < groupes[1 - courant].reqTaille();
+		}
+
+		for (std::future<void>& tache : vTaches)
+		{
+			tache.get();
+		}
+		fusionnerLot(groupes[courant], nbLignesCourant, p_annuaire, rapport, m_nbErreursDetaillees);
+
+		courant = 1 - courant;
+		nbLignesCourant = nbLignesSuivant;
+	}
+
+	POSTCONDITION(rapport.m_nbAjouts + rapport.m_nbErreurs == rapport.m_nbLignes);
+	return rapport;
+}
+
+/**
+ * \brief Vérification des invariants de la classe ImportateurAnnuaire
+ */
+void ImportateurAnnuaire::verifieInvariant() const
+{
+	INVARIANT(m_tailleLot > 0);
+	INVARIANT(m_delimiteur != '\n' && m_delimiteur != '/');
+}
+
+}
@@ -0,0 +1,119 @@
+/**
+ * \file ImportateurAnnuaire.h
+ * \brief Fichier contenant l'interface de la classe ImportateurAnnuaire qui permet l'ajout en lot
+ * 		  de joueurs et d'entraineurs à un Annuaire à partir d'un fichier délimité
+ * \author David Jalbert Ross
+ * \version 1.0
+ * \date 16 avril 2020
+ */
+
+#ifndef IMPORTATEURANNUAIRE_H_
+#define IMPORTATEURANNUAIRE_H_
+
+#include <istream>
+#include <string>
+#include <vector>
+#include "ContratException.h"
+#include "Annuaire.h"
+
+/**
+ * \namespace Hockey
+ * \brief Ce namespace contient le code spécifique au développement d'un outils de gestion d'annuaire
+ */
+namespace hockey
+{
+
+/**
+ * \struct ErreurImportation
+ * \brief Erreur de validation d'une ligne du fichier importé
+ *
+ * 		Attributs: m_ligne: le numéro de la ligne fautive, à partir de 1
+ * 				   m_message : la description de l'erreur
+ */
+struct ErreurImportation
+{
+	unsigned long m_ligne;
+	std::string m_message;
+};
+
+/**
+ * \struct RapportImportation
+ * \brief Bilan d'une importation
+ *
+ * 		Attributs: m_nbLignes: le nombre de lignes de données lues (sans les lignes vides et les commentaires)
+ * 				   m_nbAjouts : le nombre de membres ajoutés à l'annuaire
+ * 				   m_nbErreurs : le nombre total de lignes rejetées
+ * 				   m_vErreurs : le détail des premières lignes rejetées
+ */
+struct RapportImportation
+{
+	unsigned long m_nbLignes;
+	unsigned long m_nbAjouts;
+	unsigned long m_nbErreurs;
+	std::vector<ErreurImportation> m_vErreurs;
+};
+
+/**
+ * \class ConstructeurMembres
+ * \brief Construit des joueurs et des entraineurs à partir de champs déjà validés, sans les revalider
+ *
+ * 		Les constructeurs sans validation de Joueur et d'Entraineur sont privés : cette classe
+ * 		est le seul accès qu'en a l'importation. Seul ImportateurAnnuaire peut en créer une
+ * 		instance, après avoir validé chaque champ des lignes importées.
+ */
+class ConstructeurMembres
+{
+public:
+	Personne* construireJoueur(const std::string& p_nom, const std::string& p_prenom, const util::Date& p_dateNaissance,
+							   const std::string& p_telephone, const std::string& p_position) const;
+	Personne* construireEntraineur(const std::string& p_nom, const std::string& p_prenom,
+								   const util::Date& p_dateNaissance, const std::string& p_telephone,
+								   const std::string& p_numRAMQ, char p_sexe) const;
+
+private:
+	friend class ImportateurAnnuaire;
+	ConstructeurMembres();
+};
+
+/**
+ * \class ImportateurAnnuaire
+ * \brief Cette classe permet l'importation en lot de membres à partir d'un flux délimité (CSV, TSV, ...)
+ *
+ * 		Chaque ligne décrit un membre :
+ * 			J<d>nom<d>prenom<d>JJ/MM/AAAA<d>NNN NNN-NNNN<d>position
+ * 			E<d>nom<d>prenom<d>JJ/MM/AAAA<d>NNN NNN-NNNN<d>numéro de RAMQ<d>sexe
+ * 		où <d> est le délimiteur. Les lignes vides et celles qui commencent par # sont ignorées.
+ *
+ * 		Le flux est lu par lots de taille fixe : chaque lot est découpé, chaque champ est
+ * 		validé pour tout le lot, puis les lignes valides sont ajoutées à l'annuaire. Les lignes
+ * 		invalides sont consignées dans le rapport au lieu de lever une exception. La mémoire
+ * 		utilisée est bornée par la taille d'un lot et le nombre d'erreurs détaillées.
+ * 		importerParallele() répartit la validation et la construction des membres sur une
+ * 		réserve de fils créée pour l'importation, tout en conservant l'ordre du flux.
+ *
+ * 		Attributs: m_delimiteur: le caractère séparant les champs
+ * 				   m_tailleLot : le nombre de lignes traitées par lot
+ * 				   m_nbErreursDetaillees : le nombre maximal d'erreurs conservées dans le rapport
+ */
+class ImportateurAnnuaire
+{
+public:
+	ImportateurAnnuaire(char p_delimiteur = ',', unsigned int p_tailleLot = 4096,
+						unsigned int p_nbErreursDetaillees = 1000);
+
+	char reqDelimiteur() const;
+	unsigned int reqTailleLot() const;
+
+	RapportImportation importer(std::istream& p_entree, Annuaire& p_annuaire) const;
+	RapportImportation importerParallele(std::istream& p_entree, Annuaire& p_annuaire, unsigned int p_nbFils = 0) const;
+
+private:
+	void verifieInvariant() const;
+	char m_delimiteur;
+	unsigned int m_tailleLot;
+	unsigned int m_nbErreursDetaillees;
+};
+
+}
+
+#endif
@@ -0,0 +1,285 @@
+/**
+ * \file IndexHachage.cpp
+ * \brief Fichier d'implementation de la classe IndexHachage
+ * \author David Jalbert Ross
+ * \version 1.0
+ * \date 16 avril 2020
+ */
+
+#include "IndexHachage.h"
+#include "TriParBase.h"
+
+namespace hockey
+{
+
+namespace
+{
+const std::size_t CAPACITE_MINIMALE = 16;
+}
+
+const std::uint32_t IndexHachage::POSITION_VIDE;
+
+/**
+ * \brief Constructeur par défaut
+ * 		  On construit un index vide, aucun tableau n'est alloué avant le premier ajout
+ */
+IndexHachage::IndexHachage():
+		m_nbEntrees(0)
+{
+	INVARIANTS();
+}
+
+/**
+ * \brief Remplace le contenu de l'index par des entrées ajoutées d'un bloc
+ * 		  Les entrées sont triées par base sur leur case d'origine avant d'être rangées : les
+ * 		  cases sont alors remplies dans l'ordre du tableau, sans un défaut de cache par entrée.
+ * \param[in] p_vEntrees sont les paires (clé de hachage, position) à ranger, aucune position
+ * 			  ne doit valoir POSITION_VIDE
+ */
+void IndexHachage::construire(const std::vector<std::pair<std::size_t, std::uint32_t>>& p_vEntrees)
+{
+	std::size_t masque = capacitePour(p_vEntrees.size()) - 1;
+	std::vector<Entree> vEntrees;
+	vEntrees.reserve(p_vEntrees.size());
+	for (const std::pair<std::size_t, std::uint32_t>& entree : p_vEntrees)
+	{
+		PRECONDITION(entree.second != POSITION_VIDE);
+		vEntrees.push_back(Entree { reduire(entree.first), entree.second });
+	}
+	util::trierParBase(vEntrees, util::nbBits(masque), [masque](const Entree& p_entree) { return p_entree.m_cle & masque; });
+
+	m_vEntrees.assign(masque + 1, Entree { 0, POSITION_VIDE });
+	for (const Entree& entree : vEntrees)
+	{
+		inserer(entree);
+	}
+	m_nbEntrees = vEntrees.size();
+
+	INVARIANTS();
+}
+
+/**
+ * \brief Agrandit le tableau pour que p_nbEntrees entrées y tiennent sans le redimensionner
+ * \param[in] p_nbEntrees est le nombre d'entrées prévu
+ */
+void IndexHachage::reserver(std::size_t p_nbEntrees)
+{
+	std::size_t capacite = capacitePour(p_nbEntrees);
+	if (capacite > m_vEntrees.size())
+	{
+		redimensionner(capacite);
+	}
+
+	INVARIANTS();
+}
+
+/**
+ * \brief Ajoute une entrée à l'index, même si une entrée de même clé s'y trouve déjà
+ * \param[in] p_cle est la clé de hachage de l'entrée
+ * \param[in] p_position est la position associée, différente de POSITION_VIDE
+ */
+void IndexHachage::ajouter(std::size_t p_cle, std::uint32_t p_position)
+{
+	PRECONDITION(p_position != POSITION_VIDE);
+
+	if (2 * (m_nbEntrees + 1) > m_vEntrees.size())
+	{
+		redimensionner(m_vEntrees.empty() ? CAPACITE_MINIMALE : 2 * m_vEntrees.size());
+	}
+	inserer(Entree { reduire(p_cle), p_position });
+	m_nbEntrees++;
+
+	INVARIANTS();
+}
+
+/**
+ * \brief Retire une entrée de l'index
+ * 		  Les entrées suivantes de la même suite qui peuvent reculer sont déplacées dans la case
+ * 		  libérée, de sorte qu'aucune case vide ne coupe la suite d'une clé.
+ * \param[in] p_cle est la clé de hachage de l'entrée
+ * \param[in] p_position est la position associée
+ * \return vrai si l'entrée a été trouvée et retirée, faux sinon
+ */
+bool IndexHachage::retirer(std::size_t p_cle, std::uint32_t p_position)
+{
+	std::size_t libre = chercher(reduire(p_cle), p_position);
+	bool trouve = libre != m_vEntrees.size();
+
+	if (trouve)
+	{
+		std::size_t masque = m_vEntrees.size() - 1;
+		for (std::size_t i = (libre + 1) & masque; m_vEntrees[i].m_position != POSITION_VIDE; i = (i + 1) & masque)
+		{
+			// L'entrée i peut reculer si sa case d'origine n'est pas entre la case libre et elle
+			std::size_t origine = m_vEntrees[i].m_cle & masque;
+			if (((i - origine) & masque) >= ((i - libre) & masque))
+			{
+				m_vEntrees[libre] = m_vEntrees[i];
+				libre = i;
+			}
+		}
+		m_vEntrees[libre].m_position = POSITION_VIDE;
+		m_nbEntrees--;
+	}
+
+	INVARIANTS();
+	return trouve;
+}
+
+/**
+ * \brief Remplace la position d'une entrée, sans la déplacer
+ * \param[in] p_cle est la clé de hachage de l'entrée
+ * \param[in] p_ancienne est la position de l'entrée à modifier
+ * \param[in] p_nouvelle est sa nouvelle position, différente de POSITION_VIDE
+ * \return vrai si l'entrée a été trouvée et modifiée, faux sinon
+ */
+bool IndexHachage::remplacer(std::size_t p_cle, std::uint32_t p_ancienne, std::uint32_t p_nouvelle)
+{
+	PRECONDITION(p_nouvelle != POSITION_VIDE);
+
+	std::size_t i = chercher(reduire(p_cle), p_ancienne);
+	bool trouve = i != m_vEntrees.size();
+	if (trouve)
+	{
+		m_vEntrees[i].m_position = p_nouvelle;
+	}
+
+	INVARIANTS();
+	return trouve;
+}
+
+/**
+ * \brief Remplace la position de chaque entrée par sa nouvelle position, en un seul parcours
+ * 		  du tableau et sans recalculer de clé : les entrées ne changent pas de case.
+ * \param[in] p_vNouvellesPositions associe à chaque ancienne position sa nouvelle position;
+ * 			  chaque position de l'index doit y figurer et y être associée à une position
+ * 			  différente de POSITION_VIDE
+ */
+void IndexHachage::renumeroter(const std::vector<std::uint32_t>& p_vNouvellesPositions)
+{
+	for (Entree& entree : m_vEntrees)
+	{
+		if (entree.m_position != POSITION_VIDE)
+		{
+			PRECONDITION(entree.m_position < p_vNouvellesPositions.size());
+			PRECONDITION(p_vNouvellesPositions[entree.m_position] != POSITION_VIDE);
+			entree.m_position = p_vNouvellesPositions[entree.m_position];
+		}
+	}
+
+	INVARIANTS();
+}
+
+/**
+ * \brief retourne le nombre d'entrées de l'index
+ * \return un std::size_t qui représente le nombre d'entrées
+ */
+std::size_t IndexHachage::reqNbEntrees() const
+{
+	return m_nbEntrees;
+}
+
+/**
+ * \brief retourne le nombre de cases du tableau, 0 tant que rien n'est ajouté ou réservé
+ * \return un std::size_t qui représente la capacité de l'index
+ */
+std::size_t IndexHachage::reqCapacite() const
+{
+	return m_vEntrees.size();
+}
+
+/**
+ * \brief Retourne la plus petite capacité qui garde le tableau au plus à moitié plein
+ * \param[in] p_nbEntrees est le nombre d'entrées à ranger
+ * \return une puissance de 2, au moins CAPACITE_MINIMALE
+ */
+std::size_t IndexHachage::capacitePour(std::size_t p_nbEntrees)
+{
+	std::size_t capacite = CAPACITE_MINIMALE;
+	while (capacite < 2 * p_nbEntrees)
+	{
+		capacite *= 2;
+	}
+	return capacite;
+}
+
+/**
+ * \brief Réduit une clé à 32 bits en mélangeant tous ses bits : les clés entières, dont le
+ * 		  hachage est souvent l'identité, ne se regroupent ainsi pas dans les mêmes cases
+ * \param[in] p_cle est la clé de hachage
+ * \return la clé réduite, dont les bits de poids faible donnent la case d'origine
+ */
+std::uint32_t IndexHachage::reduire(std::size_t p_cle)
+{
+	std::uint64_t cle = static_cast<std::uint64_t>(p_cle) * 0x9E3779B97F4A7C15ull;
+	return static_cast<std::uint32_t>(cle >> 32);
+}
+
+/**
+ * \brief Cherche la case d'une entrée
+ * \param[in] p_cle est la clé réduite de l'entrée
+ * \param[in] p_position est la position associée
+ * \return la case de l'entrée, ou la taille du tableau si elle est absente
+ */
+std::size_t IndexHachage::chercher(std::uint32_t p_cle, std::uint32_t p_position) const
+{
+	std::size_t trouve = m_vEntrees.size();
+	if (!m_vEntrees.empty())
+	{
+		std::size_t masque = m_vEntrees.size() - 1;
+		for (std::size_t i = p_cle & masque; trouve == m_vEntrees.size() && m_vEntrees[i].m_position != POSITION_VIDE;
+				i = (i + 1) & masque)
+		{
+			if (m_vEntrees[i].m_cle == p_cle && m_vEntrees[i].m_position == p_position)
+			{
+				trouve = i;
+			}
+		}
+	}
+	return trouve;
+}
+
+/**
+ * \brief Range une entrée dans la première case libre à partir de sa case d'origine
+ * 		  Le tableau doit contenir au moins une case libre.
+ * \param[in] p_entree est l'entrée à ranger
+ */
+void IndexHachage::inserer(Entree p_entree)
+{
+	std::size_t masque = m_vEntrees.size() - 1;
+	std::size_t i = p_entree.m_cle & masque;
+	while (m_vEntrees[i].m_position != POSITION_VIDE)
+	{
+		i = (i + 1) & masque;
+	}
+	m_vEntrees[i] = p_entree;
+}
+
+/**
+ * \brief Range toutes les entrées dans un nouveau tableau
+ * \param[in] p_capacite est le nombre de cases du nouveau tableau, une puissance de 2
+ */
+void IndexHachage::redimensionner(std::size_t p_capacite)
+{
+	std::vector<Entree> vAnciennes(p_capacite, Entree { 0, POSITION_VIDE });
+	vAnciennes.swap(m_vEntrees);
+	for (const Entree& entree : vAnciennes)
+	{
+		if (entree.m_position != POSITION_VIDE)
+		{
+			inserer(entree);
+		}
+	}
+}
+
+/**
+ * \brief Teste l'invariant de la classe IndexHachage. L'invariant de cette classe s'assure que
+ * 		  le tableau est vide ou d'une taille puissance de 2 au moins à moitié libre
+ */
+void IndexHachage::verifieInvariant() const
+{
+	INVARIANT((m_vEntrees.size() & (m_vEntrees.size() - 1)) == 0);
+	INVARIANT(2 * m_nbEntrees <= m_vEntrees.size());
+}
+
+}
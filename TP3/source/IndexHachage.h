@@ -0,0 +1,110 @@
+/**
+ * \file IndexHachage.h
+ * \brief Fichier contenant l'interface de la classe IndexHachage, un index de hachage des positions des membres d'un annuaire
+ * \author David Jalbert Ross
+ * \version 1.0
+ * \date 16 avril 2020
+ */
+
+#ifndef INDEXHACHAGE_H_
+#define INDEXHACHAGE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "ContratException.h"
+
+/**
+ * \namespace Hockey
+ * \brief Ce namespace contient le code spécifique au développement d'un outils de gestion d'annuaire
+ */
+namespace hockey
+{
+
+/**
+ * \class IndexHachage
+ * \brief Index de hachage qui associe une clé à la position d'un membre dans un annuaire
+ *
+ * 		Les entrées (clé réduite à 32 bits, position) sont rangées dans un seul tableau de
+ * 		taille puissance de 2, à adressage ouvert et sondage linéaire : un ajout ou une
+ * 		recherche ne lit le plus souvent qu'une ligne de cache, sans allocation par entrée.
+ * 		Le tableau est au plus à moitié plein ; il double quand il le serait davantage.
+ * 		Un retrait recule les entrées suivantes de la même suite plutôt que de laisser une
+ * 		marque de suppression. Plusieurs entrées peuvent avoir la même clé : la clé ne fait que
+ * 		filtrer les positions, l'appelant compare ensuite les membres eux-mêmes.
+ * 		Comme les entrées sont des positions et non des pointeurs, une copie de l'index reste
+ * 		valide pour une copie des membres rangés dans le même ordre. construire() range
+ * 		toutes les entrées par ordre de case d'origine, ce qui parcourt le tableau dans
+ * 		l'ordre plutôt qu'au hasard.
+ *
+ * 		Attributs: m_vEntrees: le tableau des entrées, vide tant que rien n'est ajouté ou réservé
+ * 				   m_nbEntrees : le nombre d'entrées occupées
+ */
+class IndexHachage
+{
+public:
+	IndexHachage();
+
+	void construire(const std::vector<std::pair<std::size_t, std::uint32_t>>& p_vEntrees);
+	void reserver(std::size_t p_nbEntrees);
+	void ajouter(std::size_t p_cle, std::uint32_t p_position);
+	bool retirer(std::size_t p_cle, std::uint32_t p_position);
+	bool remplacer(std::size_t p_cle, std::uint32_t p_ancienne, std::uint32_t p_nouvelle);
+	void renumeroter(const std::vector<std::uint32_t>& p_vNouvellesPositions);
+
+	template<typename Fonction>
+	void parcourir(std::size_t p_cle, Fonction p_fonction) const;
+
+	std::size_t reqNbEntrees() const;
+	std::size_t reqCapacite() const;
+
+	static const std::uint32_t POSITION_VIDE = 0xFFFFFFFF;
+
+private:
+	/**
+	 * \struct Entree
+	 * \brief Entrée du tableau : la clé réduite et la position associée, POSITION_VIDE pour une case libre
+	 */
+	struct Entree
+	{
+		std::uint32_t m_cle;
+		std::uint32_t m_position;
+	};
+
+	static std::size_t capacitePour(std::size_t p_nbEntrees);
+	static std::uint32_t reduire(std::size_t p_cle);
+	std::size_t chercher(std::uint32_t p_cle, std::uint32_t p_position) const;
+	void inserer(Entree p_entree);
+	void redimensionner(std::size_t p_capacite);
+	void verifieInvariant() const;
+
+	std::vector<Entree> m_vEntrees;
+	std::size_t m_nbEntrees;
+};
+
+/**
+ * \brief Appelle une fonction pour chaque position associée à une clé, dans un ordre quelconque,
+ * 		  jusqu'à ce qu'elle retourne faux
+ * \param[in] p_cle est la clé recherchée
+ * \param[in] p_fonction est appelée avec une position (std::uint32_t) et retourne vrai pour continuer le parcours
+ */
+template<typename Fonction>
+void IndexHachage::parcourir(std::size_t p_cle, Fonction p_fonction) const
+{
+	if (!m_vEntrees.empty())
+	{
+		std::uint32_t cle = reduire(p_cle);
+		std::size_t masque = m_vEntrees.size() - 1;
+		bool continuer = true;
+
+		for (std::size_t i = cle & masque; continuer && m_vEntrees[i].m_position != POSITION_VIDE; i = (i + 1) & masque)
+		{
+			continuer = m_vEntrees[i].m_cle != cle || p_fonction(m_vEntrees[i].m_position);
+		}
+	}
+}
+
+}
+
+#endif
@@ -0,0 +1,217 @@
+/**
+ * \file IndexNaissance.cpp
+ * \brief Fichier d'implementation de la classe IndexNaissance
+ * \author David Jalbert Ross
+ * \version 1.0
+ * \date 16 avril 2020
+ */
+
+#include "IndexNaissance.h"
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include "Personne.h"
+#include "TriParBase.h"
+
+namespace hockey
+{
+
+/**
+ * \brief Constructeur avec paramètres
+ * 		  On construit un index vide, aucun bloc n'est réservé avant le premier ajout
+ * \param[in] p_tailleBloc est le nombre maximal d'entrées d'un bloc, doit être plus grand que 1
+ */
+IndexNaissance::IndexNaissance(std::size_t p_tailleBloc):
+		m_nbMembres(0), m_tailleBloc(p_tailleBloc)
+{
+	PRECONDITION(p_tailleBloc > 1);
+	INVARIANTS();
+}
+
+/**
+ * \brief Remplace le contenu de l'index par des membres triés une seule fois
+ * 		  Les entrées sont triées par base sur leur date de naissance puis réparties dans des
+ * 		  blocs pleins, en O(n), alors que n appels à ajouter() déplaceraient les entrées d'un bloc à
+ * 		  chaque ajout.
+ * \param[in] p_vMembres sont les membres à indexer, qui doivent rester valides tant qu'ils sont indexés
+ */
+void IndexNaissance::construire(const std::vector<const Personne*>& p_vMembres)
+{
+	std::vector<Entree> vEntrees;
+	vEntrees.reserve(p_vMembres.size());
+	for (const Personne* membre : p_vMembres)
+	{
+		vEntrees.push_back(Entree { membre->reqDateNaissance().reqJoursEpoque(), membre });
+	}
+	auto extremes = std::minmax_element(vEntrees.begin(), vEntrees.end(),
+										[](const Entree& p_a, const Entree& p_b) { return p_a.m_jours < p_b.m_jours; });
+	long minJours = vEntrees.empty() ? 0 : extremes.first->m_jours;
+	long maxJours = vEntrees.empty() ? 0 : extremes.second->m_jours;
+
+	// Les dates couvrent au plus quelques dizaines de milliers de jours : deux chiffres de tri par base
+	util::trierParBase(vEntrees, util::nbBits(maxJours - minJours),
+					   [minJours](const Entree& p_entree) { return static_cast<std::uint64_t>(p_entree.m_jours - minJours); });
+
+	m_vBlocs.clear();
+	m_vBlocs.reserve((vEntrees.size() + m_tailleBloc - 1) / m_tailleBloc);
+	for (std::size_t debut = 0; debut < vEntrees.size(); debut += m_tailleBloc)
+	{
+		m_vBlocs.emplace_back();
+		m_vBlocs.back().reserve(m_tailleBloc + 1);
+		m_vBlocs.back().assign(vEntrees.begin() + debut, vEntrees.begin() + std::min(debut + m_tailleBloc, vEntrees.size()));
+	}
+	m_nbMembres = vEntrees.size();
+
+	INVARIANTS();
+}
+
+/**
+ * \brief Ajoute un membre à l'index
+ * 		  Seules les entrées du bloc visé sont déplacées ; si le bloc dépasse m_tailleBloc
+ * 		  entrées, sa seconde moitié devient un nouveau bloc.
+ * \param[in] p_membre est le membre à indexer, qui doit rester valide tant qu'il est indexé
+ */
+void IndexNaissance::ajouter(const Personne* p_membre)
+{
+	Entree entree = { p_membre->reqDateNaissance().reqJoursEpoque(), p_membre };
+
+	// Le premier bloc qui se termine au plus tôt à cette date, ou le dernier bloc si l'entrée va à la fin.
+	// Le premier bloc est créé vide : il n'a pas de dernière entrée à comparer.
+	std::size_t bloc = 0;
+	if (m_vBlocs.empty())
+	{
+		m_vBlocs.emplace_back();
+		m_vBlocs.back().reserve(m_tailleBloc + 1);
+	}
+	else
+	{
+		bloc = std::min(premierBloc(entree.m_jours), m_vBlocs.size() - 1);
+	}
+	std::vector<Entree>& vEntrees = m_vBlocs[bloc];
+	auto position = std::upper_bound(vEntrees.begin(), vEntrees.end(), entree.m_jours,
+									 [](long p_jours, const Entree& p_entree) { return p_jours < p_entree.m_jours; });
+	vEntrees.insert(position, entree);
+	m_nbMembres++;
+
+	if (vEntrees.size() > m_tailleBloc)
+	{
+		std::vector<Entree> vMoitie;
+		vMoitie.reserve(m_tailleBloc + 1);
+		vMoitie.assign(vEntrees.begin() + vEntrees.size() / 2, vEntrees.end());
+		vEntrees.resize(vEntrees.size() / 2);
+		m_vBlocs.insert(m_vBlocs.begin() + bloc + 1, std::move(vMoitie));
+	}
+
+	INVARIANTS();
+}
+
+/**
+ * \brief Retire un membre de l'index
+ * 		  Le bloc qui devient vide est retiré.
+ * \param[in] p_membre est le membre à retirer, dont la date de naissance n'a pas changé depuis son ajout
+ * \return un booléen indiquant si le membre était indexé
+ */
+bool IndexNaissance::retirer(const Personne* p_membre)
+{
+	long jours = p_membre->reqDateNaissance().reqJoursEpoque();
+	bool retire = false;
+	bool continuer = true;
+	std::size_t bloc = premierBloc(jours);
+	std::size_t entree = bloc < m_vBlocs.size() ? premiereEntree(bloc, jours) : 0;
+
+	for (; continuer && bloc < m_vBlocs.size(); bloc++, entree = 0)
+	{
+		std::vector<Entree>& vEntrees = m_vBlocs[bloc];
+		for (; continuer && entree < vEntrees.size(); entree++)
+		{
+			continuer = vEntrees[entree].m_jours == jours;
+			if (continuer && vEntrees[entree].m_membre == p_membre)
+			{
+				vEntrees.erase(vEntrees.begin() + entree);
+				if (vEntrees.empty())
+				{
+					m_vBlocs.erase(m_vBlocs.begin() + bloc);
+				}
+				m_nbMembres--;
+				retire = true;
+				continuer = false;
+			}
+		}
+	}
+
+	INVARIANTS();
+	return retire;
+}
+
+/**
+ * \brief Ajoute à un vector les membres nés dans un intervalle de jours
+ * \param[in] p_premierJour est la première date de naissance retenue, en jours depuis le 1er janvier 1970
+ * \param[in] p_dernierJour est la dernière date de naissance retenue, en jours depuis le 1er janvier 1970
+ * \param[in,out] p_vTrouves est le vector auquel les membres trouvés sont ajoutés, par date de naissance croissante
+ */
+void IndexNaissance::collecter(long p_premierJour, long p_dernierJour, std::vector<const Personne*>& p_vTrouves) const
+{
+	parcourir(p_premierJour, p_dernierJour, [&p_vTrouves](const Personne* p_membre)
+	{
+		p_vTrouves.push_back(p_membre);
+		return true;
+	});
+}
+
+/**
+ * \brief Retourne le nombre de membres indexés
+ * \return le nombre d'entrées de l'index
+ */
+std::size_t IndexNaissance::reqNbMembres() const
+{
+	return m_nbMembres;
+}
+
+/**
+ * \brief Retourne le nombre de blocs de l'index
+ * \return le nombre de blocs, 0 pour un index vide
+ */
+std::size_t IndexNaissance::reqNbBlocs() const
+{
+	return m_vBlocs.size();
+}
+
+/**
+ * \brief Recherche par dichotomie le premier bloc dont la dernière entrée est née au plus tôt un jour donné
+ * \param[in] p_jours est la date de naissance recherchée, en jours depuis le 1er janvier 1970
+ * \return l'indice du bloc, ou le nombre de blocs si toutes les entrées sont nées avant p_jours
+ */
+std::size_t IndexNaissance::premierBloc(long p_jours) const
+{
+	auto bloc = std::lower_bound(m_vBlocs.begin(), m_vBlocs.end(), p_jours,
+								 [](const std::vector<Entree>& p_vEntrees, long p_jours) { return p_vEntrees.back().m_jours < p_jours; });
+	return std::distance(m_vBlocs.begin(), bloc);
+}
+
+/**
+ * \brief Recherche par dichotomie la première entrée d'un bloc née au plus tôt un jour donné
+ * \param[in] p_bloc est l'indice du bloc, plus petit que le nombre de blocs
+ * \param[in] p_jours est la date de naissance recherchée, en jours depuis le 1er janvier 1970
+ * \return l'indice de l'entrée dans le bloc, ou la taille du bloc si toutes ses entrées sont nées avant p_jours
+ */
+std::size_t IndexNaissance::premiereEntree(std::size_t p_bloc, long p_jours) const
+{
+	const std::vector<Entree>& vEntrees = m_vBlocs[p_bloc];
+	auto entree = std::lower_bound(vEntrees.begin(), vEntrees.end(), p_jours,
+								   [](const Entree& p_entree, long p_jours) { return p_entree.m_jours < p_jours; });
+	return std::distance(vEntrees.begin(), entree);
+}
+
+/**
+ * \brief Vérifie l'invariant de la classe : chaque bloc contient au moins une entrée, donc au
+ * 		  plus autant de blocs que de membres. L'ordre des entrées n'est pas vérifié, ce qui
+ * 		  coûterait un parcours de tout l'index à chaque modification.
+ */
+void IndexNaissance::verifieInvariant() const
+{
+	INVARIANT(m_tailleBloc > 1);
+	INVARIANT(m_vBlocs.size() <= m_nbMembres);
+	INVARIANT(m_vBlocs.empty() || !m_vBlocs.back().empty());
+}
+
+}
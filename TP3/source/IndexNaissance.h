@@ -0,0 +1,134 @@
+/**
+ * \file IndexNaissance.h
+ * \brief Fichier contenant l'interface de la classe IndexNaissance, un index ordonné des membres d'un annuaire par date de naissance
+ * \author David Jalbert Ross
+ * \version 1.0
+ * \date 16 avril 2020
+ */
+
+#ifndef INDEXNAISSANCE_H_
+#define INDEXNAISSANCE_H_
+
+#include <cstddef>
+#include <vector>
+#include "ContratException.h"
+
+/**
+ * \namespace Hockey
+ * \brief Ce namespace contient le code spécifique au développement d'un outils de gestion d'annuaire
+ */
+namespace hockey
+{
+
+class Personne;
+
+/**
+ * \class IndexNaissance
+ * \brief Index des membres d'un annuaire trié par date de naissance
+ *
+ * 		Les entrées (date de naissance en jours depuis le 1er janvier 1970, membre) sont rangées
+ * 		en ordre croissant dans une suite de blocs contigus d'au plus m_tailleBloc entrées. Un
+ * 		ajout ou un retrait trouve son bloc par recherche binaire et ne déplace que les entrées
+ * 		de ce bloc ; un bloc plein est coupé en deux. Une recherche par intervalle coûte donc
+ * 		O(log n + k) pour k membres trouvés, et parcourt des entrées contiguës en mémoire.
+ * 		Les membres nés le même jour sont rangés dans un ordre quelconque.
+ * 		construire() remplit l'index d'un seul tri et copier() reprend les blocs d'un autre
+ * 		index, plutôt que d'ajouter les membres un à un.
+ *
+ * 		Attributs: m_vBlocs: les blocs d'entrées, aucun n'est vide
+ * 				   m_nbMembres : le nombre d'entrées de l'index
+ * 				   m_tailleBloc : le nombre maximal d'entrées d'un bloc
+ */
+class IndexNaissance
+{
+public:
+	explicit IndexNaissance(std::size_t p_tailleBloc = 256);
+
+	void construire(const std::vector<const Personne*>& p_vMembres);
+	template<typename Correspondance>
+	void copier(const IndexNaissance& p_index, Correspondance p_correspondance);
+	void ajouter(const Personne* p_membre);
+	bool retirer(const Personne* p_membre);
+
+	template<typename Fonction>
+	void parcourir(long p_premierJour, long p_dernierJour, Fonction p_fonction) const;
+	void collecter(long p_premierJour, long p_dernierJour, std::vector<const Personne*>& p_vTrouves) const;
+
+	std::size_t reqNbMembres() const;
+	std::size_t reqNbBlocs() const;
+
+private:
+	/**
+	 * \struct Entree
+	 * \brief Entrée de l'index : une date de naissance et le membre qui y est né
+	 */
+	struct Entree
+	{
+		long m_jours;
+		const Personne* m_membre;
+	};
+
+	std::size_t premierBloc(long p_jours) const;
+	std::size_t premiereEntree(std::size_t p_bloc, long p_jours) const;
+	void verifieInvariant() const;
+
+	std::vector<std::vector<Entree>> m_vBlocs;
+	std::size_t m_nbMembres;
+	std::size_t m_tailleBloc;
+};
+
+/**
+ * \brief Remplace le contenu de l'index par celui d'un autre index, dont chaque membre est
+ * 		  remplacé par son correspondant : les blocs sont copiés tels quels, sans aucun tri.
+ * \param[in] p_index est l'index à copier, dont la taille de bloc est reprise
+ * \param[in] p_correspondance est appelée avec chaque const Personne* de p_index et retourne le
+ * 			  membre né le même jour qui le remplace
+ */
+template<typename Correspondance>
+void IndexNaissance::copier(const IndexNaissance& p_index, Correspondance p_correspondance)
+{
+	m_vBlocs.clear();
+	m_vBlocs.reserve(p_index.m_vBlocs.size());
+	m_tailleBloc = p_index.m_tailleBloc;
+	m_nbMembres = p_index.m_nbMembres;
+
+	for (const std::vector<Entree>& vEntrees : p_index.m_vBlocs)
+	{
+		m_vBlocs.emplace_back();
+		m_vBlocs.back().reserve(m_tailleBloc + 1);
+		for (const Entree& entree : vEntrees)
+		{
+			m_vBlocs.back().push_back(Entree { entree.m_jours, p_correspondance(entree.m_membre) });
+		}
+	}
+
+	INVARIANTS();
+}
+
+/**
+ * \brief Appelle une fonction pour chaque membre né dans un intervalle de jours, par date de
+ * 		  naissance croissante, jusqu'à ce qu'elle retourne faux
+ * \param[in] p_premierJour est la première date de naissance retenue, en jours depuis le 1er janvier 1970
+ * \param[in] p_dernierJour est la dernière date de naissance retenue, en jours depuis le 1er janvier 1970
+ * \param[in] p_fonction est appelée avec un const Personne* et retourne vrai pour continuer le parcours
+ */
+template<typename Fonction>
+void IndexNaissance::parcourir(long p_premierJour, long p_dernierJour, Fonction p_fonction) const
+{
+	bool continuer = true;
+	std::size_t bloc = premierBloc(p_premierJour);
+	std::size_t entree = bloc < m_vBlocs.size() ? premiereEntree(bloc, p_premierJour) : 0;
+
+	for (; continuer && bloc < m_vBlocs.size(); bloc++, entree = 0)
+	{
+		const std::vector<Entree>& vEntrees = m_vBlocs[bloc];
+		for (; continuer && entree < vEntrees.size(); entree++)
+		{
+			continuer = vEntrees[entree].m_jours <= p_dernierJour && p_fonction(vEntrees[entree].m_membre);
+		}
+	}
+}
+
+}
+
+#endif
@@ -0,0 +1,428 @@
+/**
+ * \file IndexNoms.cpp
+ * \brief Fichier d'implementation de la classe IndexNoms
+ * \author David Jalbert Ross
+ * \version 1.0
+ * \date 16 avril 2020
+ */
+
+#include "IndexNoms.h"
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include "Personne.h"
+#include "validationFormat.h"
+#include "TriParBase.h"
+
+namespace
+{
+/**
+ * Drapeaux de l'octet le moins significatif de Entree::m_debut[1]
+ */
+const std::uint64_t DRAPEAU_PRENOM = 1;
+const std::uint64_t DRAPEAU_LONGUE = 2;
+
+/**
+ * \brief Compare deux entiers non signés
+ * \return -1, 0 ou 1 selon que p_a est plus petit, égal ou plus grand que p_b
+ */
+int comparerMots(std::uint64_t p_a, std::uint64_t p_b)
+{
+	return p_a < p_b ? -1 : p_a > p_b;
+}
+
+/**
+ * \brief Retourne le masque des p_nbOctets octets les plus significatifs d'un entier de 64 bits
+ */
+std::uint64_t masqueOctets(std::size_t p_nbOctets)
+{
+	return p_nbOctets == 0 ? 0 : ~std::uint64_t(0) << (64 - 8 * p_nbOctets);
+}
+}
+
+namespace hockey
+{
+
+const std::size_t IndexNoms::LONGUEUR_DEBUT;
+
+/**
+ * \brief Constructeur avec paramètres
+ * 		  On construit un index vide, aucun bloc n'est réservé avant le premier ajout
+ * \param[in] p_tailleBloc est le nombre maximal d'entrées d'un bloc, doit être plus grand que 1
+ */
+IndexNoms::IndexNoms(std::size_t p_tailleBloc):
+		m_nbMembres(0), m_tailleBloc(p_tailleBloc)
+{
+	PRECONDITION(p_tailleBloc > 1);
+	INVARIANTS();
+}
+
+/**
+ * \brief Construit la clé normalisée d'un nom ou d'un préfixe
+ * \param[in] p_nom est le nom, le prénom ou le préfixe à normaliser
+ */
+IndexNoms::Cle::Cle(const std::string& p_nom):
+		m_texte(util::normaliserNom(p_nom)), m_debut()
+{
+	for (std::size_t i = 0; i < LONGUEUR_DEBUT; i++)
+	{
+		std::uint64_t& mot = m_debut[i / 8];
+		mot = (mot << 8) | (i < m_texte.length() ? static_cast<unsigned char>(m_texte[i]) : 0u);
+	}
+	m_debut[1] = (m_debut[1] << 8) | (m_texte.length() > LONGUEUR_DEBUT ? DRAPEAU_LONGUE : 0);
+}
+
+/**
+ * \brief Remplace le contenu de l'index par des membres triés une seule fois
+ * 		  Les entrées des noms et des prénoms sont triées ensemble puis réparties dans des blocs
+ * 		  pleins. Le tri par base sur les huit premiers octets est en O(n) ; seules les suites
+ * 		  d'entrées qui commencent pareil sont ensuite comparées en entier. n appels à ajouter()
+ * 		  déplaceraient plutôt les entrées d'un bloc à chaque entrée.
+ * \param[in] p_vMembres sont les membres à indexer, qui doivent rester valides tant qu'ils sont indexés
+ */
+void IndexNoms::construire(const std::vector<const Personne*>& p_vMembres)
+{
+	std::vector<Entree> vEntrees;
+	vEntrees.reserve(2 * p_vMembres.size());
+	for (const Personne* membre : p_vMembres)
+	{
+		vEntrees.push_back(creerEntree(membre, false));
+		vEntrees.push_back(creerEntree(membre, true));
+	}
+	// Tri par base sur les 8 premiers octets, puis par comparaison des seules suites de débuts
+	// égaux ; les longues suites de prénoms identiques sont reconnues sans être triées
+	util::trierParBase(vEntrees, 64, [](const Entree& p_entree) { return p_entree.m_debut[0]; });
+	for (auto debut = vEntrees.begin(); debut != vEntrees.end();)
+	{
+		auto fin = std::find_if(debut + 1, vEntrees.end(), [debut](const Entree& p_entree)
+		{
+			return p_entree.m_debut[0] != debut->m_debut[0];
+		});
+		bool egales = (debut->m_debut[1] & DRAPEAU_LONGUE) == 0 && std::all_of(debut + 1, fin, [debut](const Entree& p_entree)
+		{
+			return (p_entree.m_debut[1] | DRAPEAU_PRENOM) == (debut->m_debut[1] | DRAPEAU_PRENOM);
+		});
+		if (!egales)
+		{
+			std::sort(debut, fin, precede);
+		}
+		debut = fin;
+	}
+
+	std::size_t nbBlocs = (vEntrees.size() + m_tailleBloc - 1) / m_tailleBloc;
+	m_vBlocs.clear();
+	m_vBlocs.reserve(nbBlocs);
+	m_vFins.clear();
+	m_vFins.reserve(nbBlocs);
+	for (std::size_t debut = 0; debut < vEntrees.size(); debut += m_tailleBloc)
+	{
+		m_vBlocs.emplace_back();
+		m_vBlocs.back().reserve(m_tailleBloc + 1);
+		m_vBlocs.back().assign(vEntrees.begin() + debut, vEntrees.begin() + std::min(debut + m_tailleBloc, vEntrees.size()));
+		m_vFins.push_back(m_vBlocs.back().back());
+	}
+	m_nbMembres = p_vMembres.size();
+
+	INVARIANTS();
+}
+
+/**
+ * \brief Ajoute le nom et le prénom d'un membre à l'index
+ * \param[in] p_membre est le membre à indexer, qui doit rester valide tant qu'il est indexé
+ */
+void IndexNoms::ajouter(const Personne* p_membre)
+{
+	ajouterEntree(p_membre, false);
+	ajouterEntree(p_membre, true);
+	m_nbMembres++;
+
+	INVARIANTS();
+}
+
+/**
+ * \brief Retire le nom et le prénom d'un membre de l'index
+ * \param[in] p_membre est le membre à retirer, dont le nom et le prénom n'ont pas changé depuis son ajout
+ * \return un booléen indiquant si le membre était indexé
+ */
+bool IndexNoms::retirer(const Personne* p_membre)
+{
+	bool retire = retirerEntree(p_membre, false);
+	if (retire)
+	{
+		retirerEntree(p_membre, true);
+		m_nbMembres--;
+	}
+
+	INVARIANTS();
+	return retire;
+}
+
+/**
+ * \brief Retourne les premiers membres dont le nom ou le prénom commence par un préfixe
+ * \param[in] p_prefixe est le début de nom ou de prénom recherché, sans égard à la casse ni aux
+ * 			  accents, vide pour tous les membres
+ * \param[in] p_nbResultats est le nombre maximal de membres retournés, plus grand que 0
+ * \return un vector contenant au plus p_nbResultats membres, chacun une seule fois, par ordre
+ * 		   alphabétique du nom ou du prénom qui commence par p_prefixe
+ */
+std::vector<const Personne*> IndexNoms::trouver(const std::string& p_prefixe, unsigned int p_nbResultats) const
+{
+	PRECONDITION(p_nbResultats > 0);
+
+	std::vector<const Personne*> vTrouves;
+	parcourir(p_prefixe, [&vTrouves, p_nbResultats](const Personne* p_membre, bool)
+	{
+		if (std::find(vTrouves.begin(), vTrouves.end(), p_membre) == vTrouves.end())
+		{
+			vTrouves.push_back(p_membre);
+		}
+		return vTrouves.size() < p_nbResultats;
+	});
+
+	POSTCONDITION(vTrouves.size() <= p_nbResultats);
+	return vTrouves;
+}
+
+/**
+ * \brief Retourne le nombre de membres indexés
+ * \return le nombre de membres, la moitié du nombre d'entrées de l'index
+ */
+std::size_t IndexNoms::reqNbMembres() const
+{
+	return m_nbMembres;
+}
+
+/**
+ * \brief Retourne le nombre de blocs de l'index
+ * \return le nombre de blocs, 0 pour un index vide
+ */
+std::size_t IndexNoms::reqNbBlocs() const
+{
+	return m_vBlocs.size();
+}
+
+/**
+ * \brief Construit l'entrée du nom ou du prénom d'un membre
+ * \param[in] p_membre est le membre indexé
+ * \param[in] p_prenom est vrai pour l'entrée du prénom, faux pour celle du nom
+ * \return l'entrée
+ */
+IndexNoms::Entree IndexNoms::creerEntree(const Personne* p_membre, bool p_prenom)
+{
+	Cle cle(p_prenom ? p_membre->reqPrenom() : p_membre->reqNom());
+	return Entree { { cle.m_debut[0], cle.m_debut[1] | (p_prenom ? DRAPEAU_PRENOM : 0) }, p_membre };
+}
+
+/**
+ * \brief Ordonne deux entrées selon leur clé, dans l'ordre de comparer()
+ * \param[in] p_entreeA est la première entrée
+ * \param[in] p_entreeB est la seconde entrée
+ * \return vrai si la clé de p_entreeA précède celle de p_entreeB
+ */
+bool IndexNoms::precede(const Entree& p_entreeA, const Entree& p_entreeB)
+{
+	int difference = comparerMots(p_entreeA.m_debut[0], p_entreeB.m_debut[0]);
+	if (difference == 0)
+	{
+		difference = comparerMots(p_entreeA.m_debut[1] >> 8, p_entreeB.m_debut[1] >> 8);
+	}
+	if (difference == 0)
+	{
+		bool longueA = (p_entreeA.m_debut[1] & DRAPEAU_LONGUE) != 0;
+		bool longueB = (p_entreeB.m_debut[1] & DRAPEAU_LONGUE) != 0;
+		difference = longueA && longueB ? util::comparerNomNormalise(champ(p_entreeA), util::normaliserNom(champ(p_entreeB)))
+										: comparerMots(longueA, longueB);
+	}
+	return difference < 0;
+}
+
+/**
+ * \brief Indique si une entrée indexe un prénom
+ * \param[in] p_entree est l'entrée
+ * \return vrai pour une entrée de prénom, faux pour une entrée de nom
+ */
+bool IndexNoms::estPrenom(const Entree& p_entree)
+{
+	return (p_entree.m_debut[1] & DRAPEAU_PRENOM) != 0;
+}
+
+/**
+ * \brief Retourne le nom ou le prénom indexé par une entrée
+ * \param[in] p_entree est l'entrée
+ * \return le prénom du membre pour une entrée de prénom, son nom sinon
+ */
+const std::string& IndexNoms::champ(const Entree& p_entree)
+{
+	return estPrenom(p_entree) ? p_entree.m_membre->reqPrenom() : p_entree.m_membre->reqNom();
+}
+
+/**
+ * \brief Compare la clé d'une entrée à une clé recherchée
+ * 		  Le nom complet du membre n'est normalisé que si les deux clés ont plus de
+ * 		  LONGUEUR_DEBUT caractères et que leurs débuts sont égaux.
+ * \param[in] p_entree est l'entrée
+ * \param[in] p_cle est la clé recherchée
+ * \return un entier négatif, nul ou positif selon que la clé de l'entrée précède, égale ou suit p_cle
+ */
+int IndexNoms::comparer(const Entree& p_entree, const Cle& p_cle)
+{
+	int difference = comparerMots(p_entree.m_debut[0], p_cle.m_debut[0]);
+	if (difference == 0)
+	{
+		difference = comparerMots(p_entree.m_debut[1] >> 8, p_cle.m_debut[1] >> 8);
+	}
+	if (difference == 0)
+	{
+		// Débuts égaux : une clé qui ne dépasse pas le début précède celle qui le dépasse
+		bool entreeLongue = (p_entree.m_debut[1] & DRAPEAU_LONGUE) != 0;
+		bool cleLongue = (p_cle.m_debut[1] & DRAPEAU_LONGUE) != 0;
+		difference = entreeLongue && cleLongue ? util::comparerNomNormalise(champ(p_entree), p_cle.m_texte)
+											   : comparerMots(entreeLongue, cleLongue);
+	}
+	return difference;
+}
+
+/**
+ * \brief Détermine si la clé d'une entrée commence par un préfixe
+ * \param[in] p_entree est l'entrée
+ * \param[in] p_prefixe est le préfixe recherché
+ * \return un booléen indiquant si la clé de l'entrée commence par p_prefixe
+ */
+bool IndexNoms::commencePar(const Entree& p_entree, const Cle& p_prefixe)
+{
+	// Ne compare que les octets du début qui correspondent à des caractères du préfixe
+	std::size_t longueur = std::min(p_prefixe.m_texte.length(), LONGUEUR_DEBUT);
+	bool commence = ((p_entree.m_debut[0] ^ p_prefixe.m_debut[0]) & masqueOctets(std::min<std::size_t>(longueur, 8))) == 0
+			&& ((p_entree.m_debut[1] ^ p_prefixe.m_debut[1]) & masqueOctets(longueur > 8 ? longueur - 8 : 0)) == 0;
+	if (commence && p_prefixe.m_texte.length() > LONGUEUR_DEBUT)
+	{
+		commence = (p_entree.m_debut[1] & DRAPEAU_LONGUE) != 0 && util::nomCommencePar(champ(p_entree), p_prefixe.m_texte);
+	}
+	return commence;
+}
+
+/**
+ * \brief Ajoute l'entrée du nom ou du prénom d'un membre
+ * 		  Seules les entrées du bloc visé sont déplacées ; si le bloc dépasse m_tailleBloc
+ * 		  entrées, sa seconde moitié devient un nouveau bloc.
+ * \param[in] p_membre est le membre à indexer
+ * \param[in] p_prenom est vrai pour l'entrée du prénom, faux pour celle du nom
+ */
+void IndexNoms::ajouterEntree(const Personne* p_membre, bool p_prenom)
+{
+	Cle cle(p_prenom ? p_membre->reqPrenom() : p_membre->reqNom());
+	Entree entree = { { cle.m_debut[0], cle.m_debut[1] | (p_prenom ? DRAPEAU_PRENOM : 0) }, p_membre };
+
+	if (m_vBlocs.empty())
+	{
+		m_vBlocs.emplace_back();
+		m_vBlocs.back().reserve(m_tailleBloc + 1);
+		m_vFins.push_back(entree);
+	}
+
+	// Le premier bloc qui se termine au plus tôt à cette clé, ou le dernier bloc si l'entrée va à la fin
+	std::size_t bloc = std::min(premierBloc(cle), m_vBlocs.size() - 1);
+	std::vector<Entree>& vEntrees = m_vBlocs[bloc];
+	auto position = std::upper_bound(vEntrees.begin(), vEntrees.end(), cle,
+									 [](const Cle& p_cle, const Entree& p_entree) { return comparer(p_entree, p_cle) > 0; });
+	vEntrees.insert(position, entree);
+
+	if (vEntrees.size() > m_tailleBloc)
+	{
+		std::vector<Entree> vMoitie;
+		vMoitie.reserve(m_tailleBloc + 1);
+		vMoitie.assign(vEntrees.begin() + vEntrees.size() / 2, vEntrees.end());
+		vEntrees.resize(vEntrees.size() / 2);
+		m_vFins[bloc] = vEntrees.back();
+		m_vFins.insert(m_vFins.begin() + bloc + 1, vMoitie.back());
+		m_vBlocs.insert(m_vBlocs.begin() + bloc + 1, std::move(vMoitie));
+	}
+	else
+	{
+		m_vFins[bloc] = vEntrees.back();
+	}
+}
+
+/**
+ * \brief Retire l'entrée du nom ou du prénom d'un membre
+ * 		  Le bloc qui devient vide est retiré.
+ * \param[in] p_membre est le membre à retirer
+ * \param[in] p_prenom est vrai pour l'entrée du prénom, faux pour celle du nom
+ * \return un booléen indiquant si l'entrée était dans l'index
+ */
+bool IndexNoms::retirerEntree(const Personne* p_membre, bool p_prenom)
+{
+	Cle cle(p_prenom ? p_membre->reqPrenom() : p_membre->reqNom());
+	bool retire = false;
+	bool continuer = true;
+	std::size_t bloc = premierBloc(cle);
+	std::size_t entree = bloc < m_vBlocs.size() ? premiereEntree(bloc, cle) : 0;
+
+	for (; continuer && bloc < m_vBlocs.size(); bloc++, entree = 0)
+	{
+		std::vector<Entree>& vEntrees = m_vBlocs[bloc];
+		for (; continuer && entree < vEntrees.size(); entree++)
+		{
+			continuer = comparer(vEntrees[entree], cle) == 0;
+			if (continuer && vEntrees[entree].m_membre == p_membre && estPrenom(vEntrees[entree]) == p_prenom)
+			{
+				vEntrees.erase(vEntrees.begin() + entree);
+				if (vEntrees.empty())
+				{
+					m_vBlocs.erase(m_vBlocs.begin() + bloc);
+					m_vFins.erase(m_vFins.begin() + bloc);
+				}
+				else
+				{
+					m_vFins[bloc] = vEntrees.back();
+				}
+				retire = true;
+				continuer = false;
+			}
+		}
+	}
+
+	return retire;
+}
+
+/**
+ * \brief Recherche par dichotomie le premier bloc dont la dernière entrée ne précède pas une clé
+ * 		  La recherche ne lit que m_vFins, contigu, plutôt que la dernière entrée de chaque bloc.
+ * \param[in] p_cle est la clé recherchée
+ * \return l'indice du bloc, ou le nombre de blocs si toutes les entrées précèdent p_cle
+ */
+std::size_t IndexNoms::premierBloc(const Cle& p_cle) const
+{
+	auto fin = std::lower_bound(m_vFins.begin(), m_vFins.end(), p_cle,
+								[](const Entree& p_fin, const Cle& p_cle) { return comparer(p_fin, p_cle) < 0; });
+	return std::distance(m_vFins.begin(), fin);
+}
+
+/**
+ * \brief Recherche par dichotomie la première entrée d'un bloc qui ne précède pas une clé
+ * \param[in] p_bloc est l'indice du bloc, plus petit que le nombre de blocs
+ * \param[in] p_cle est la clé recherchée
+ * \return l'indice de l'entrée dans le bloc, ou la taille du bloc si toutes ses entrées précèdent p_cle
+ */
+std::size_t IndexNoms::premiereEntree(std::size_t p_bloc, const Cle& p_cle) const
+{
+	const std::vector<Entree>& vEntrees = m_vBlocs[p_bloc];
+	auto entree = std::lower_bound(vEntrees.begin(), vEntrees.end(), p_cle,
+								   [](const Entree& p_entree, const Cle& p_cle) { return comparer(p_entree, p_cle) < 0; });
+	return std::distance(vEntrees.begin(), entree);
+}
+
+/**
+ * \brief Vérifie l'invariant de la classe : chaque bloc contient au moins une entrée, donc au
+ * 		  plus deux blocs par membre. L'ordre des entrées n'est pas vérifié, ce qui coûterait
+ * 		  un parcours de tout l'index à chaque modification.
+ */
+void IndexNoms::verifieInvariant() const
+{
+	INVARIANT(m_tailleBloc > 1);
+	INVARIANT(m_vBlocs.size() <= 2 * m_nbMembres);
+	INVARIANT(m_vBlocs.empty() || !m_vBlocs.back().empty());
+	INVARIANT(m_vFins.size() == m_vBlocs.size());
+}
+
+}
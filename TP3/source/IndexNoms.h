@@ -0,0 +1,177 @@
+/**
+ * \file IndexNoms.h
+ * \brief Fichier contenant l'interface de la classe IndexNoms, un index ordonné des noms et prénoms des membres d'un annuaire
+ * \author David Jalbert Ross
+ * \version 1.0
+ * \date 16 avril 2020
+ */
+
+#ifndef INDEXNOMS_H_
+#define INDEXNOMS_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "ContratException.h"
+
+/**
+ * \namespace Hockey
+ * \brief Ce namespace contient le code spécifique au développement d'un outils de gestion d'annuaire
+ */
+namespace hockey
+{
+
+class Personne;
+
+/**
+ * \class IndexNoms
+ * \brief Index des membres d'un annuaire trié par nom et par prénom, pour la recherche par
+ * 		  début de nom (autocomplétion)
+ *
+ * 		Chaque membre a deux entrées, l'une pour son nom et l'autre pour son prénom, triées
+ * 		selon leur forme normalisée (util::normaliserNom()) : la recherche ne tient compte ni
+ * 		de la casse ni des accents. Une entrée garde les LONGUEUR_DEBUT premiers caractères
+ * 		normalisés de sa clé, rangés dans deux entiers pour être comparés sans lire le membre,
+ * 		et un pointeur vers le membre, soit 24 octets. Seules deux clés de plus de
+ * 		LONGUEUR_DEBUT caractères qui partagent ce début sont départagées en normalisant le
+ * 		nom complet du membre ; les prénoms fréquents, qui forment de longues suites de clés
+ * 		égales, sont ainsi comparés sans accès aux membres.
+ * 		Comme dans IndexNaissance, les entrées sont rangées dans une suite de blocs contigus
+ * 		d'au plus m_tailleBloc entrées : un ajout ou un retrait ne déplace que les entrées d'un
+ * 		bloc. Les entrées qui commencent par un préfixe sont contiguës ; les k premières se
+ * 		trouvent en O(log n + k). construire() remplit l'index d'un seul tri et copier() reprend
+ * 		les blocs d'un autre index, plutôt que d'ajouter les membres un à un.
+ *
+ * 		Attributs: m_vBlocs: les blocs d'entrées, aucun n'est vide
+ * 				   m_vFins : une copie de la dernière entrée de chaque bloc, pour trouver un bloc
+ * 				   			 sans lire chacun des blocs comparés
+ * 				   m_nbMembres : le nombre de membres indexés, la moitié du nombre d'entrées
+ * 				   m_tailleBloc : le nombre maximal d'entrées d'un bloc
+ */
+class IndexNoms
+{
+public:
+	explicit IndexNoms(std::size_t p_tailleBloc = 256);
+
+	void construire(const std::vector<const Personne*>& p_vMembres);
+	template<typename Correspondance>
+	void copier(const IndexNoms& p_index, Correspondance p_correspondance);
+	void ajouter(const Personne* p_membre);
+	bool retirer(const Personne* p_membre);
+
+	template<typename Fonction>
+	void parcourir(const std::string& p_prefixe, Fonction p_fonction) const;
+	std::vector<const Personne*> trouver(const std::string& p_prefixe, unsigned int p_nbResultats) const;
+
+	std::size_t reqNbMembres() const;
+	std::size_t reqNbBlocs() const;
+
+private:
+	static const std::size_t LONGUEUR_DEBUT = 15;
+
+	/**
+	 * \struct Entree
+	 * \brief Entrée de l'index et membre indexé. m_debut contient les LONGUEUR_DEBUT premiers
+	 * 		  octets de la clé normalisée, complétés par des 0, du plus significatif au moins
+	 * 		  significatif, suivis d'un octet de drapeaux : entrée de prénom, clé plus longue
+	 * 		  que LONGUEUR_DEBUT.
+	 */
+	struct Entree
+	{
+		std::uint64_t m_debut[2];
+		const Personne* m_membre;
+	};
+
+	/**
+	 * \struct Cle
+	 * \brief Clé normalisée recherchée et son début, dans le format de Entree::m_debut
+	 */
+	struct Cle
+	{
+		explicit Cle(const std::string& p_nom);
+
+		std::string m_texte;
+		std::uint64_t m_debut[2];
+	};
+
+	static Entree creerEntree(const Personne* p_membre, bool p_prenom);
+	static bool precede(const Entree& p_entreeA, const Entree& p_entreeB);
+	static bool estPrenom(const Entree& p_entree);
+	static const std::string& champ(const Entree& p_entree);
+	static int comparer(const Entree& p_entree, const Cle& p_cle);
+	static bool commencePar(const Entree& p_entree, const Cle& p_prefixe);
+
+	void ajouterEntree(const Personne* p_membre, bool p_prenom);
+	bool retirerEntree(const Personne* p_membre, bool p_prenom);
+	std::size_t premierBloc(const Cle& p_cle) const;
+	std::size_t premiereEntree(std::size_t p_bloc, const Cle& p_cle) const;
+	void verifieInvariant() const;
+
+	std::vector<std::vector<Entree>> m_vBlocs;
+	std::vector<Entree> m_vFins;
+	std::size_t m_nbMembres;
+	std::size_t m_tailleBloc;
+};
+
+/**
+ * \brief Remplace le contenu de l'index par celui d'un autre index, dont chaque membre est
+ * 		  remplacé par son correspondant : les blocs sont copiés tels quels, sans aucun tri.
+ * \param[in] p_index est l'index à copier, dont la taille de bloc est reprise
+ * \param[in] p_correspondance est appelée avec chaque const Personne* de p_index et retourne le
+ * 			  membre de même nom et de même prénom qui le remplace
+ */
+template<typename Correspondance>
+void IndexNoms::copier(const IndexNoms& p_index, Correspondance p_correspondance)
+{
+	m_vBlocs.clear();
+	m_vBlocs.reserve(p_index.m_vBlocs.size());
+	m_vFins.clear();
+	m_vFins.reserve(p_index.m_vFins.size());
+	m_tailleBloc = p_index.m_tailleBloc;
+	m_nbMembres = p_index.m_nbMembres;
+
+	for (const std::vector<Entree>& vEntrees : p_index.m_vBlocs)
+	{
+		m_vBlocs.emplace_back();
+		m_vBlocs.back().reserve(m_tailleBloc + 1);
+		for (const Entree& entree : vEntrees)
+		{
+			m_vBlocs.back().push_back(Entree { { entree.m_debut[0], entree.m_debut[1] }, p_correspondance(entree.m_membre) });
+		}
+		m_vFins.push_back(m_vBlocs.back().back());
+	}
+
+	INVARIANTS();
+}
+
+/**
+ * \brief Appelle une fonction pour chaque entrée dont la clé commence par un préfixe, par ordre
+ * 		  alphabétique de clé, jusqu'à ce qu'elle retourne faux. Un membre dont le nom et le
+ * 		  prénom commencent tous deux par le préfixe est donc rencontré deux fois.
+ * \param[in] p_prefixe est le début de nom ou de prénom recherché, sans égard à la casse ni aux accents
+ * \param[in] p_fonction est appelée avec un const Personne* et un booléen vrai pour une entrée
+ * 			  de prénom, et retourne vrai pour continuer le parcours
+ */
+template<typename Fonction>
+void IndexNoms::parcourir(const std::string& p_prefixe, Fonction p_fonction) const
+{
+	Cle prefixe(p_prefixe);
+	bool continuer = true;
+	std::size_t bloc = premierBloc(prefixe);
+	std::size_t entree = bloc < m_vBlocs.size() ? premiereEntree(bloc, prefixe) : 0;
+
+	for (; continuer && bloc < m_vBlocs.size(); bloc++, entree = 0)
+	{
+		const std::vector<Entree>& vEntrees = m_vBlocs[bloc];
+		for (; continuer && entree < vEntrees.size(); entree++)
+		{
+			continuer = commencePar(vEntrees[entree], prefixe)
+					&& p_fonction(vEntrees[entree].m_membre, estPrenom(vEntrees[entree]));
+		}
+	}
+}
+
+}
+
+#endif
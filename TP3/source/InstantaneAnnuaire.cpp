@@ -0,0 +1,260 @@
+/**
+ * \file InstantaneAnnuaire.cpp
+ * \brief Fichier d'implementation de la classe VueInstantane
+ * \author David Jalbert Ross
+ * \version 1.0
+ * \date 16 avril 2020
+ */
+
+#include "InstantaneAnnuaire.h"
+#include <cstring>
+
+using namespace std;
+
+namespace hockey
+{
+
+static const std::uint16_t MAX_JOURS_NAISSANCE = 24836;          // 31 décembre 2037
+static const std::uint64_t MAX_TELEPHONE = 9999999999ULL;
+
+/**
+ * \brief Constructeur par défaut
+ * 		  On construit une vue fermée
+ */
+VueInstantane::VueInstantane():
+		m_donnees(nullptr), m_entete(nullptr)
+{
+	INVARIANTS();
+}
+
+/**
+ * \brief Ouvre une vue sur un instantané en mémoire, après en avoir vérifié la structure
+ * \param[in] p_donnees est le début de l'instantané, doit être aligné sur 8 octets
+ * \param[in] p_taille est la taille de l'instantané en octets
+ * \return un booléen indiquant si l'instantané est bien formé ; la vue reste fermée sinon
+ */
+bool VueInstantane::ouvrir(const char* p_donnees, std::size_t p_taille)
+{
+	PRECONDITION(reinterpret_cast<std::uintptr_t>(p_donnees) % 8 == 0);
+
+	m_donnees = nullptr;
+	m_entete = nullptr;
+
+	if (p_donnees != nullptr && p_taille >= sizeof(EnteteInstantane))
+	{
+		m_donnees = p_donnees;
+		m_entete = reinterpret_cast<const EnteteInstantane*>(p_donnees);
+		if (!verifierSections(p_taille) || !verifierContenu())
+		{
+			m_donnees = nullptr;
+			m_entete = nullptr;
+		}
+	}
+
+	INVARIANTS();
+	return estOuverte();
+}
+
+/**
+ * \brief Indique si la vue est ouverte sur un instantané bien formé
+ * \return un booléen indiquant si la vue est ouverte
+ */
+bool VueInstantane::estOuverte() const
+{
+	return m_entete != nullptr;
+}
+
+/**
+ * \brief Retourne le nombre de membres de l'instantané
+ * \return le nombre de fiches de membres
+ */
+unsigned int VueInstantane::reqNbMembres() const
+{
+	PRECONDITION(estOuverte());
+	return m_entete->m_nbMembres;
+}
+
+/**
+ * \brief Retourne la fiche d'un membre
+ * \param[in] p_indice est la position du membre, doit être inférieure au nombre de membres
+ * \return une référence vers la fiche du membre, dans l'instantané
+ */
+const MembreInstantane& VueInstantane::reqMembre(unsigned int p_indice) const
+{
+	PRECONDITION(p_indice < reqNbMembres());
+	return reinterpret_cast<const MembreInstantane*>(m_donnees + m_entete->m_decalageMembres)[p_indice];
+}
+
+/**
+ * \brief Retourne une chaîne de la table des chaînes
+ * \param[in] p_id est l'identifiant de la chaîne, doit être inférieur au nombre de chaînes
+ * \return la chaîne, qui pointe dans l'instantané
+ */
+ChaineInstantane VueInstantane::reqChaine(std::uint32_t p_id) const
+{
+	PRECONDITION(p_id < reqNbChaines());
+
+	const std::uint32_t* index = reinterpret_cast<const std::uint32_t*>(m_donnees + m_entete->m_decalageIndexChaines);
+	ChaineInstantane chaine = { m_donnees + m_entete->m_decalageTexte + index[p_id], index[p_id + 1] - index[p_id] };
+	return chaine;
+}
+
+/**
+ * \brief Retourne le nombre de chaînes de la table des chaînes
+ * \return le nombre de chaînes
+ */
+unsigned int VueInstantane::reqNbChaines() const
+{
+	PRECONDITION(estOuverte());
+	return m_entete->m_nbChaines;
+}
+
+/**
+ * \brief Retourne le nom du club
+ * \return le nom du club, qui pointe dans l'instantané
+ */
+ChaineInstantane VueInstantane::reqNomClub() const
+{
+	PRECONDITION(estOuverte());
+	return reqChaine(m_entete->m_idNomClub);
+}
+
+/**
+ * \brief Retourne la permutation des membres triés par numéro de téléphone
+ * \return un tableau de reqNbMembres() indices de membres
+ */
+const std::uint32_t* VueInstantane::reqOrdreTelephone() const
+{
+	PRECONDITION(estOuverte());
+	return reinterpret_cast<const std::uint32_t*>(m_donnees + m_entete->m_decalageOrdreTelephone);
+}
+
+/**
+ * \brief Retourne la permutation des membres triés par nom, prénom puis date de naissance
+ * \return un tableau de reqNbMembres() indices de membres
+ */
+const std::uint32_t* VueInstantane::reqOrdreIdentite() const
+{
+	PRECONDITION(estOuverte());
+	return reinterpret_cast<const std::uint32_t*>(m_donnees + m_entete->m_decalageOrdreIdentite);
+}
+
+/**
+ * \brief Retourne le nombre d'entraineurs de l'instantané
+ * \return la taille de la permutation par numéro de RAMQ
+ */
+unsigned int VueInstantane::reqNbEntraineurs() const
+{
+	PRECONDITION(estOuverte());
+	return m_entete->m_nbEntraineurs;
+}
+
+/**
+ * \brief Retourne la permutation des entraineurs triés par numéro de RAMQ en majuscules,
+ * 		  puis par position entre numéros égaux
+ * \return un tableau de reqNbEntraineurs() indices de membres, qui sont tous des entraineurs
+ */
+const std::uint32_t* VueInstantane::reqOrdreRAMQ() const
+{
+	PRECONDITION(estOuverte());
+	return reinterpret_cast<const std::uint32_t*>(m_donnees + m_entete->m_decalageOrdreRAMQ);
+}
+
+/**
+ * \brief Arrondit une position au multiple de 8 supérieur, pour aligner les sections
+ * \param[in] p_decalage est la position à arrondir
+ * \return la position alignée
+ */
+std::size_t VueInstantane::aligner(std::size_t p_decalage)
+{
+	return (p_decalage + 7) & ~static_cast<std::size_t>(7);
+}
+
+/**
+ * \brief Vérifie l'en-tête et la position des sections de l'instantané
+ * \param[in] p_taille est la taille de l'instantané en octets
+ * \return un booléen indiquant si chaque section est alignée et contenue dans l'instantané
+ */
+bool VueInstantane::verifierSections(std::size_t p_taille) const
+{
+	const EnteteInstantane& e = *m_entete;
+	if (std::memcmp(e.m_signature, SIGNATURE_INSTANTANE, sizeof(SIGNATURE_INSTANTANE)) != 0
+			|| e.m_version != VERSION_INSTANTANE || e.m_marqueOctets != MARQUE_OCTETS_INSTANTANE
+			|| e.m_tailleFichier != p_taille || e.m_idNomClub >= e.m_nbChaines || e.m_nbEntraineurs > e.m_nbMembres)
+	{
+		return false;
+	}
+
+	// Les sections se suivent dans un ordre fixe ; les tailles sont calculées en 64 bits
+	// à partir de compteurs 32 bits et ne peuvent donc pas déborder.
+	const std::uint64_t debuts[] = { e.m_decalageMembres, e.m_decalageOrdreTelephone, e.m_decalageOrdreIdentite,
+			e.m_decalageOrdreRAMQ, e.m_decalageIndexChaines, e.m_decalageTexte };
+	const std::uint64_t tailles[] = { std::uint64_t(e.m_nbMembres) * sizeof(MembreInstantane),
+			std::uint64_t(e.m_nbMembres) * sizeof(std::uint32_t), std::uint64_t(e.m_nbMembres) * sizeof(std::uint32_t),
+			std::uint64_t(e.m_nbEntraineurs) * sizeof(std::uint32_t), (std::uint64_t(e.m_nbChaines) + 1) * sizeof(std::uint32_t),
+			e.m_tailleTexte };
+
+	std::uint64_t fin = sizeof(EnteteInstantane);
+	for (std::size_t i = 0; i < sizeof(debuts) / sizeof(debuts[0]); i++)
+	{
+		if (debuts[i] % 8 != 0 || debuts[i] < fin || debuts[i] > p_taille || tailles[i] > p_taille - debuts[i])
+		{
+			return false;
+		}
+		fin = debuts[i] + tailles[i];
+	}
+
+	return true;
+}
+
+/**
+ * \brief Vérifie que les chaînes, les fiches et les permutations ne désignent rien hors de l'instantané,
+ * 		  et que l'ordre par numéro de RAMQ ne désigne que des entraineurs
+ * \return un booléen indiquant si le contenu de l'instantané peut être lu sans autre vérification
+ */
+bool VueInstantane::verifierContenu() const
+{
+	const EnteteInstantane& e = *m_entete;
+
+	const std::uint32_t* index = reinterpret_cast<const std::uint32_t*>(m_donnees + e.m_decalageIndexChaines);
+	bool valide = index[0] == 0 && index[e.m_nbChaines] <= e.m_tailleTexte;
+	for (std::uint32_t i = 0; valide && i < e.m_nbChaines; i++)
+	{
+		valide = index[i] <= index[i + 1];
+	}
+
+	const MembreInstantane* membres = reinterpret_cast<const MembreInstantane*>(m_donnees + e.m_decalageMembres);
+	for (std::uint32_t i = 0; valide && i < e.m_nbMembres; i++)
+	{
+		const MembreInstantane& m = membres[i];
+		valide = m.m_idNom < e.m_nbChaines && m.m_idPrenom < e.m_nbChaines && m.m_idSpecifique < e.m_nbChaines
+				&& m.m_joursNaissance <= MAX_JOURS_NAISSANCE && m.m_telephone <= MAX_TELEPHONE
+				&& ((m.m_role == ROLE_INSTANTANE_JOUEUR && m.m_sexe == ' ')
+						|| (m.m_role == ROLE_INSTANTANE_ENTRAINEUR && (m.m_sexe == 'M' || m.m_sexe == 'F')));
+	}
+
+	const std::uint32_t* ordreTelephone = reinterpret_cast<const std::uint32_t*>(m_donnees + e.m_decalageOrdreTelephone);
+	const std::uint32_t* ordreIdentite = reinterpret_cast<const std::uint32_t*>(m_donnees + e.m_decalageOrdreIdentite);
+	for (std::uint32_t i = 0; valide && i < e.m_nbMembres; i++)
+	{
+		valide = ordreTelephone[i] < e.m_nbMembres && ordreIdentite[i] < e.m_nbMembres;
+	}
+
+	const std::uint32_t* ordreRAMQ = reinterpret_cast<const std::uint32_t*>(m_donnees + e.m_decalageOrdreRAMQ);
+	for (std::uint32_t i = 0; valide && i < e.m_nbEntraineurs; i++)
+	{
+		valide = ordreRAMQ[i] < e.m_nbMembres && membres[ordreRAMQ[i]].m_role == ROLE_INSTANTANE_ENTRAINEUR;
+	}
+
+	return valide;
+}
+
+/**
+ * \brief Vérification des invariants de la classe VueInstantane
+ */
+void VueInstantane::verifieInvariant() const
+{
+	INVARIANT((m_donnees == nullptr) == (m_entete == nullptr));
+}
+
+}
@@ -0,0 +1,166 @@
+/**
+ * \file InstantaneAnnuaire.h
+ * \brief Fichier contenant la description du format binaire des instantanés d'annuaire et
+ * 		  l'interface de la classe VueInstantane qui permet de les lire sans copie
+ * \author David Jalbert Ross
+ * \version 1.0
+ * \date 16 avril 2020
+ */
+
+#ifndef INSTANTANEANNUAIRE_H_
+#define INSTANTANEANNUAIRE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include "ContratException.h"
+
+/**
+ * \namespace Hockey
+ * \brief Ce namespace contient le code spécifique au développement d'un outils de gestion d'annuaire
+ */
+namespace hockey
+{
+
+static const char SIGNATURE_INSTANTANE[8] = { 'H', 'K', 'A', 'N', 'N', 'U', 'A', 'I' };
+static const std::uint32_t VERSION_INSTANTANE = 2;
+static const std::uint32_t MARQUE_OCTETS_INSTANTANE = 0x01020304;
+
+static const std::uint8_t ROLE_INSTANTANE_JOUEUR = 0;
+static const std::uint8_t ROLE_INSTANTANE_ENTRAINEUR = 1;
+
+/**
+ * \struct EnteteInstantane
+ * \brief En-tête d'un instantané, au début du fichier
+ *
+ * 		Un instantané contient, dans l'ordre et chaque section alignée sur 8 octets :
+ * 		l'en-tête, les fiches des membres (MembreInstantane), la permutation des membres
+ * 		triés par téléphone, la permutation des membres triés par identité (nom, prénom,
+ * 		date de naissance), la permutation des entraineurs triés par numéro de RAMQ en
+ * 		majuscules, l'index de la table des chaînes puis le texte des chaînes.
+ * 		Les entiers sont dans l'ordre des octets de la machine qui a écrit le fichier ;
+ * 		m_marqueOctets permet de refuser un fichier venant d'une machine d'ordre différent.
+ *
+ * 		Attributs: m_signature: SIGNATURE_INSTANTANE
+ * 				   m_version : VERSION_INSTANTANE
+ * 				   m_marqueOctets : MARQUE_OCTETS_INSTANTANE
+ * 				   m_nbMembres : le nombre de fiches de membres
+ * 				   m_nbChaines : le nombre de chaînes de la table des chaînes
+ * 				   m_idNomClub : l'identifiant du nom du club dans la table des chaînes
+ * 				   m_nbEntraineurs : le nombre d'entraineurs, la taille de l'ordre par numéro de RAMQ
+ * 				   m_decalage... : la position de chaque section depuis le début du fichier
+ * 				   m_tailleTexte : le nombre d'octets du texte des chaînes
+ * 				   m_tailleFichier : la taille totale du fichier
+ */
+struct EnteteInstantane
+{
+	char m_signature[8];
+	std::uint32_t m_version;
+	std::uint32_t m_marqueOctets;
+	std::uint32_t m_nbMembres;
+	std::uint32_t m_nbChaines;
+	std::uint32_t m_idNomClub;
+	std::uint32_t m_nbEntraineurs;
+	std::uint64_t m_decalageMembres;
+	std::uint64_t m_decalageOrdreTelephone;
+	std::uint64_t m_decalageOrdreIdentite;
+	std::uint64_t m_decalageOrdreRAMQ;
+	std::uint64_t m_decalageIndexChaines;
+	std::uint64_t m_decalageTexte;
+	std::uint64_t m_tailleTexte;
+	std::uint64_t m_tailleFichier;
+};
+
+/**
+ * \struct MembreInstantane
+ * \brief Fiche de taille fixe d'un membre dans un instantané
+ *
+ * 		Les chaînes sont remplacées par leur identifiant dans la table des chaînes. Cette
+ * 		table est triée : comparer deux identifiants revient à comparer les chaînes.
+ *
+ * 		Attributs: m_telephone: les 10 chiffres du téléphone (AnnuaireColonnes::encoderTelephone())
+ * 				   m_idNom, m_idPrenom : le nom et le prénom
+ * 				   m_idSpecifique : la position d'un joueur ou le numéro de RAMQ d'un entraineur
+ * 				   m_joursNaissance : la date de naissance, en jours depuis le 1er janvier 1970
+ * 				   m_role : ROLE_INSTANTANE_JOUEUR ou ROLE_INSTANTANE_ENTRAINEUR
+ * 				   m_sexe : le sexe d'un entraineur ('M' ou 'F'), ' ' pour un joueur
+ */
+struct MembreInstantane
+{
+	std::uint64_t m_telephone;
+	std::uint32_t m_idNom;
+	std::uint32_t m_idPrenom;
+	std::uint32_t m_idSpecifique;
+	std::uint16_t m_joursNaissance;
+	std::uint8_t m_role;
+	char m_sexe;
+};
+
+static_assert(sizeof(EnteteInstantane) == 96 && std::is_standard_layout<EnteteInstantane>::value,
+		"l'en-tête d'un instantané a une disposition fixe");
+static_assert(sizeof(MembreInstantane) == 24 && std::is_standard_layout<MembreInstantane>::value,
+		"une fiche de membre a une disposition fixe");
+
+/**
+ * \struct ChaineInstantane
+ * \brief Chaîne de la table des chaînes, lue directement dans l'instantané (sans caractère nul final)
+ */
+struct ChaineInstantane
+{
+	const char* m_texte;
+	std::size_t m_longueur;
+
+	std::string reqTexte() const
+	{
+		return std::string(m_texte, m_longueur);
+	}
+};
+
+/**
+ * \class VueInstantane
+ * \brief Cette classe donne accès aux sections d'un instantané déjà en mémoire, sans copie
+ *
+ * 		ouvrir() vérifie la structure du fichier : signature, version, ordre des octets,
+ * 		sections à l'intérieur du fichier, identifiants de chaînes, rôles, dates et
+ * 		permutations dans les bornes, ordre par numéro de RAMQ qui ne désigne que des
+ * 		entraineurs. Une fois la vue ouverte, les accesseurs peuvent donc
+ * 		être utilisés sans autre vérification. Les règles d'affaires (format des noms, âge,
+ * 		numéro de RAMQ) ne sont pas revalidées : l'instantané est produit par
+ * 		Annuaire::sauvegarder() à partir de membres déjà validés.
+ *
+ * 		Attributs: m_donnees: le début de l'instantané, nullptr si la vue est fermée
+ * 				   m_entete : l'en-tête de l'instantané
+ */
+class VueInstantane
+{
+public:
+	VueInstantane();
+
+	bool ouvrir(const char* p_donnees, std::size_t p_taille);
+	bool estOuverte() const;
+
+	unsigned int reqNbMembres() const;
+	const MembreInstantane& reqMembre(unsigned int p_indice) const;
+	ChaineInstantane reqChaine(std::uint32_t p_id) const;
+	unsigned int reqNbChaines() const;
+	ChaineInstantane reqNomClub() const;
+	const std::uint32_t* reqOrdreTelephone() const;
+	const std::uint32_t* reqOrdreIdentite() const;
+	unsigned int reqNbEntraineurs() const;
+	const std::uint32_t* reqOrdreRAMQ() const;
+
+	static std::size_t aligner(std::size_t p_decalage);
+
+private:
+	bool verifierSections(std::size_t p_taille) const;
+	bool verifierContenu() const;
+	void verifieInvariant() const;
+
+	const char* m_donnees;
+	const EnteteInstantane* m_entete;
+};
+
+}
+
+#endif
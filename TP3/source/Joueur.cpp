@@ -8,7 +8,10 @@
 
 #include "Joueur.h"
 #include <sstream>
+#include <utility>
+#include <new>
 #include "validationFormat.h"
+#include "BornesAge.h"
 
 
 using namespace std;
@@ -25,48 +28,90 @@ namespace hockey
  * \param[in] p_telephone est un string qui contient le numéro de téléphone du joueur, doit être un numéro valide
  * \param[in] p_position est un string qui contient la position du joueur, doi être une position valide
  */
-Joueur::Joueur(const std::string& p_nom, const std::string& p_prenom, const util::Date& p_dateNaissance,
-			   const std::string& p_telephone, const std::string& p_position):
-			   Personne::Personne(p_nom, p_prenom, p_dateNaissance, p_telephone), m_position(p_position)
+Joueur::Joueur(std::string p_nom, std::string p_prenom, const util::Date& p_dateNaissance,
+			   std::string p_telephone, std::string p_position):
+			   Personne::Personne(std::move(p_nom), std::move(p_prenom), p_dateNaissance, std::move(p_telephone)),
+			   m_position(std::move(p_position))
 {
 	PRECONDITION(verifiePosition(m_position));
-	util::Date dateAujourdhui;
-	util::Date dateNaissanceMinimale(dateAujourdhui.reqJour(), dateAujourdhui.reqMois(), (dateAujourdhui.reqAnnee() - AGE_MINIMAL_JOUEUR));
-	PRECONDITION(reqDateNaissance() <  dateNaissanceMinimale)
-	util::Date dateNaissanceMaximale(dateAujourdhui.reqJour(), dateAujourdhui.reqMois(), (dateAujourdhui.reqAnnee() - AGE_MAXIMAL_JOUEUR - 1));
-	PRECONDITION(dateNaissanceMaximale < reqDateNaissance())
+	PRECONDITION(validerAge(reqDateNaissance()));
 	POSTCONDITION(reqPosition() == m_position)
 	INVARIANTS();
 }
 
+/**
+ * \brief Constructeur sans validation, pour des données déjà validées : chargement d'un
+ * 		  instantané par Annuaire, importation en lot par ConstructeurMembres
+ * \param[in] p_nom est un string qui contient le nom du joueur
+ * \param[in] p_prenom est un string qui contient le prénom du joueur
+ * \param[in] p_dateNaissance est un objet Date qui contient la date de naissance du joueur
+ * \param[in] p_telephone est un string qui contient le numéro de téléphone du joueur
+ * \param[in] p_position est un string qui contient la position du joueur
+ */
+Joueur::Joueur(std::string p_nom, std::string p_prenom, const util::Date& p_dateNaissance,
+			   std::string p_telephone, std::string p_position, SansValidation p_sansValidation):
+			   Personne::Personne(std::move(p_nom), std::move(p_prenom), p_dateNaissance, std::move(p_telephone), p_sansValidation),
+			   m_position(std::move(p_position))
+{
+}
+
+/**
+ * \brief Fabrique qui valide les données avant de construire le joueur, sans lancer d'exception
+ * 		  Les données sont vérifiées dans l'ordre des préconditions du constructeur : nom, prénom,
+ * 		  téléphone, position puis âge.
+ * \param[in] p_nom est un string qui contient le nom du joueur
+ * \param[in] p_prenom est un string qui contient le prénom du joueur
+ * \param[in] p_dateNaissance est un objet Date qui contient la date de naissance du joueur
+ * \param[in] p_telephone est un string qui contient le numéro de téléphone du joueur
+ * \param[in] p_position est un string qui contient la position du joueur
+ * \return le joueur construit, ou le code de la première donnée invalide
+ */
+Resultat<Joueur> Joueur::creer(std::string p_nom, std::string p_prenom, const util::Date& p_dateNaissance,
+							   std::string p_telephone, std::string p_position)
+{
+	CodeErreur erreur = validerPersonne(p_nom, p_prenom, p_telephone);
+	if (erreur == CodeErreur::Aucune && !validerPosition(p_position))
+	{
+		erreur = CodeErreur::PositionInvalide;
+	}
+	if (erreur == CodeErreur::Aucune && !validerAge(p_dateNaissance))
+	{
+		erreur = CodeErreur::AgeInvalide;
+	}
+
+	if (erreur != CodeErreur::Aucune)
+	{
+		return Resultat<Joueur>(erreur);
+	}
+	return Resultat<Joueur>(Joueur(std::move(p_nom), std::move(p_prenom), p_dateNaissance, std::move(p_telephone),
+								   std::move(p_position), SansValidation()));
+}
+
 /**
  * \brief Retourne la position du joueur
  * \return un string contenant la position du joueur
  */
-const std::string Joueur::reqPosition() const
+const std::string& Joueur::reqPosition() const
 {
 	return m_position;
 }
 
 /**
- * \brief Retourne les informations du joueur en format formaté
+ * \brief Ajoute les informations du joueur en format formaté à la fin d'un tampon de formatage
  * 		  Selon le format :
  * 		  Nom               : Louis
  *		  Prenom            : Jean
  *		  Date de naissance : Samedi le 12 mai 1979
  *		  Telephone         : 418 656-2131
  *		  Position          : centre
- * \return un string contenant les informations formatés
+ * \param[in,out] p_tampon est le tampon dans lequel les informations sont écrites
  */
-std::string Joueur::reqPersonneFormate() const
+void Joueur::formaterPersonne(util::TamponFormatage& p_tampon) const
 {
-	ostringstream oss;
-
-	oss << Personne::reqPersonneFormate();
-	oss << "Position          : " << m_position << endl;
-	oss << "---------------------" << endl;
-
-	return oss.str();
+	Personne::formaterPersonne(p_tampon);
+	p_tampon.ajouter("Position          : ", 20);
+	p_tampon.ajouter(m_position);
+	p_tampon.ajouter("\n---------------------\n", 23);
 }
 
 /**
@@ -78,12 +123,48 @@ Personne* Joueur::clone() const
 	return new Joueur(*this);
 }
 
+/**
+ * \brief Retourne une copie de l'objet Joueur construite dans une arène
+ * 		  La copie doit être détruite par un appel explicite au destructeur, sa mémoire
+ * 		  est rendue lors de la libération de l'arène
+ * \param[in] p_arena est l'arène dans laquelle la copie est construite
+ * \return un pointeur vers la copie du joueur
+ */
+Personne* Joueur::clone(ArenaMembres& p_arena) const &
+{
+	return new (p_arena.allouer(sizeof(Joueur), alignof(Joueur))) Joueur(*this);
+}
+
+/**
+ * \brief Déplace le joueur dans une arène, sans copier ses chaînes
+ * 		  Le joueur d'origine ne peut plus qu'être détruit ou réassigné. Le membre déplacé doit
+ * 		  être détruit par un appel explicite au destructeur, sa mémoire est rendue lors de la
+ * 		  libération de l'arène
+ * \param[in] p_arena est l'arène dans laquelle le joueur est déplacé
+ * \return un pointeur vers le joueur déplacé
+ */
+Personne* Joueur::clone(ArenaMembres& p_arena) &&
+{
+	return new (p_arena.allouer(sizeof(Joueur), alignof(Joueur))) Joueur(std::move(*this));
+}
+
 /**
  * \brief Verifie si la string est une position valide
  * \param[in] p_position est une string contenant un position a valider
  * \return un bool indiquant si la position est valide ou non
  */
 bool Joueur::verifiePosition(const std::string& p_position) const
+{
+	return validerPosition(p_position);
+}
+
+/**
+ * \brief Détermine si une position est valide (ailier, centre, défenseur ou gardien)
+ * 		  sans construire de Joueur, pour valider des données avant la construction
+ * \param[in] p_position est une string contenant un position a valider
+ * \return un bool indiquant si la position est valide ou non
+ */
+bool Joueur::validerPosition(const std::string& p_position)
 {
 	bool valide = true;
 	if(p_position != "ailier" && p_position != "centre" && p_position != "défenseur" && p_position != "gardien")
@@ -94,16 +175,23 @@ bool Joueur::verifiePosition(const std::string& p_position) const
 	return valide;
 }
 
+/**
+ * \brief Détermine si une date de naissance donne l'âge d'un joueur à la date du jour de util::Horloge,
+ * 		  entre AGE_MINIMAL_JOUEUR et AGE_MAXIMAL_JOUEUR ans
+ * \param[in] p_dateNaissance est la date de naissance à valider
+ * \return un bool indiquant si l'âge est valide ou non
+ */
+bool Joueur::validerAge(const util::Date& p_dateNaissance)
+{
+	return BornesAge::reqBornesAujourdhui().validerAgeJoueur(p_dateNaissance);
+}
+
 /**
  * \brief Vérification des invariants de la classe Joueur
  */
 void Joueur::verifieInvariant() const
 {
 	INVARIANT(verifiePosition(m_position));
-	util::Date dateAujourdhui;
-	util::Date dateNaissanceMinimale(dateAujourdhui.reqJour(), dateAujourdhui.reqMois(), (dateAujourdhui.reqAnnee() - AGE_MINIMAL_JOUEUR));
-	INVARIANT(reqDateNaissance() <  dateNaissanceMinimale)
-	util::Date dateNaissanceMaximale(dateAujourdhui.reqJour(), dateAujourdhui.reqMois(), (dateAujourdhui.reqAnnee() - AGE_MAXIMAL_JOUEUR - 1));
-	INVARIANT(dateNaissanceMaximale < reqDateNaissance())
+	INVARIANT(validerAge(reqDateNaissance()));
 }
 }
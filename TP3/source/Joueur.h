@@ -27,22 +27,39 @@ namespace hockey
  * \class Joueur
  * \brief Cette classe permet le stockage d'informations associées à un joueur
  *
- * 		On peut cloner le joueur à l'aide de la méthode clone()
+ * 		On peut cloner le joueur à l'aide de la méthode clone(). La fabrique creer() valide
+ * 		les données sans lancer d'exception et retourne un code d'erreur si elles sont invalides.
  *
  * 		Attributs: m_position: un string contenant la position du joueur
  */
 class Joueur: public Personne
 {
 public:
-	Joueur(const std::string& p_nom, const std::string& p_prenom, const util::Date& p_dateNaissance,
-			   const std::string& p_telephone, const std::string& p_position);
+	Joueur(std::string p_nom, std::string p_prenom, const util::Date& p_dateNaissance,
+			   std::string p_telephone, std::string p_position);
+	Joueur(const Joueur& p_joueur) = default;
+	Joueur(Joueur&& p_joueur) = default;
+	Joueur& operator=(const Joueur& p_joueur) = default;
+	Joueur& operator=(Joueur&& p_joueur) = default;
 
-	const std::string reqPosition() const;
-	virtual std::string reqPersonneFormate() const;
+	static Resultat<Joueur> creer(std::string p_nom, std::string p_prenom, const util::Date& p_dateNaissance,
+								  std::string p_telephone, std::string p_position);
+
+	const std::string& reqPosition() const;
+	static bool validerPosition(const std::string& p_position);
+	static bool validerAge(const util::Date& p_dateNaissance);
+	virtual void formaterPersonne(util::TamponFormatage& p_tampon) const;
 	virtual ~Joueur() {} ;
 	virtual Personne* clone() const;
+	virtual Personne* clone(ArenaMembres& p_arena) const &;
+	virtual Personne* clone(ArenaMembres& p_arena) &&;
 
 private:
+	friend class Annuaire;
+	friend class ConstructeurMembres;
+	Joueur(std::string p_nom, std::string p_prenom, const util::Date& p_dateNaissance,
+		   std::string p_telephone, std::string p_position, SansValidation);
+
 	bool verifiePosition(const std::string& p_position) const;
 	void verifieInvariant() const;
 	std::string m_position;
@@ -8,6 +8,7 @@
 
 #include "Personne.h"
 #include <sstream>
+#include <utility>
 #include "validationFormat.h"
 
 using namespace std;
@@ -16,26 +17,66 @@ namespace hockey
 {
 /**
  * \brief Constructeur avec paramètres
- * 		  On construit un objet Personne avec les paramètres d'entrés
+ * 		  On construit un objet Personne avec les paramètres d'entrés. Les chaînes sont reçues
+ * 		  par valeur et déplacées dans les attributs : un appelant qui n'en a plus besoin peut
+ * 		  les céder avec std::move() sans aucune copie.
  * \param[in] p_nom est un string qui contient le nom de la personne, uniquement des lettres et non vide
  * \param[in] p_prenom est un string qui contient le prénom de la personne, uniquement des lettres et non vide
  * \param[in] p_dateNaissance est un objet Date qui contient la date de naissance de la personne, doit être une date valide
  * \param[in] p_telephone est un string qui contient le numéro de téléphone de la personne, doit être un numéro valide
  */
-Personne::Personne(const std::string& p_nom, const std::string& p_prenom, const util::Date& p_dateNaissance, const std::string& p_telephone):
-m_nom(p_nom), m_prenom(p_prenom), m_dateNaissance(p_dateNaissance), m_telephone(p_telephone)
+Personne::Personne(std::string p_nom, std::string p_prenom, const util::Date& p_dateNaissance, std::string p_telephone):
+m_nom(std::move(p_nom)), m_prenom(std::move(p_prenom)), m_dateNaissance(p_dateNaissance), m_telephone(std::move(p_telephone))
 {
 	PRECONDITION(util::validerFormatNom(m_nom));
 	PRECONDITION(util::validerFormatNom(m_prenom));
 	PRECONDITION(util::validerTelephone(m_telephone));
 	PRECONDITION(util::Date::validerDate(m_dateNaissance.reqJour(), m_dateNaissance.reqMois(), m_dateNaissance.reqAnnee()));
-	POSTCONDITION(reqNom() == p_nom);
-	POSTCONDITION(reqPrenom() == p_prenom);
+	// Les chaînes ont été déplacées dans les attributs : seule la date peut encore être comparée
 	POSTCONDITION(reqDateNaissance() == p_dateNaissance);
-	POSTCONDITION(reqTelephone() == p_telephone);
 	INVARIANTS();
 }
 
+/**
+ * \brief Constructeur sans validation, pour des données déjà validées
+ * 		  (voir SansValidation) : aucune précondition n'est vérifiée.
+ * \param[in] p_nom est un string qui contient le nom de la personne
+ * \param[in] p_prenom est un string qui contient le prénom de la personne
+ * \param[in] p_dateNaissance est un objet Date qui contient la date de naissance de la personne
+ * \param[in] p_telephone est un string qui contient le numéro de téléphone de la personne
+ */
+Personne::Personne(std::string p_nom, std::string p_prenom, const util::Date& p_dateNaissance,
+				   std::string p_telephone, SansValidation):
+m_nom(std::move(p_nom)), m_prenom(std::move(p_prenom)), m_dateNaissance(p_dateNaissance), m_telephone(std::move(p_telephone))
+{
+}
+
+/**
+ * \brief Valide les données communes à toutes les personnes sans lancer d'exception,
+ * 		  dans l'ordre des préconditions du constructeur, pour les fabriques des classes dérivées
+ * \param[in] p_nom est le nom à valider
+ * \param[in] p_prenom est le prénom à valider
+ * \param[in] p_telephone est le numéro de téléphone à valider
+ * \return la première erreur trouvée, CodeErreur::Aucune si les données sont valides
+ */
+CodeErreur Personne::validerPersonne(const std::string& p_nom, const std::string& p_prenom, const std::string& p_telephone)
+{
+	CodeErreur erreur = CodeErreur::Aucune;
+	if (!util::validerFormatNom(p_nom))
+	{
+		erreur = CodeErreur::NomInvalide;
+	}
+	else if (!util::validerFormatNom(p_prenom))
+	{
+		erreur = CodeErreur::PrenomInvalide;
+	}
+	else if (!util::validerTelephone(p_telephone))
+	{
+		erreur = CodeErreur::TelephoneInvalide;
+	}
+	return erreur;
+}
+
 /**
  * \brief Retourne le nom de la personne
  * \return un string contenant le nom de la personne
@@ -95,14 +136,39 @@ void Personne::asgTelephone(const std::string& p_telephone)
  */
 std::string Personne::reqPersonneFormate() const
 {
-	ostringstream oss;
+	util::TamponFormatage tampon;
+	formaterPersonne(tampon);
+	return tampon.reqTexte();
+}
 
-	oss << "Nom               : " << m_nom << endl;
-	oss << "Prenom            : " << m_prenom << endl;
-	oss << "Date de naissance : " << m_dateNaissance.reqDateFormatee() << endl;
-	oss << "Telephone         : " << m_telephone << endl;
+/**
+ * \brief Écrit les informations de la personne, au format de reqPersonneFormate(), directement
+ * 		  dans un flux de sortie, sans chaîne intermédiaire.
+ * \param[in,out] p_os est le flux dans lequel les informations sont écrites
+ */
+void Personne::ecrirePersonneFormate(std::ostream& p_os) const
+{
+	util::TamponFormatage tampon;
+	formaterPersonne(tampon);
+	tampon.ecrire(p_os);
+}
 
-	return oss.str();
+/**
+ * \brief Ajoute les informations de la personne, au format de reqPersonneFormate(), à la fin
+ * 		  d'un tampon de formatage. Les classes dérivées y ajoutent leurs propres informations.
+ * \param[in,out] p_tampon est le tampon dans lequel les informations sont écrites
+ */
+void Personne::formaterPersonne(util::TamponFormatage& p_tampon) const
+{
+	p_tampon.ajouter("Nom               : ", 20);
+	p_tampon.ajouter(m_nom);
+	p_tampon.ajouter("\nPrenom            : ", 21);
+	p_tampon.ajouter(m_prenom);
+	p_tampon.ajouter("\nDate de naissance : ", 21);
+	m_dateNaissance.formaterDate(p_tampon);
+	p_tampon.ajouter("\nTelephone         : ", 21);
+	p_tampon.ajouter(m_telephone);
+	p_tampon.ajouter('\n');
 }
 
 /**
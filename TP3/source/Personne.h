@@ -12,6 +12,9 @@
 #include "Date.h"
 #include <vector>
 #include "ContratException.h"
+#include "Resultat.h"
+#include "ArenaMembres.h"
+#include "TamponFormatage.h"
 
 
 /**
@@ -20,6 +23,16 @@
  */
 namespace hockey
 {
+/**
+ * \struct SansValidation
+ * \brief Étiquette qui choisit les constructeurs qui ne revalident pas les données. Ils sont
+ * 		  réservés aux données déjà validées : les membres d'un instantané, validés à l'écriture,
+ * 		  et les lignes d'une importation, validées champ par champ par ImportateurAnnuaire.
+ */
+struct SansValidation
+{
+};
+
 /**
  * \class Personne
  * \brief Cette classe permet le stockage d'informations associées à une personne
@@ -35,7 +48,11 @@ namespace hockey
 class Personne
 {
 public:
-	Personne(const std::string& p_nom, const std::string& p_prenom, const util::Date& p_dateNaissance, const std::string& p_telephone);
+	Personne(std::string p_nom, std::string p_prenom, const util::Date& p_dateNaissance, std::string p_telephone);
+	Personne(const Personne& p_personne) = default;
+	Personne(Personne&& p_personne) = default;
+	Personne& operator=(const Personne& p_personne) = default;
+	Personne& operator=(Personne&& p_personne) = default;
 
 	const std::string& reqNom() const;
 	const std::string& reqPrenom() const;
@@ -46,9 +63,18 @@ public:
 
 	bool operator ==(const Personne& p_personne) const;
 
-	virtual std::string reqPersonneFormate() const;
+	std::string reqPersonneFormate() const;
+	void ecrirePersonneFormate(std::ostream& p_os) const;
+	virtual void formaterPersonne(util::TamponFormatage& p_tampon) const;
 	virtual ~Personne() {} ;
 	virtual Personne* clone() const=0;
+	virtual Personne* clone(ArenaMembres& p_arena) const & =0;
+	virtual Personne* clone(ArenaMembres& p_arena) && =0;
+
+protected:
+	Personne(std::string p_nom, std::string p_prenom, const util::Date& p_dateNaissance,
+			 std::string p_telephone, SansValidation);
+	static CodeErreur validerPersonne(const std::string& p_nom, const std::string& p_prenom, const std::string& p_telephone);
 
 private:
 	void verifieInvariant() const;
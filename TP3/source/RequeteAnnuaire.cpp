@@ -0,0 +1,373 @@
+/**
+ * \file RequeteAnnuaire.cpp
+ * \brief Fichier d'implementation de la classe RequeteAnnuaire
+ * \author David Jalbert Ross
+ * \version 1.0
+ * \date 16 avril 2020
+ */
+
+#include "RequeteAnnuaire.h"
+#include <cctype>
+#include "Joueur.h"
+#include "Entraineur.h"
+#include "TamponFormatage.h"
+#include "validationFormat.h"
+
+namespace
+{
+/**
+ * Champs projetés par une requête qui n'en précise aucun : les attributs communs à tous les membres
+ */
+const hockey::ChampMembre CHAMPS_PAR_DEFAUT[] = { hockey::ChampMembre::Nom, hockey::ChampMembre::Prenom,
+												  hockey::ChampMembre::DateNaissance, hockey::ChampMembre::Telephone };
+
+/**
+ * \brief Retourne la valeur textuelle d'un champ d'un membre
+ * 		  La position d'un entraineur et le numéro de RAMQ d'un joueur sont vides.
+ * \param[in] p_personne est le membre consulté
+ * \param[in] p_champ est un champ textuel : nom, prénom, téléphone, position ou numéro de RAMQ
+ * \return une référence constante vers la valeur du champ
+ */
+const std::string& champTexte(const hockey::Personne& p_personne, hockey::ChampMembre p_champ)
+{
+	static const std::string VIDE;
+
+	switch (p_champ)
+	{
+	case hockey::ChampMembre::Nom:
+		return p_personne.reqNom();
+	case hockey::ChampMembre::Prenom:
+		return p_personne.reqPrenom();
+	case hockey::ChampMembre::Telephone:
+		return p_personne.reqTelephone();
+	case hockey::ChampMembre::Position:
+	{
+		const hockey::Joueur* joueur = dynamic_cast<const hockey::Joueur*>(&p_personne);
+		return joueur != nullptr ? joueur->reqPosition() : VIDE;
+	}
+	case hockey::ChampMembre::NumRAMQ:
+	{
+		const hockey::Entraineur* entraineur = dynamic_cast<const hockey::Entraineur*>(&p_personne);
+		return entraineur != nullptr ? entraineur->reqNumRAMQ() : VIDE;
+	}
+	default:
+		return VIDE;
+	}
+}
+
+/**
+ * \brief Retourne le sexe d'un membre, une espace pour un joueur
+ */
+char champSexe(const hockey::Personne& p_personne)
+{
+	const hockey::Entraineur* entraineur = dynamic_cast<const hockey::Entraineur*>(&p_personne);
+	return entraineur != nullptr ? entraineur->reqSexe() : ' ';
+}
+
+/**
+ * \brief Compare un champ de deux membres
+ * \param[in] p_personneA est le premier membre comparé
+ * \param[in] p_personneB est le second membre comparé
+ * \param[in] p_champ est le champ comparé
+ * \return un entier négatif, nul ou positif selon que le champ de p_personneA précède, égale ou suit celui de p_personneB
+ */
+long comparerChamp(const hockey::Personne& p_personneA, const hockey::Personne& p_personneB, hockey::ChampMembre p_champ)
+{
+	long comparaison;
+
+	if (p_champ == hockey::ChampMembre::DateNaissance)
+	{
+		comparaison = p_personneA.reqDateNaissance().reqJoursEpoque() - p_personneB.reqDateNaissance().reqJoursEpoque();
+	}
+	else if (p_champ == hockey::ChampMembre::Sexe)
+	{
+		comparaison = static_cast<long>(champSexe(p_personneA)) - static_cast<long>(champSexe(p_personneB));
+	}
+	else
+	{
+		comparaison = champTexte(p_personneA, p_champ).compare(champTexte(p_personneB, p_champ));
+	}
+
+	return comparaison;
+}
+}
+
+namespace hockey
+{
+
+/**
+ * \brief Constructeur par défaut
+ * 		  La requête retient tous les membres, sans tri ni limite, et projette leurs attributs communs
+ */
+RequeteAnnuaire::RequeteAnnuaire():
+		m_filtreRole(false), m_role(RoleMembre::Joueur), m_filtreNaissance(false), m_naissanceDebut(1, 1, 1970),
+		m_naissanceFin(31, 12, 2037), m_trie(false), m_cleTri(ChampMembre::Nom), m_limite(std::numeric_limits<unsigned int>::max())
+{
+}
+
+/**
+ * \brief Ne retient que les membres d'un rôle
+ * \param[in] p_role est le rôle retenu
+ * \return la requête modifiée
+ */
+RequeteAnnuaire& RequeteAnnuaire::filtrerRole(RoleMembre p_role)
+{
+	m_filtreRole = true;
+	m_role = p_role;
+	return *this;
+}
+
+/**
+ * \brief Ne retient que les joueurs d'une position
+ * \param[in] p_position est la position retenue, doit être valide (voir Joueur::validerPosition())
+ * \return la requête modifiée
+ */
+RequeteAnnuaire& RequeteAnnuaire::filtrerPosition(const std::string& p_position)
+{
+	PRECONDITION(Joueur::validerPosition(p_position));
+	m_position = p_position;
+	return *this;
+}
+
+/**
+ * \brief Ne retient que les membres nés dans un intervalle de dates, bornes incluses
+ * \param[in] p_debut est la première date de naissance retenue
+ * \param[in] p_fin est la dernière date de naissance retenue, ne doit pas précéder p_debut
+ * \return la requête modifiée
+ */
+RequeteAnnuaire& RequeteAnnuaire::filtrerNaissance(const util::Date& p_debut, const util::Date& p_fin)
+{
+	PRECONDITION(!(p_fin < p_debut));
+
+	m_filtreNaissance = true;
+	m_naissanceDebut = p_debut;
+	m_naissanceFin = p_fin;
+
+	POSTCONDITION(estFiltreeParNaissance() && reqNaissanceDebut() == p_debut && reqNaissanceFin() == p_fin);
+	return *this;
+}
+
+/**
+ * \brief Ne retient que les membres dont le téléphone a un code régional donné
+ * \param[in] p_indicatif est le code régional retenu, trois chiffres
+ * \return la requête modifiée
+ */
+RequeteAnnuaire& RequeteAnnuaire::filtrerIndicatif(const std::string& p_indicatif)
+{
+	PRECONDITION(p_indicatif.length() == 3 && isdigit(static_cast<unsigned char>(p_indicatif[0]))
+				 && isdigit(static_cast<unsigned char>(p_indicatif[1])) && isdigit(static_cast<unsigned char>(p_indicatif[2])));
+	m_indicatif = p_indicatif;
+	return *this;
+}
+
+/**
+ * \brief Ne retient que les membres dont le nom commence par un préfixe, sans égard à la casse
+ * 		  ni aux accents (voir util::normaliserNom())
+ * \param[in] p_prefixe est le début du nom retenu, vide pour retirer le filtre
+ * \return la requête modifiée
+ */
+RequeteAnnuaire& RequeteAnnuaire::filtrerPrefixeNom(const std::string& p_prefixe)
+{
+	m_prefixeNom = util::normaliserNom(p_prefixe);
+	return *this;
+}
+
+/**
+ * \brief Ajoute un champ à la projection, après ceux déjà projetés
+ * \param[in] p_champ est le champ projeté
+ * \return la requête modifiée
+ */
+RequeteAnnuaire& RequeteAnnuaire::projeter(ChampMembre p_champ)
+{
+	m_vChamps.push_back(p_champ);
+
+	POSTCONDITION(reqChamps().back() == p_champ);
+	return *this;
+}
+
+/**
+ * \brief Trie les résultats en ordre croissant d'un champ
+ * \param[in] p_champ est le champ de tri
+ * \return la requête modifiée
+ */
+RequeteAnnuaire& RequeteAnnuaire::trierPar(ChampMembre p_champ)
+{
+	m_trie = true;
+	m_cleTri = p_champ;
+
+	POSTCONDITION(estTriee());
+	return *this;
+}
+
+/**
+ * \brief Limite le nombre de résultats ; avec un tri, ce sont les premiers dans l'ordre du tri
+ * \param[in] p_nbResultats est le nombre maximal de résultats, plus grand que 0
+ * \return la requête modifiée
+ */
+RequeteAnnuaire& RequeteAnnuaire::limiter(unsigned int p_nbResultats)
+{
+	PRECONDITION(p_nbResultats > 0);
+	m_limite = p_nbResultats;
+
+	POSTCONDITION(reqLimite() == p_nbResultats);
+	return *this;
+}
+
+/**
+ * \brief Indique si la requête filtre les dates de naissance
+ * \return vrai si filtrerNaissance() a été appelée
+ */
+bool RequeteAnnuaire::estFiltreeParNaissance() const
+{
+	return m_filtreNaissance;
+}
+
+/**
+ * \brief Retourne la première date de naissance retenue
+ * \return une référence constante vers la date, le 1er janvier 1970 sans filtre
+ */
+const util::Date& RequeteAnnuaire::reqNaissanceDebut() const
+{
+	return m_naissanceDebut;
+}
+
+/**
+ * \brief Retourne la dernière date de naissance retenue
+ * \return une référence constante vers la date, le 31 décembre 2037 sans filtre
+ */
+const util::Date& RequeteAnnuaire::reqNaissanceFin() const
+{
+	return m_naissanceFin;
+}
+
+/**
+ * \brief Retourne le préfixe du nom retenu
+ * \return le préfixe sous sa forme normalisée, vide si la requête ne filtre pas les noms
+ */
+const std::string& RequeteAnnuaire::reqPrefixeNom() const
+{
+	return m_prefixeNom;
+}
+
+/**
+ * \brief Retourne les champs projetés
+ * \return une référence constante vers les champs, vide si la projection par défaut est utilisée
+ */
+const std::vector<ChampMembre>& RequeteAnnuaire::reqChamps() const
+{
+	return m_vChamps;
+}
+
+/**
+ * \brief Indique si les résultats sont triés
+ * \return vrai si trierPar() a été appelée
+ */
+bool RequeteAnnuaire::estTriee() const
+{
+	return m_trie;
+}
+
+/**
+ * \brief Retourne le nombre maximal de résultats
+ * \return la limite, la plus grande valeur d'un unsigned int sans limite
+ */
+unsigned int RequeteAnnuaire::reqLimite() const
+{
+	return m_limite;
+}
+
+/**
+ * \brief Détermine si un membre satisfait tous les filtres de la requête
+ * 		  Les filtres qui ne demandent pas de connaître le type du membre sont évalués en premier.
+ * \param[in] p_personne est le membre à évaluer
+ * \return vrai si le membre est retenu
+ */
+bool RequeteAnnuaire::accepte(const Personne& p_personne) const
+{
+	long naissance = p_personne.reqDateNaissance().reqJoursEpoque();
+	bool retenu = naissance >= m_naissanceDebut.reqJoursEpoque() && naissance <= m_naissanceFin.reqJoursEpoque();
+
+	retenu = retenu && (m_indicatif.empty() || p_personne.reqTelephone().compare(0, m_indicatif.length(), m_indicatif) == 0);
+	retenu = retenu && util::nomCommencePar(p_personne.reqNom(), m_prefixeNom);
+
+	if (retenu && (m_filtreRole || !m_position.empty()))
+	{
+		const Joueur* joueur = dynamic_cast<const Joueur*>(&p_personne);
+		retenu = (!m_filtreRole || (joueur != nullptr) == (m_role == RoleMembre::Joueur))
+				 && (m_position.empty() || (joueur != nullptr && joueur->reqPosition() == m_position));
+	}
+
+	return retenu;
+}
+
+/**
+ * \brief Détermine si un membre précède un autre dans l'ordre du tri de la requête
+ * 		  À champ de tri égal, les membres sont ordonnés par nom, prénom et date de naissance,
+ * 		  qui identifient un membre dans un annuaire : l'ordre est donc total.
+ * \param[in] p_personneA est le premier membre comparé
+ * \param[in] p_personneB est le second membre comparé
+ * \return vrai si p_personneA précède p_personneB
+ */
+bool RequeteAnnuaire::precede(const Personne& p_personneA, const Personne& p_personneB) const
+{
+	long comparaison = comparerChamp(p_personneA, p_personneB, m_cleTri);
+	if (comparaison == 0)
+	{
+		comparaison = comparerChamp(p_personneA, p_personneB, ChampMembre::Nom);
+	}
+	if (comparaison == 0)
+	{
+		comparaison = comparerChamp(p_personneA, p_personneB, ChampMembre::Prenom);
+	}
+	if (comparaison == 0)
+	{
+		comparaison = comparerChamp(p_personneA, p_personneB, ChampMembre::DateNaissance);
+	}
+	return comparaison < 0;
+}
+
+/**
+ * \brief Ajoute à un tampon les champs projetés d'un membre, séparés par des tabulations et suivis
+ * 		  d'un saut de ligne. La date de naissance est écrite au format AAAA-MM-JJ ; un champ qui
+ * 		  ne s'applique pas au membre (la position d'un entraineur, par exemple) est vide.
+ * \param[in] p_personne est le membre projeté
+ * \param[in,out] p_tampon est le tampon auquel la ligne est ajoutée
+ */
+void RequeteAnnuaire::formaterProjection(const Personne& p_personne, util::TamponFormatage& p_tampon) const
+{
+	const ChampMembre* champs = m_vChamps.empty() ? CHAMPS_PAR_DEFAUT : m_vChamps.data();
+	std::size_t nbChamps = m_vChamps.empty() ? sizeof(CHAMPS_PAR_DEFAUT) / sizeof(CHAMPS_PAR_DEFAUT[0]) : m_vChamps.size();
+
+	for (std::size_t i = 0; i < nbChamps; i++)
+	{
+		if (i > 0)
+		{
+			p_tampon.ajouter('\t');
+		}
+
+		if (champs[i] == ChampMembre::DateNaissance)
+		{
+			const util::Date& naissance = p_personne.reqDateNaissance();
+			p_tampon.ajouterEntier(naissance.reqAnnee());
+			p_tampon.ajouter('-');
+			p_tampon.ajouterEntierDeuxChiffres(naissance.reqMois());
+			p_tampon.ajouter('-');
+			p_tampon.ajouterEntierDeuxChiffres(naissance.reqJour());
+		}
+		else if (champs[i] == ChampMembre::Sexe)
+		{
+			char sexe = champSexe(p_personne);
+			if (sexe != ' ')
+			{
+				p_tampon.ajouter(sexe);
+			}
+		}
+		else
+		{
+			p_tampon.ajouter(champTexte(p_personne, champs[i]));
+		}
+	}
+	p_tampon.ajouter('\n');
+}
+
+}
@@ -0,0 +1,118 @@
+/**
+ * \file RequeteAnnuaire.h
+ * \brief Fichier contenant l'interface de la classe RequeteAnnuaire, une requête de filtrage et de projection des membres d'un annuaire
+ * \author David Jalbert Ross
+ * \version 1.0
+ * \date 16 avril 2020
+ */
+
+#ifndef REQUETEANNUAIRE_H_
+#define REQUETEANNUAIRE_H_
+
+#include "Date.h"
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+#include "ContratException.h"
+#include "AnnuaireColonnes.h"
+#include "Personne.h"
+
+namespace util
+{
+class TamponFormatage;
+}
+
+/**
+ * \namespace Hockey
+ * \brief Ce namespace contient le code spécifique au développement d'un outils de gestion d'annuaire
+ */
+namespace hockey
+{
+
+/**
+ * \enum ChampMembre
+ * \brief Attribut d'un membre, à projeter ou sur lequel trier les résultats d'une requête
+ */
+enum class ChampMembre : std::uint8_t
+{
+	Nom,
+	Prenom,
+	DateNaissance,
+	Telephone,
+	Position,
+	NumRAMQ,
+	Sexe
+};
+
+/**
+ * \class RequeteAnnuaire
+ * \brief Requête sur les membres d'un annuaire : filtres, champs projetés, tri et limite
+ *
+ * 		Une requête se construit par appels chaînés, par exemple tous les gardiens nés en 2009 :
+ * 		RequeteAnnuaire().filtrerPosition("gardien").filtrerNaissance(Date(1, 1, 2009), Date(31, 12, 2009)).
+ * 		Les filtres se combinent (un membre doit tous les satisfaire) ; un filtre donné deux fois
+ * 		remplace le premier. Annuaire::executerRequete() retourne des pointeurs vers les membres
+ * 		retenus, sans copier de Personne, et Annuaire::ecrireRequete() écrit leurs champs projetés.
+ * 		Sans tri, l'ordre des résultats n'est pas spécifié ; avec un tri, les membres égaux sur
+ * 		le champ de tri sont ordonnés par nom, prénom et date de naissance. Une requête qui filtre
+ * 		le début du nom ne parcourt que les noms correspondants de l'index des noms de l'annuaire ;
+ * 		sinon, une requête qui filtre les dates de naissance ne parcourt que l'intervalle
+ * 		correspondant de l'index des dates de naissance.
+ *
+ * 		Attributs: m_filtreRole : vrai si seuls les membres de m_role sont retenus
+ * 				   m_role : le rôle retenu
+ * 				   m_position : la position retenue, vide pour toutes
+ * 				   m_filtreNaissance : vrai si filtrerNaissance() a été appelée
+ * 				   m_naissanceDebut, m_naissanceFin : l'intervalle des dates de naissance retenues, bornes incluses
+ * 				   m_indicatif : le code régional retenu, vide pour tous
+ * 				   m_prefixeNom : le début du nom retenu, normalisé (voir util::normaliserNom()), vide pour tous
+ * 				   m_vChamps : les champs projetés, dans l'ordre d'écriture
+ * 				   m_trie : vrai si les résultats sont triés sur m_cleTri
+ * 				   m_cleTri : le champ de tri
+ * 				   m_limite : le nombre maximal de résultats
+ */
+class RequeteAnnuaire
+{
+public:
+	RequeteAnnuaire();
+
+	RequeteAnnuaire& filtrerRole(RoleMembre p_role);
+	RequeteAnnuaire& filtrerPosition(const std::string& p_position);
+	RequeteAnnuaire& filtrerNaissance(const util::Date& p_debut, const util::Date& p_fin);
+	RequeteAnnuaire& filtrerIndicatif(const std::string& p_indicatif);
+	RequeteAnnuaire& filtrerPrefixeNom(const std::string& p_prefixe);
+	RequeteAnnuaire& projeter(ChampMembre p_champ);
+	RequeteAnnuaire& trierPar(ChampMembre p_champ);
+	RequeteAnnuaire& limiter(unsigned int p_nbResultats);
+
+	bool estFiltreeParNaissance() const;
+	const util::Date& reqNaissanceDebut() const;
+	const util::Date& reqNaissanceFin() const;
+	const std::string& reqPrefixeNom() const;
+	const std::vector<ChampMembre>& reqChamps() const;
+	bool estTriee() const;
+	unsigned int reqLimite() const;
+
+	bool accepte(const Personne& p_personne) const;
+	bool precede(const Personne& p_personneA, const Personne& p_personneB) const;
+	void formaterProjection(const Personne& p_personne, util::TamponFormatage& p_tampon) const;
+
+private:
+	bool m_filtreRole;
+	RoleMembre m_role;
+	std::string m_position;
+	bool m_filtreNaissance;
+	util::Date m_naissanceDebut;
+	util::Date m_naissanceFin;
+	std::string m_indicatif;
+	std::string m_prefixeNom;
+	std::vector<ChampMembre> m_vChamps;
+	bool m_trie;
+	ChampMembre m_cleTri;
+	unsigned int m_limite;
+};
+
+}
+
+#endif
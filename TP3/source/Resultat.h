@@ -0,0 +1,235 @@
+/**
+ * \file Resultat.h
+ * \brief Fichier contenant le gabarit Resultat, qui contient soit une valeur construite, soit un code d'erreur
+ * \author David Jalbert Ross
+ * \version 1.0
+ * \date 16 avril 2020
+ */
+
+#ifndef RESULTAT_H_
+#define RESULTAT_H_
+
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "ContratException.h"
+
+/**
+ * \namespace Hockey
+ * \brief Ce namespace contient le code spécifique au développement d'un outils de gestion d'annuaire
+ */
+namespace hockey
+{
+
+/**
+ * \enum CodeErreur
+ * \brief Raison pour laquelle une fabrique a refusé de construire un membre
+ */
+enum class CodeErreur : std::uint8_t
+{
+	Aucune,
+	NomInvalide,
+	PrenomInvalide,
+	TelephoneInvalide,
+	AgeInvalide,
+	PositionInvalide,
+	SexeInvalide,
+	NumRAMQInvalide
+};
+
+/**
+ * \class Resultat
+ * \brief Résultat d'une fabrique : la valeur construite, ou le code de l'erreur qui l'en a empêchée
+ *
+ * 		Les fabriques Joueur::creer() et Entraineur::creer() retournent un Resultat au lieu de
+ * 		lancer une PreconditionException, pour que le rejet d'une donnée invalide ne coûte
+ * 		qu'un branchement. La valeur est construite directement dans le résultat, sans
+ * 		allocation : elle est le membre d'une union anonyme, que le résultat construit et
+ * 		détruit lui-même selon m_erreur.
+ *
+ * 		Le déplacement de T ne doit pas lever d'exception : l'assignation par déplacement
+ * 		détruit la valeur courante avant de construire la nouvelle, et ne pourrait pas
+ * 		garder le résultat cohérent si cette construction échouait.
+ *
+ * 		Attributs: m_valeur: la valeur, construite seulement si estValide()
+ * 				   m_erreur: le code d'erreur, CodeErreur::Aucune si la valeur est construite
+ */
+template<typename T>
+class Resultat
+{
+	static_assert(std::is_nothrow_move_constructible<T>::value, "Le déplacement de T ne doit pas lever d'exception");
+
+public:
+	Resultat(T&& p_valeur);
+	Resultat(CodeErreur p_erreur);
+	Resultat(const Resultat& p_resultat);
+	Resultat(Resultat&& p_resultat) noexcept;
+	Resultat& operator=(const Resultat& p_resultat);
+	Resultat& operator=(Resultat&& p_resultat) noexcept;
+	~Resultat();
+
+	bool estValide() const;
+	CodeErreur reqErreur() const;
+	const T& reqValeur() const;
+	T& reqValeur();
+
+private:
+	void detruire();
+
+	union
+	{
+		T m_valeur;
+	};
+	CodeErreur m_erreur;
+};
+
+/**
+ * \brief Construit un résultat valide en déplaçant la valeur dans le résultat
+ * \param[in] p_valeur est la valeur construite
+ */
+template<typename T>
+Resultat<T>::Resultat(T&& p_valeur): m_erreur(CodeErreur::Aucune)
+{
+	new (&m_valeur) T(std::move(p_valeur));
+}
+
+/**
+ * \brief Construit un résultat en erreur
+ * \param[in] p_erreur est la raison de l'échec, différente de CodeErreur::Aucune
+ */
+template<typename T>
+Resultat<T>::Resultat(CodeErreur p_erreur): m_erreur(p_erreur)
+{
+	PRECONDITION(p_erreur != CodeErreur::Aucune);
+}
+
+/**
+ * \brief Constructeur copie
+ * \param[in] p_resultat est le résultat copié
+ */
+template<typename T>
+Resultat<T>::Resultat(const Resultat& p_resultat): m_erreur(p_resultat.m_erreur)
+{
+	if (p_resultat.estValide())
+	{
+		new (&m_valeur) T(p_resultat.m_valeur);
+	}
+}
+
+/**
+ * \brief Constructeur de déplacement, la valeur de p_resultat est déplacée mais reste construite
+ * \param[in] p_resultat est le résultat déplacé
+ */
+template<typename T>
+Resultat<T>::Resultat(Resultat&& p_resultat) noexcept: m_erreur(p_resultat.m_erreur)
+{
+	if (p_resultat.estValide())
+	{
+		new (&m_valeur) T(std::move(p_resultat.m_valeur));
+	}
+}
+
+/**
+ * \brief Opérateur d'assignation par copie
+ * \param[in] p_resultat est le résultat copié
+ * \return le résultat modifié
+ */
+template<typename T>
+Resultat<T>& Resultat<T>::operator=(const Resultat& p_resultat)
+{
+	if (this != &p_resultat)
+	{
+		// La copie est faite avant de détruire la valeur courante, pour la garder si la copie échoue
+		Resultat copie(p_resultat);
+		*this = std::move(copie);
+	}
+	return *this;
+}
+
+/**
+ * \brief Opérateur d'assignation par déplacement
+ * \param[in] p_resultat est le résultat déplacé
+ * \return le résultat modifié
+ */
+template<typename T>
+Resultat<T>& Resultat<T>::operator=(Resultat&& p_resultat) noexcept
+{
+	if (this != &p_resultat)
+	{
+		detruire();
+		m_erreur = p_resultat.m_erreur;
+		if (p_resultat.estValide())
+		{
+			new (&m_valeur) T(std::move(p_resultat.m_valeur));
+		}
+	}
+	return *this;
+}
+
+/**
+ * \brief Destructeur, détruit la valeur si elle a été construite
+ */
+template<typename T>
+Resultat<T>::~Resultat()
+{
+	detruire();
+}
+
+/**
+ * \brief Indique si le résultat contient une valeur
+ * \return vrai si la valeur a été construite, faux si le résultat contient une erreur
+ */
+template<typename T>
+bool Resultat<T>::estValide() const
+{
+	return m_erreur == CodeErreur::Aucune;
+}
+
+/**
+ * \brief Retourne le code d'erreur du résultat
+ * \return la raison de l'échec, CodeErreur::Aucune si le résultat est valide
+ */
+template<typename T>
+CodeErreur Resultat<T>::reqErreur() const
+{
+	return m_erreur;
+}
+
+/**
+ * \brief Retourne la valeur d'un résultat valide
+ * \return une référence constante vers la valeur
+ */
+template<typename T>
+const T& Resultat<T>::reqValeur() const
+{
+	PRECONDITION(estValide());
+	return m_valeur;
+}
+
+/**
+ * \brief Retourne la valeur d'un résultat valide, qui peut être déplacée hors du résultat
+ * \return une référence vers la valeur
+ */
+template<typename T>
+T& Resultat<T>::reqValeur()
+{
+	PRECONDITION(estValide());
+	return m_valeur;
+}
+
+/**
+ * \brief Détruit la valeur si elle a été construite
+ */
+template<typename T>
+void Resultat<T>::detruire()
+{
+	if (estValide())
+	{
+		m_valeur.~T();
+	}
+}
+
+}
+
+#endif
@@ -0,0 +1,161 @@
+/**
+ * \file SiteContrat.cpp
+ * \brief Fichier d'implementation des classes SiteContrat et ChronometreContrat
+ * \author David Jalbert Ross
+ * \version 1.0
+ * \date 16 avril 2020
+ */
+
+#include "SiteContrat.h"
+#include "ContratException.h"
+#include <ostream>
+
+std::atomic<SiteContrat*> SiteContrat::s_premierSite(nullptr);
+std::atomic<std::uint64_t> SiteContrat::s_masqueEchantillonnage(CONTRAT_PERIODE_ECHANTILLONNAGE - 1);
+
+/**
+ * \brief Constructeur d'un site, qui s'inscrit dans la liste globale des sites
+ * \param[in] p_fichier est le fichier source du contrat, une chaîne littérale
+ * \param[in] p_ligne est la ligne du contrat dans le fichier
+ * \param[in] p_expression est le texte du contrat, une chaîne littérale
+ */
+SiteContrat::SiteContrat(const char* p_fichier, unsigned int p_ligne, const char* p_expression):
+		m_fichier(p_fichier), m_ligne(p_ligne), m_expression(p_expression), m_nbPassages(0),
+		m_nbVerifications(0), m_coutNanosecondes(0), m_suivant(s_premierSite.load())
+{
+	while (!s_premierSite.compare_exchange_weak(m_suivant, this))
+	{
+	}
+}
+
+/**
+ * \brief Ajoute la durée d'une vérification au coût cumulé du site
+ * \param[in] p_nanosecondes est la durée de la vérification
+ */
+void SiteContrat::ajouterCout(std::uint64_t p_nanosecondes)
+{
+	m_coutNanosecondes.store(m_coutNanosecondes.load(std::memory_order_relaxed) + p_nanosecondes, std::memory_order_relaxed);
+}
+
+/**
+ * \brief Retourne le fichier source du contrat
+ * \return le nom du fichier
+ */
+const char* SiteContrat::reqFichier() const
+{
+	return m_fichier;
+}
+
+/**
+ * \brief Retourne la ligne du contrat dans son fichier
+ * \return le numéro de ligne
+ */
+unsigned int SiteContrat::reqLigne() const
+{
+	return m_ligne;
+}
+
+/**
+ * \brief Retourne le texte du contrat
+ * \return l'expression vérifiée
+ */
+const char* SiteContrat::reqExpression() const
+{
+	return m_expression;
+}
+
+/**
+ * \brief Retourne le nombre de fois que le site a été atteint
+ * \return le nombre de passages
+ */
+std::uint64_t SiteContrat::reqNbPassages() const
+{
+	return m_nbPassages.load(std::memory_order_relaxed);
+}
+
+/**
+ * \brief Retourne le nombre de passages qui ont été vérifiés
+ * \return le nombre de vérifications
+ */
+std::uint64_t SiteContrat::reqNbVerifications() const
+{
+	return m_nbVerifications.load(std::memory_order_relaxed);
+}
+
+/**
+ * \brief Retourne le temps cumulé des vérifications du site
+ * \return le coût en nanosecondes
+ */
+std::uint64_t SiteContrat::reqCoutNanosecondes() const
+{
+	return m_coutNanosecondes.load(std::memory_order_relaxed);
+}
+
+/**
+ * \brief Retourne le site inscrit avant celui-ci dans la liste globale
+ * \return un pointeur vers le site suivant de la liste, nullptr à la fin
+ */
+const SiteContrat* SiteContrat::reqSuivant() const
+{
+	return m_suivant;
+}
+
+/**
+ * \brief Retourne le dernier site inscrit, début de la liste globale des sites
+ * \return un pointeur vers le premier site de la liste, nullptr si aucun site n'a été atteint
+ */
+const SiteContrat* SiteContrat::reqPremierSite()
+{
+	return s_premierSite.load();
+}
+
+/**
+ * \brief Retourne la période d'échantillonnage commune à tous les sites
+ * \return le nombre de passages entre deux vérifications d'un même site
+ */
+unsigned int SiteContrat::reqPeriodeEchantillonnage()
+{
+	return s_masqueEchantillonnage.load(std::memory_order_relaxed) + 1;
+}
+
+/**
+ * \brief Change la période d'échantillonnage de tous les sites
+ * \param[in] p_periode est le nombre de passages entre deux vérifications, une puissance de 2,
+ * 		  1 pour tout vérifier
+ */
+void SiteContrat::asgPeriodeEchantillonnage(unsigned int p_periode)
+{
+	PRECONDITION(p_periode > 0 && (p_periode & (p_periode - 1)) == 0);
+	s_masqueEchantillonnage.store(p_periode - 1, std::memory_order_relaxed);
+}
+
+/**
+ * \brief Écrit une ligne par site atteint : emplacement, passages, vérifications, coût et contrat
+ * \param[in,out] p_os est le flux dans lequel le rapport est écrit
+ */
+void SiteContrat::ecrireRapport(std::ostream& p_os)
+{
+	p_os << "Passages\tVerifications\tCout (ns)\tSite\n";
+	for (const SiteContrat* site = reqPremierSite(); site != nullptr; site = site->reqSuivant())
+	{
+		p_os << site->reqNbPassages() << '\t' << site->reqNbVerifications() << '\t' << site->reqCoutNanosecondes()
+			 << '\t' << site->reqFichier() << ':' << site->reqLigne() << ' ' << site->reqExpression() << '\n';
+	}
+}
+
+/**
+ * \brief Démarre la mesure d'une vérification
+ * \param[in,out] p_site est le site auquel la durée sera ajoutée
+ */
+ChronometreContrat::ChronometreContrat(SiteContrat& p_site):
+		m_site(p_site), m_debut(std::chrono::steady_clock::now())
+{
+}
+
+/**
+ * \brief Ajoute la durée écoulée depuis la construction au coût du site
+ */
+ChronometreContrat::~ChronometreContrat()
+{
+	m_site.ajouterCout(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_debut).count());
+}
@@ -0,0 +1,121 @@
+/**
+ * \file SiteContrat.h
+ * \brief Fichier contenant l'interface de la classe SiteContrat, les compteurs d'un site de contrat vérifié par échantillonnage
+ * \author David Jalbert Ross
+ * \version 1.0
+ * \date 16 avril 2020
+ */
+
+#ifndef SITECONTRAT_H_
+#define SITECONTRAT_H_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iosfwd>
+
+/**
+ * Période d'échantillonnage par défaut du mode CONTRAT_ECHANTILLONNE : un passage sur
+ * CONTRAT_PERIODE_ECHANTILLONNAGE est vérifié à chaque site. Peut être redéfinie à la
+ * compilation, doit être une puissance de 2.
+ */
+#if !defined(CONTRAT_PERIODE_ECHANTILLONNAGE)
+#  define CONTRAT_PERIODE_ECHANTILLONNAGE 64
+#endif
+static_assert((CONTRAT_PERIODE_ECHANTILLONNAGE & (CONTRAT_PERIODE_ECHANTILLONNAGE - 1)) == 0,
+			  "CONTRAT_PERIODE_ECHANTILLONNAGE doit être une puissance de 2");
+
+/**
+ * \class SiteContrat
+ * \brief Compteurs d'un site de vérification de contrat en mode échantillonné
+ *
+ * 		Chaque expansion des macros POSTCONDITION, INVARIANTS et ASSERTION compilées avec
+ * 		CONTRAT_ECHANTILLONNE crée un site statique. Le site compte ses passages, ne fait vérifier
+ * 		qu'un passage sur reqPeriodeEchantillonnage() (le premier passage l'est toujours) et
+ * 		cumule le temps passé dans les vérifications. Les sites s'inscrivent à leur construction
+ * 		dans une liste globale, que ecrireRapport() parcourt. Compter un passage ne coûte qu'une
+ * 		lecture, une écriture et un masque : les compteurs sont atomiques pour qu'un site puisse
+ * 		être atteint par plusieurs fils d'exécution, mais ils ne sont pas incrémentés par une
+ * 		opération indivisible. Des passages simultanés peuvent donc ne compter qu'une fois ; les
+ * 		compteurs sont des estimations.
+ *
+ * 		Attributs: m_fichier, m_ligne, m_expression : l'emplacement et le texte du contrat
+ * 				   m_nbPassages : le nombre de fois que le site a été atteint
+ * 				   m_nbVerifications : le nombre de passages vérifiés
+ * 				   m_coutNanosecondes : le temps cumulé des vérifications
+ * 				   m_suivant : le site inscrit avant celui-ci
+ */
+class SiteContrat
+{
+public:
+	SiteContrat(const char* p_fichier, unsigned int p_ligne, const char* p_expression);
+
+	bool echantillonner();
+	void ajouterCout(std::uint64_t p_nanosecondes);
+
+	const char* reqFichier() const;
+	unsigned int reqLigne() const;
+	const char* reqExpression() const;
+	std::uint64_t reqNbPassages() const;
+	std::uint64_t reqNbVerifications() const;
+	std::uint64_t reqCoutNanosecondes() const;
+	const SiteContrat* reqSuivant() const;
+
+	static const SiteContrat* reqPremierSite();
+	static unsigned int reqPeriodeEchantillonnage();
+	static void asgPeriodeEchantillonnage(unsigned int p_periode);
+	static void ecrireRapport(std::ostream& p_os);
+
+private:
+	SiteContrat(const SiteContrat&);
+	SiteContrat& operator=(const SiteContrat&);
+
+	const char* m_fichier;
+	unsigned int m_ligne;
+	const char* m_expression;
+	std::atomic<std::uint64_t> m_nbPassages;
+	std::atomic<std::uint64_t> m_nbVerifications;
+	std::atomic<std::uint64_t> m_coutNanosecondes;
+	SiteContrat* m_suivant;
+
+	static std::atomic<SiteContrat*> s_premierSite;
+	static std::atomic<std::uint64_t> s_masqueEchantillonnage;
+};
+
+/**
+ * \class ChronometreContrat
+ * \brief Mesure le temps d'une vérification de contrat et l'ajoute au coût de son site,
+ * 		  y compris quand la vérification lance une exception
+ */
+class ChronometreContrat
+{
+public:
+	explicit ChronometreContrat(SiteContrat& p_site);
+	~ChronometreContrat();
+
+private:
+	ChronometreContrat(const ChronometreContrat&);
+	ChronometreContrat& operator=(const ChronometreContrat&);
+
+	SiteContrat& m_site;
+	std::chrono::steady_clock::time_point m_debut;
+};
+
+/**
+ * \brief Compte un passage au site et indique s'il doit être vérifié
+ * \return vrai pour un passage sur reqPeriodeEchantillonnage(), à commencer par le premier
+ */
+inline bool SiteContrat::echantillonner()
+{
+	std::uint64_t passage = m_nbPassages.load(std::memory_order_relaxed);
+	m_nbPassages.store(passage + 1, std::memory_order_relaxed);
+
+	bool verifier = (passage & s_masqueEchantillonnage.load(std::memory_order_relaxed)) == 0;
+	if (verifier)
+	{
+		m_nbVerifications.store(m_nbVerifications.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+	}
+	return verifier;
+}
+
+#endif
@@ -0,0 +1,155 @@
+/**
+ * \file TamponFormatage.cpp
+ * \brief Fichier d'implementation de la classe TamponFormatage
+ * \author David Jalbert Ross
+ * \version 1.0
+ * \date 16 avril 2020
+ */
+
+#include "TamponFormatage.h"
+#include <ostream>
+
+using namespace std;
+
+namespace util
+{
+
+/**
+ * \brief Constructeur par défaut
+ * 		  On construit un tampon vide qui utilise son espace interne
+ */
+TamponFormatage::TamponFormatage():
+		m_donnees(m_interne), m_longueur(0), m_capacite(TAILLE_INTERNE)
+{
+	INVARIANTS();
+}
+
+/**
+ * \brief Destructeur qui libère l'espace pris sur le tas, le cas échéant
+ */
+TamponFormatage::~TamponFormatage()
+{
+	if (m_donnees != m_interne)
+	{
+		delete[] m_donnees;
+	}
+}
+
+/**
+ * \brief Ajoute un entier écrit en base 10 à la fin du tampon
+ * \param[in] p_valeur est l'entier à écrire
+ */
+void TamponFormatage::ajouterEntier(long p_valeur)
+{
+	char chiffres[24];
+	char* fin = chiffres + sizeof(chiffres);
+	char* debut = fin;
+
+	unsigned long valeur = p_valeur < 0 ? 0UL - static_cast<unsigned long>(p_valeur) : static_cast<unsigned long>(p_valeur);
+	do
+	{
+		*--debut = static_cast<char>('0' + valeur % 10);
+		valeur /= 10;
+	}
+	while (valeur != 0);
+
+	if (p_valeur < 0)
+	{
+		*--debut = '-';
+	}
+
+	ajouter(debut, fin - debut);
+}
+
+/**
+ * \brief Ajoute un entier de 0 à 99 écrit sur deux chiffres (précédé d'un 0 au besoin)
+ * \param[in] p_valeur est l'entier à écrire, entre 0 et 99
+ */
+void TamponFormatage::ajouterEntierDeuxChiffres(long p_valeur)
+{
+	PRECONDITION(p_valeur >= 0 && p_valeur <= 99);
+
+	char chiffres[2] = { static_cast<char>('0' + p_valeur / 10), static_cast<char>('0' + p_valeur % 10) };
+	ajouter(chiffres, 2);
+}
+
+/**
+ * \brief Retourne le début du texte formaté, qui n'est pas terminé par un caractère nul
+ * \return un pointeur vers le premier caractère
+ */
+const char* TamponFormatage::reqDonnees() const
+{
+	return m_donnees;
+}
+
+/**
+ * \brief Retourne le nombre de caractères écrits dans le tampon
+ * \return un entier contenant la longueur du texte formaté
+ */
+std::size_t TamponFormatage::reqLongueur() const
+{
+	return m_longueur;
+}
+
+/**
+ * \brief Retourne une copie du texte formaté
+ * \return un string contenant le texte formaté
+ */
+std::string TamponFormatage::reqTexte() const
+{
+	return std::string(m_donnees, m_longueur);
+}
+
+/**
+ * \brief Écrit le texte formaté dans un flux de sortie
+ * \param[in,out] p_os est le flux dans lequel le texte est écrit
+ */
+void TamponFormatage::ecrire(std::ostream& p_os) const
+{
+	p_os.write(m_donnees, m_longueur);
+}
+
+/**
+ * \brief Vide le tampon en conservant sa capacité
+ */
+void TamponFormatage::vider()
+{
+	m_longueur = 0;
+	POSTCONDITION(reqLongueur() == 0);
+}
+
+/**
+ * \brief Agrandit le tampon pour qu'il puisse recevoir des caractères supplémentaires
+ * 		  La capacité est au moins doublée, pour un coût amorti constant par caractère.
+ * \param[in] p_longueurSupplementaire est le nombre de caractères à pouvoir ajouter
+ */
+void TamponFormatage::reserver(std::size_t p_longueurSupplementaire)
+{
+	std::size_t capacite = m_capacite * 2;
+	if (capacite < m_longueur + p_longueurSupplementaire)
+	{
+		capacite = m_longueur + p_longueurSupplementaire;
+	}
+
+	char* donnees = new char[capacite];
+	std::memcpy(donnees, m_donnees, m_longueur);
+	if (m_donnees != m_interne)
+	{
+		delete[] m_donnees;
+	}
+	m_donnees = donnees;
+	m_capacite = capacite;
+
+	INVARIANTS();
+}
+
+/**
+ * \brief Vérification des invariants de la classe TamponFormatage
+ */
+void TamponFormatage::verifieInvariant() const
+{
+	INVARIANT(m_longueur <= m_capacite);
+	INVARIANT(m_capacite >= TAILLE_INTERNE);
+}
+
+}
@@ -0,0 +1,108 @@
+/**
+ * \file TamponFormatage.h
+ * \brief Fichier contenant l'interface de la classe TamponFormatage, un tampon de caractères réutilisable pour le formatage
+ * \author David Jalbert Ross
+ * \version 1.0
+ * \date 16 avril 2020
+ */
+
+#ifndef TAMPONFORMATAGE_H_
+#define TAMPONFORMATAGE_H_
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <iosfwd>
+#include "ContratException.h"
+
+namespace util
+{
+
+/**
+ * \class TamponFormatage
+ * \brief Tampon de caractères dans lequel on formate du texte sans allocation
+ *
+ * 		Le tampon utilise d'abord un espace interne de taille fixe et ne passe au tas que
+ * 		si le texte le dépasse. Il conserve sa capacité quand on le vide : un même tampon
+ * 		peut servir à formater des milliers de membres sans aucune allocation. Les entiers
+ * 		sont écrits directement en chiffres, sans passer par un flux.
+ *
+ * 		Attributs: m_interne: l'espace interne de TAILLE_INTERNE caractères
+ * 				   m_donnees : le début du texte, dans m_interne ou sur le tas
+ * 				   m_longueur : le nombre de caractères écrits
+ * 				   m_capacite : le nombre de caractères disponibles dans m_donnees
+ */
+class TamponFormatage
+{
+public:
+	static const std::size_t TAILLE_INTERNE = 256;
+
+	TamponFormatage();
+	~TamponFormatage();
+
+	void ajouter(const char* p_texte, std::size_t p_longueur);
+	void ajouter(const std::string& p_texte);
+	void ajouter(char p_caractere);
+	void ajouterEntier(long p_valeur);
+	void ajouterEntierDeuxChiffres(long p_valeur);
+
+	const char* reqDonnees() const;
+	std::size_t reqLongueur() const;
+	std::string reqTexte() const;
+
+	void ecrire(std::ostream& p_os) const;
+	void vider();
+
+private:
+	TamponFormatage(const TamponFormatage&);
+	TamponFormatage& operator=(const TamponFormatage&);
+
+	void reserver(std::size_t p_longueurSupplementaire);
+	void verifieInvariant() const;
+
+	char m_interne[TAILLE_INTERNE];
+	char* m_donnees;
+	std::size_t m_longueur;
+	std::size_t m_capacite;
+};
+
+/**
+ * \brief Ajoute des caractères à la fin du tampon
+ * \param[in] p_texte est le début des caractères à ajouter
+ * \param[in] p_longueur est le nombre de caractères à ajouter
+ */
+inline void TamponFormatage::ajouter(const char* p_texte, std::size_t p_longueur)
+{
+	if (m_longueur + p_longueur > m_capacite)
+	{
+		reserver(p_longueur);
+	}
+	std::memcpy(m_donnees + m_longueur, p_texte, p_longueur);
+	m_longueur += p_longueur;
+}
+
+/**
+ * \brief Ajoute un caractère à la fin du tampon
+ * \param[in] p_caractere est le caractère à ajouter
+ */
+inline void TamponFormatage::ajouter(char p_caractere)
+{
+	if (m_longueur == m_capacite)
+	{
+		reserver(1);
+	}
+	m_donnees[m_longueur++] = p_caractere;
+}
+
+/**
+ * \brief Ajoute une chaîne à la fin du tampon
+ * \param[in] p_texte est la chaîne à ajouter
+ */
+inline void TamponFormatage::ajouter(const std::string& p_texte)
+{
+	ajouter(p_texte.data(), p_texte.length());
+}
+
+}
+
+#endif
@@ -0,0 +1,87 @@
+/**
+ * \file TriParBase.h
+ * \brief Fichier contenant le tri par base (radix) des grands tableaux de l'annuaire et de ses index
+ * \author David Jalbert Ross
+ * \version 1.0
+ * \date 16 avril 2020
+ */
+
+#ifndef TRIPARBASE_H_
+#define TRIPARBASE_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace util
+{
+
+/**
+ * \brief Retourne le nombre de bits nécessaires pour représenter un entier non signé
+ * \param[in] p_valeur est l'entier à représenter
+ * \return le nombre de bits, 0 pour 0
+ */
+inline unsigned int nbBits(std::uint64_t p_valeur)
+{
+	unsigned int nb = 0;
+	for (; p_valeur != 0; p_valeur >>= 1)
+	{
+		nb++;
+	}
+	return nb;
+}
+
+/**
+ * \brief Trie des valeurs par une clé entière, par chiffres de 11 bits du moins significatif au
+ * 		  plus significatif (tri par base), en O(n) par chiffre plutôt qu'en O(n log n)
+ * 		  comparaisons. Les comptes de tous les chiffres sont faits en une seule lecture des
+ * 		  valeurs et un chiffre commun à toutes les valeurs est sauté. Le tri est stable : trier
+ * 		  par une clé secondaire puis par la clé principale ordonne selon les deux.
+ * \param[in,out] p_vValeurs sont les valeurs à trier
+ * \param[in] p_nbBits est le nombre de bits significatifs de la clé, au plus 64 (voir nbBits())
+ * \param[in] p_cle est appelée avec une valeur et retourne sa clé, un std::uint64_t
+ */
+template<typename T, typename Cle>
+void trierParBase(std::vector<T>& p_vValeurs, unsigned int p_nbBits, Cle p_cle)
+{
+	const unsigned int BITS_CHIFFRE = 11;
+	const std::uint64_t MASQUE_CHIFFRE = (1 << BITS_CHIFFRE) - 1;
+	unsigned int nbChiffres = (p_nbBits + BITS_CHIFFRE - 1) / BITS_CHIFFRE;
+
+	std::vector<std::size_t> vComptes(nbChiffres << BITS_CHIFFRE, 0);
+	for (const T& valeur : p_vValeurs)
+	{
+		std::uint64_t cle = p_cle(valeur);
+		for (unsigned int chiffre = 0; chiffre < nbChiffres; chiffre++)
+		{
+			vComptes[chiffre << BITS_CHIFFRE | (cle >> chiffre * BITS_CHIFFRE & MASQUE_CHIFFRE)]++;
+		}
+	}
+
+	std::vector<T> vTampon;
+	for (unsigned int chiffre = 0; chiffre < nbChiffres; chiffre++)
+	{
+		auto debutComptes = vComptes.begin() + (chiffre << BITS_CHIFFRE);
+		auto finComptes = debutComptes + MASQUE_CHIFFRE + 1;
+		if (std::find(debutComptes, finComptes, p_vValeurs.size()) == finComptes)
+		{
+			std::size_t debut = 0;
+			for (auto compte = debutComptes; compte != finComptes; ++compte)
+			{
+				std::swap(*compte, debut);
+				debut += *compte;
+			}
+			vTampon.resize(p_vValeurs.size());
+			for (const T& valeur : p_vValeurs)
+			{
+				vTampon[debutComptes[p_cle(valeur) >> chiffre * BITS_CHIFFRE & MASQUE_CHIFFRE]++] = valeur;
+			}
+			p_vValeurs.swap(vTampon);
+		}
+	}
+}
+
+}
+
+#endif
@@ -9,201 +9,616 @@
 #include <iostream>
 #include <string>
 #include <cstring>
+#include <cstdint>
+#include <algorithm>
+#include "validationFormat.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define VALIDATION_FORMAT_SSE2
+#endif
 
 
 using namespace std;
 
-namespace util
+namespace
+{
+const std::size_t LONGUEUR_TELEPHONE = 12;
+
+/**
+ * Codes régionaux acceptés en plus de tous ceux qui commencent par 9. Pour accepter un
+ * nouveau code, il suffit de l'ajouter à cette table : l'ensemble des codes acceptés en
+ * est déduit à la compilation.
+ */
+constexpr int CODES_REGIONAUX[] = { 403, 780, 604, 236, 250, 778, 902, 204, 506, 905,
+									519, 289, 705, 613, 807, 416, 647, 438, 514, 450,
+									579, 418, 581, 819, 873, 306, 709, 867, 800, 866,
+									877, 888, 855 };
+constexpr int PREMIER_CODE_EN_9 = 900;
+constexpr int NB_CODES_REGIONAUX_POSSIBLES = 1000;
+
+/**
+ * \struct EnsembleCodesRegionaux
+ * \brief Ensemble de bits sur les codes régionaux 000 à 999, un bit par code accepté
+ */
+struct EnsembleCodesRegionaux
 {
+	std::uint64_t m_mots[(NB_CODES_REGIONAUX_POSSIBLES + 63) / 64];
+
+	constexpr bool contient(int p_code) const
+	{
+		return (m_mots[p_code >> 6] >> (p_code & 63)) & 1;
+	}
+};
+
 /**
- * \brief Détermine si un code régional est valide
- * \param[in] p_regional est un string contenant le code régional, doit être 3 caractères de long et composé de chiffres
+ * \brief Construit à la compilation l'ensemble des codes régionaux acceptés
+ * \return l'ensemble contenant CODES_REGIONAUX et tous les codes de 900 à 999
+ */
+constexpr EnsembleCodesRegionaux construireCodesRegionaux()
+{
+	EnsembleCodesRegionaux ensemble {};
+	for (int code : CODES_REGIONAUX)
+	{
+		ensemble.m_mots[code >> 6] |= std::uint64_t(1) << (code & 63);
+	}
+	for (int code = PREMIER_CODE_EN_9; code < NB_CODES_REGIONAUX_POSSIBLES; code++)
+	{
+		ensemble.m_mots[code >> 6] |= std::uint64_t(1) << (code & 63);
+	}
+	return ensemble;
+}
+
+constexpr EnsembleCodesRegionaux CODES_REGIONAUX_ACCEPTES = construireCodesRegionaux();
+static_assert(CODES_REGIONAUX_ACCEPTES.contient(418) && CODES_REGIONAUX_ACCEPTES.contient(999)
+			  && !CODES_REGIONAUX_ACCEPTES.contient(419), "Ensemble des codes régionaux mal construit");
+
+/**
+ * Gabarit du format NNN NNN-NNNN sur 16 octets. Un octet du numéro est valide si son
+ * ou exclusif avec MOTIF_TELEPHONE ne dépasse pas LIMITE_TELEPHONE : 0 à 9 pour un
+ * chiffre (comparé à '0'), exactement 0 pour un séparateur et pour le bourrage.
+ */
+alignas(16) const unsigned char MOTIF_TELEPHONE[16] = { '0', '0', '0', ' ', '0', '0', '0', '-', '0', '0', '0', '0', 0, 0, 0, 0 };
+alignas(16) const unsigned char LIMITE_TELEPHONE[16] = { 9, 9, 9, 0, 9, 9, 9, 0, 9, 9, 9, 9, 0, 0, 0, 0 };
+
+/**
+ * \brief Détermine si un code régional est valide, en une seule lecture de l'ensemble des codes acceptés
+ * \param[in] p_regional pointe vers les trois chiffres du code régional, déjà validés
  * \return un booléen indiquant si le code régional est valide
  */
-bool checkRegionalCode(const std::string& p_regional)
+inline bool codeRegionalValide(const char* p_regional)
+{
+	return CODES_REGIONAUX_ACCEPTES.contient((p_regional[0] - '0') * 100 + (p_regional[1] - '0') * 10 + (p_regional[2] - '0'));
+}
+
+/**
+ * \brief Vérifie la disposition NNN NNN-NNNN d'un numéro de téléphone de 12 caractères
+ * 		  Avec SSE2, les 12 caractères sont comparés au gabarit en une seule opération sur 16 octets ;
+ * 		  sinon, la même comparaison est faite caractère par caractère, sans branchement.
+ * \param[in] p_telephone pointe vers les 12 caractères du numéro
+ * \return un booléen indiquant si la disposition est respectée
+ */
+bool formatTelephoneValide(const char* p_telephone)
+{
+#if defined(VALIDATION_FORMAT_SSE2)
+	alignas(16) unsigned char octets[16] = { 0 };
+	std::memcpy(octets, p_telephone, LONGUEUR_TELEPHONE);
+
+	__m128i ecarts = _mm_xor_si128(_mm_load_si128(reinterpret_cast<const __m128i*>(octets)),
+								   _mm_load_si128(reinterpret_cast<const __m128i*>(MOTIF_TELEPHONE)));
+	__m128i depassements = _mm_subs_epu8(ecarts, _mm_load_si128(reinterpret_cast<const __m128i*>(LIMITE_TELEPHONE)));
+	return _mm_movemask_epi8(_mm_cmpeq_epi8(depassements, _mm_setzero_si128())) == 0xFFFF;
+#else
+	unsigned int depassements = 0;
+	for (std::size_t i = 0; i < LONGUEUR_TELEPHONE; i++)
+	{
+		unsigned char ecart = static_cast<unsigned char>(p_telephone[i]) ^ MOTIF_TELEPHONE[i];
+		depassements |= ecart > LIMITE_TELEPHONE[i];
+	}
+	return depassements == 0;
+#endif
+}
+
+/**
+ * \brief Retourne la taille de la lettre qui commence un texte : une lettre ASCII ou une lettre
+ * 		  latine accentuée encodée en UTF-8 sur deux octets (U+00C0 à U+024F, sauf × et ÷)
+ * \param[in] p_texte pointe vers le début de la lettre
+ * \param[in] p_reste est le nombre de caractères disponibles, au moins 1
+ * \return le nombre d'octets de la lettre, ou 0 si le texte ne commence pas par une lettre
+ */
+std::size_t tailleLettre(const char* p_texte, std::size_t p_reste)
 {
-	std::string regionalList[33] = {"403", "780", "604", "236", "250", "778", "902", "204", "506", "905",
-									"519", "289", "705", "613", "807", "416", "647", "438", "514", "450"
-									"579", "418", "581", "819", "873", "306", "709", "867", "800", "866"
-									"877", "888", "855"};
+	unsigned char premier = static_cast<unsigned char>(p_texte[0]);
+	std::size_t taille = 0;
 
-	bool found{false};
-	int i = 0;
-	while(!found && i < 33)
+	if (static_cast<unsigned char>((premier | 0x20) - 'a') <= 'z' - 'a')
 	{
-		if(p_regional == regionalList[i])
+		taille = 1;
+	}
+	else if (premier >= 0xC3 && premier <= 0xC9 && p_reste >= 2 && (static_cast<unsigned char>(p_texte[1]) & 0xC0) == 0x80)
+	{
+		unsigned int point = ((premier & 0x1F) << 6) | (static_cast<unsigned char>(p_texte[1]) & 0x3F);
+		if (point >= 0xC0 && point <= 0x24F && point != 0xD7 && point != 0xF7)
 		{
-			found = true;
+			taille = 2;
 		}
-		i++;
 	}
 
-	if(p_regional[0] == '9')
+	return taille;
+}
+
+/**
+ * Lettre ASCII majuscule équivalente à chaque lettre de U+00C0 à U+00FF, puis de U+0100 à
+ * U+017F. '*' marque une lettre qui s'écrit avec deux lettres (voir digraphe()) ; '.' marque
+ * × et ÷, qui ne sont pas des lettres et ne sont jamais normalisés.
+ */
+const char LATIN_1[] = "AAAAAA*CEEEEIIIIDNOOOOO.OUUUUY**AAAAAA*CEEEEIIIIDNOOOOO.OUUUUY*Y";
+const char LATIN_ETENDU_A[] = "AAAAAACCCCCCCCDDDDEEEEEEEEEEGGGGGGGGHHHHIIIIIIIIII**JJKKKLLLLLLLLLLNNNNNNNNNOOOOOO**RRRRRRSSSSSSSSTTTTTTUUUUUUUUUUUUWWYYYZZZZZZS";
+
+/**
+ * \brief Retourne les deux lettres ASCII majuscules d'une lettre marquée '*' dans les tables
+ * \param[in] p_point est le point de code de la lettre
+ * \param[out] p_premiere reçoit la première lettre
+ * \param[out] p_seconde reçoit la seconde lettre
+ */
+void digraphe(unsigned int p_point, char& p_premiere, char& p_seconde)
+{
+	switch (p_point)
 	{
-		found = true;
+	case 0xC6: case 0xE6: p_premiere = 'A'; p_seconde = 'E'; break;
+	case 0xDE: case 0xFE: p_premiere = 'T'; p_seconde = 'H'; break;
+	case 0xDF: p_premiere = 'S'; p_seconde = 'S'; break;
+	case 0x132: case 0x133: p_premiere = 'I'; p_seconde = 'J'; break;
+	default: p_premiere = 'O'; p_seconde = 'E'; break;
 	}
-
-	return found;
 }
 
 /**
- * \brief Détermine si un numéro de téléphone est valide
- * \param[in] p_telephone est un string contenant le numéro de téléphone à valider
- * \return un booléen indiquant si le numéro de téléphone est valide
+ * \class LecteurNom
+ * \brief Lit un à un les caractères de la forme normalisée d'un nom (voir util::normaliserNom()),
+ * 		  sans la construire
  */
-bool validerTelephone(const std::string& p_telephone)
+class LecteurNom
 {
-	std::string regional;
-	for(int i = 0; i < 3;i++)
+public:
+	explicit LecteurNom(const std::string& p_nom):
+			m_texte(p_nom.data()), m_reste(p_nom.length()), m_suivant('\0')
 	{
-		regional+= p_telephone[i];
 	}
 
-	bool valide{true};
-	valide = checkRegionalCode(regional);
-	int lenStr = p_telephone.length();
-	int i = 0;
-	while(i < lenStr && valide)
+	/**
+	 * \brief Lit le prochain caractère normalisé
+	 * \param[out] p_caractere reçoit le caractère lu
+	 * \return faux si tout le nom a été lu
+	 */
+	bool lire(char& p_caractere)
 	{
-		if(i == 3)
+		bool lu = true;
+
+		if (m_suivant != '\0')
 		{
-			if(p_telephone[i] != ' ')
-			{
-				valide = false;
-			}
+			p_caractere = m_suivant;
+			m_suivant = '\0';
 		}
-		else if(i == 7)
+		else if (m_reste == 0)
 		{
-			if(p_telephone[i] != '-')
-			{
-				valide = false;
-			}
+			lu = false;
 		}
 		else
 		{
-			if(!isdigit(p_telephone[i]))
+			unsigned char premier = static_cast<unsigned char>(m_texte[0]);
+			std::size_t taille = 1;
+			p_caractere = static_cast<char>(premier);
+
+			if (premier >= 'a' && premier <= 'z')
 			{
-				valide = false;
+				p_caractere = static_cast<char>(premier - 'a' + 'A');
 			}
+			else if (premier <= 0xC5 && tailleLettre(m_texte, m_reste) == 2)
+			{
+				// Seules U+00C0 à U+017F, dont le premier octet va de 0xC3 à 0xC5, ont un équivalent ASCII
+				unsigned int point = ((premier & 0x1F) << 6) | (static_cast<unsigned char>(m_texte[1]) & 0x3F);
+				p_caractere = point < 0x100 ? LATIN_1[point - 0xC0] : LATIN_ETENDU_A[point - 0x100];
+				if (p_caractere == '*')
+				{
+					digraphe(point, p_caractere, m_suivant);
+				}
+				taille = 2;
+			}
+
+			m_texte += taille;
+			m_reste -= taille;
 		}
-		i++;
+
+		return lu;
 	}
 
-	return valide;
+private:
+	const char* m_texte;
+	std::size_t m_reste;
+	char m_suivant;
+};
+
+const std::size_t LONGUEUR_NUM_RAMQ = 14;
+const std::size_t LONGUEUR_CLE_RAMQ = 12;
+
+/**
+ * \brief Met en majuscules les lettres ASCII de quatre octets à la fois, sans branchement
+ * 		  Les autres octets, y compris ceux de 0x80 et plus, sont laissés intacts, comme le fait
+ * 		  toupper() dans la locale "C".
+ * \param[in] p_mot contient les quatre octets
+ * \return les quatre octets, lettres minuscules converties en majuscules
+ */
+inline std::uint32_t majusculesAscii(std::uint32_t p_mot)
+{
+	std::uint32_t septBits = p_mot & 0x7F7F7F7F;
+	std::uint32_t auMoinsA = septBits + 0x1F1F1F1F;	// bit 7 allumé si l'octet est >= 'a'
+	std::uint32_t apresZ = septBits + 0x05050505;	// bit 7 allumé si l'octet est > 'z'
+	std::uint32_t minuscules = auMoinsA & ~apresZ & ~p_mot & 0x80808080;
+	return p_mot - (minuscules >> 2);
 }
 
 /**
- * \brief Détermine si un numéro RAMQ est valide
- * \param[in] p_numero est un string contenant le numéro RAMQ à valider
- * \param[in] p_nom est un string contenant le nom associé au numéro RAMQ
- * \param[in] p_prenom est un string contenant le prenom associé au numéro RAMQ
- * \param[in] p_jourNaissance est un int contenant le jour de la date de naissance
- * \param[in] p_moisNaissance est un int contenant le mois de la date de naissance
- * \param[in] p_anneeNaissance est un int contenant l'annee de la date de naissance
- * \param[in] p_sex est un char contenant le sexe, doit être 'M' ou 'F'
- * \return un booléen indiquant si le numéro RAMQ est valide
+ * \brief Copie les premières lettres de la forme normalisée d'un nom (voir util::normaliserNom())
+ * 		  Une lettre absente d'un nom trop court est remplacée par le caractère nul.
+ * \param[in] p_nom est le nom ou prénom dont les lettres sont lues
+ * \param[out] p_lettres reçoit p_nbLettres caractères
+ * \param[in] p_nbLettres est le nombre de lettres à copier
  */
-bool validerNumRAMQ(const std::string& p_numero, const std::string& p_nom, const
-std::string& p_prenom, int p_jourNaissance, int p_moisNaissance, int
-p_anneeNaissance, char p_sex)
+void copierLettresNormalisees(const std::string& p_nom, char* p_lettres, std::size_t p_nbLettres)
 {
-	bool valide{true};
+	LecteurNom lecteur(p_nom);
+	std::size_t i = 0;
 
-	int lenStr = p_numero.length();
-	if (lenStr != 14)
+	while (i < p_nbLettres && lecteur.lire(p_lettres[i]))
 	{
-		valide = false;
+		i++;
 	}
-
-	for(int i = 0; i < 3; i++)
+	for (; i < p_nbLettres; i++)
 	{
-		if(toupper(p_numero[i]) != toupper(p_nom[i]))
-		{
-			valide = false;
-		}
+		p_lettres[i] = '\0';
 	}
+}
+
+/**
+ * \brief Calcule les 12 premiers caractères attendus d'un numéro de RAMQ : trois lettres du nom,
+ * 		  une du prénom, puis « AA MM JJ » où le mois est augmenté de 50 pour une femme.
+ * 		  Les lettres sont celles de la forme normalisée du nom et du prénom : Émond et Jean
+ * 		  donnent EMOJ. Une lettre absente d'un nom trop court est remplacée par le caractère nul.
+ * \param[out] p_cle reçoit les LONGUEUR_CLE_RAMQ caractères attendus
+ * \return faux si le jour, le mois ou l'année ne peuvent pas former une clé
+ */
+bool construireCleRAMQ(const std::string& p_nom, const std::string& p_prenom, int p_jour, int p_mois, int p_annee,
+					   char p_sexe, char* p_cle)
+{
+	int mois = p_sexe == 'F' ? p_mois + 50 : p_mois;
+	int annee = p_annee % 100;
 
-	if(toupper(p_numero[3]) != toupper(p_prenom[0]))
+	copierLettresNormalisees(p_nom, p_cle, 3);
+	copierLettresNormalisees(p_prenom, p_cle + 3, 1);
+	p_cle[4] = ' ';
+	p_cle[5] = '0' + annee / 10;
+	p_cle[6] = '0' + annee % 10;
+	p_cle[7] = '0' + mois / 10;
+	p_cle[8] = '0' + mois % 10;
+	p_cle[9] = ' ';
+	p_cle[10] = '0' + p_jour / 10;
+	p_cle[11] = '0' + p_jour % 10;
+
+	return p_jour >= 1 && p_jour <= 31 && p_mois >= 1 && p_mois <= 12 && p_annee >= 0;
+}
+
+/**
+ * \brief Compare les 12 premiers caractères d'un numéro de RAMQ à la clé attendue
+ * 		  Les quatre lettres forment un mot de 32 bits comparé sans égard à la casse, les huit
+ * 		  caractères suivants un mot de 64 bits comparé tel quel.
+ * \param[in] p_numero pointe vers au moins LONGUEUR_CLE_RAMQ caractères du numéro
+ * \param[in] p_cle pointe vers la clé calculée par construireCleRAMQ()
+ * \return un booléen indiquant si le numéro correspond à la clé
+ */
+inline bool cleRAMQValide(const char* p_numero, const char* p_cle)
+{
+	std::uint32_t lettresNumero, lettresCle;
+	std::uint64_t resteNumero, resteCle;
+	std::memcpy(&lettresNumero, p_numero, sizeof(lettresNumero));
+	std::memcpy(&lettresCle, p_cle, sizeof(lettresCle));
+	std::memcpy(&resteNumero, p_numero + sizeof(lettresNumero), sizeof(resteNumero));
+	std::memcpy(&resteCle, p_cle + sizeof(lettresCle), sizeof(resteCle));
+
+	return ((majusculesAscii(lettresNumero) ^ majusculesAscii(lettresCle)) | (resteNumero ^ resteCle)) == 0;
+}
+
+const std::size_t TAILLE_BLOC_RAMQ = 64;
+
+/**
+ * Numéro lu à la place d'un numéro de mauvaise longueur, pour ne jamais lire au-delà d'une
+ * chaîne trop courte : son résultat est de toute façon écarté.
+ */
+const char NUMERO_RAMQ_IGNORE[LONGUEUR_CLE_RAMQ] = { };
+
+/**
+ * \brief Assemble des octets en un mot, le premier octet dans les bits de poids faible
+ * 		  Les mots de la clé RAMQ sont calculés dans cet ordre par des décalages plutôt
+ * 		  qu'écrits octet par octet puis relus en un mot, relecture qui ne peut pas profiter du
+ * 		  transfert des écritures vers les lectures et attend qu'elles atteignent le cache.
+ * 		  Le compilateur réduit l'assemblage à une seule lecture sur un processeur petit-boutiste.
+ * \param[in] p_octets pointe vers au moins p_nbOctets octets
+ * \param[in] p_nbOctets est le nombre d'octets, au plus 8
+ * \return le mot assemblé
+ */
+inline std::uint64_t assemblerOctets(const char* p_octets, std::size_t p_nbOctets)
+{
+	std::uint64_t mot = 0;
+	for (std::size_t i = 0; i < p_nbOctets; i++)
 	{
-		valide = false;
+		mot |= std::uint64_t(static_cast<unsigned char>(p_octets[i])) << (8 * i);
 	}
+	return mot;
+}
 
-	if(p_numero[4] != ' ' || p_numero[9] != ' ')
+/**
+ * \brief Retourne les premières lettres normalisées d'un nom (voir copierLettresNormalisees())
+ * 		  Quand ses p_nbLettres premiers octets sont ASCII, ce sont les lettres normalisées au
+ * 		  détail de la casse près, que la comparaison ignore : ils sont pris tels quels. Sinon,
+ * 		  les lettres sont lues avec LecteurNom.
+ * \param[in] p_nom est le nom ou prénom dont les lettres sont lues
+ * \param[in] p_nbLettres est le nombre de lettres, au plus 3
+ * \return les lettres assemblées par assemblerOctets()
+ */
+inline std::uint32_t lettresNormalisees(const std::string& p_nom, std::size_t p_nbLettres)
+{
+	std::uint32_t mot = 0x80;
+	if (p_nom.length() >= p_nbLettres)
 	{
-		valide = false;
+		mot = static_cast<std::uint32_t>(assemblerOctets(p_nom.data(), p_nbLettres));
 	}
-
-	if((p_numero[5] - 48) != (p_anneeNaissance / 10 % 10) || (p_numero[6] - 48) != (p_anneeNaissance % 10))
+	if ((mot & 0x80808080) != 0)
 	{
-		valide = false;
+		char lettres[3];
+		copierLettresNormalisees(p_nom, lettres, p_nbLettres);
+		mot = static_cast<std::uint32_t>(assemblerOctets(lettres, p_nbLettres));
 	}
+	return mot;
+}
+
+/**
+ * \brief Calcule les quatre lettres de la clé RAMQ d'une ligne : trois du nom, une du prénom
+ * \param[in] p_nom est le nom de la ligne
+ * \param[in] p_prenom est le prénom de la ligne
+ * \return les quatre lettres assemblées par assemblerOctets()
+ */
+inline std::uint32_t lettresCleRAMQ(const std::string& p_nom, const std::string& p_prenom)
+{
+	return lettresNormalisees(p_nom, 3) | lettresNormalisees(p_prenom, 1) << 24;
+}
+
+/**
+ * \brief Calcule les huit derniers caractères de la clé RAMQ, « AAMM JJ » précédé d'une
+ * 		  espace, à partir d'une date compactée, sans branchement
+ * \param[in] p_date est la date compactée selon annee << 9 | mois << 5 | jour
+ * \param[in] p_sexe est le sexe, le mois est augmenté de 50 pour 'F'
+ * \return les huit caractères assemblés par assemblerOctets()
+ */
+inline std::uint64_t resteCleRAMQ(std::uint32_t p_date, char p_sexe)
+{
+	// « 0000 00 » précédé d'une espace, le premier caractère dans l'octet de poids faible
+	const std::uint64_t GABARIT = 0x3030203030303020;
+	std::uint32_t jour = p_date & 0x1F;
+	std::uint32_t mois = ((p_date >> 5) & 0x0F) + 50 * (p_sexe == 'F');
+	std::uint32_t annee = (p_date >> 9) % 100;
+	std::uint32_t anneeMois = (annee / 10) | (annee % 10) << 8 | (mois / 10) << 16 | (mois % 10) << 24;
+	std::uint32_t jours = (jour / 10) << 16 | (jour % 10) << 24;
+	return GABARIT | std::uint64_t(anneeMois) << 8 | std::uint64_t(jours) << 32;
+}
 
+/**
+ * \brief Indique si une date compactée peut former une clé RAMQ, comme construireCleRAMQ()
+ * \param[in] p_date est la date compactée selon annee << 9 | mois << 5 | jour
+ * \return vrai si le jour est entre 1 et 31 et le mois entre 1 et 12
+ */
+inline bool dateCleRAMQValide(std::uint32_t p_date)
+{
+	std::uint32_t jour = p_date & 0x1F;
+	std::uint32_t mois = (p_date >> 5) & 0x0F;
+	return (jour != 0) & (mois - 1 < 12);
+}
 
-	if(p_moisNaissance < 10)
+/**
+ * \brief Valide un bloc d'au plus TAILLE_BLOC_RAMQ lignes en trois passes sur les colonnes :
+ * 		  les lettres des clés, puis les dates, puis la comparaison aux numéros.
+ * 		  Seule la première passe lit les noms ; les deux autres ne font que de l'arithmétique
+ * 		  sur des mots, sans branchement qui dépende des données.
+ * \return le nombre de numéros valides du bloc
+ */
+std::size_t validerBlocRAMQ(const std::string* p_numeros, const std::string* p_noms, const std::string* p_prenoms,
+							const std::uint32_t* p_datesNaissance, const char* p_sexes, std::size_t p_nbLignes,
+							bool* p_valides)
+{
+	std::uint32_t lettres[TAILLE_BLOC_RAMQ];
+	std::uint64_t restes[TAILLE_BLOC_RAMQ];
+	bool datesValides[TAILLE_BLOC_RAMQ];
+	std::size_t nbValides = 0;
+
+	for (std::size_t i = 0; i < p_nbLignes; i++)
 	{
-		if(p_sex == 'F')
-		{
-			if(p_numero[7] != '5' || (p_numero[8] - 48) != p_moisNaissance)
-			{
-				valide = false;
-			}
-		}
-		else
-		{
-			if(p_numero[7] != '0' || (p_numero[8] - 48) != p_moisNaissance)
-			{
-				valide = false;
-			}
-		}
+		lettres[i] = lettresCleRAMQ(p_noms[i], p_prenoms[i]);
 	}
-	else
+	for (std::size_t i = 0; i < p_nbLignes; i++)
 	{
-		if(p_sex == 'F')
-		{
-			if(p_numero[7] != '6' || (p_numero[8] - 48) != (p_moisNaissance - 10))
-			{
-				valide = false;
-			}
-		}
-		else
-		{
-			if(p_numero[7] != '1' || (p_numero[8] - 48) != (p_moisNaissance - 10))
-			{
-				valide = false;
-			}
-		}
+		restes[i] = resteCleRAMQ(p_datesNaissance[i], p_sexes[i]);
+		datesValides[i] = dateCleRAMQValide(p_datesNaissance[i]);
 	}
+	for (std::size_t i = 0; i < p_nbLignes; i++)
+	{
+		bool longueurValide = p_numeros[i].length() == LONGUEUR_NUM_RAMQ;
+		const char* numero = longueurValide ? p_numeros[i].data() : NUMERO_RAMQ_IGNORE;
+		std::uint32_t lettresNumero = static_cast<std::uint32_t>(assemblerOctets(numero, 4));
+		std::uint64_t resteNumero = assemblerOctets(numero + 4, 8);
+
+		bool cleEgale = ((majusculesAscii(lettresNumero) ^ majusculesAscii(lettres[i])) | (resteNumero ^ restes[i])) == 0;
+		p_valides[i] = longueurValide & datesValides[i] & cleEgale;
+		nbValides += p_valides[i];
+	}
+
+	return nbValides;
+}
 
-	if(p_jourNaissance < 10)
+const std::size_t TAILLE_BLOC_NOM = 16;
+
+/**
+ * \struct BlocNom
+ * \brief Résultat de la vérification d'un bloc d'au plus 16 caractères d'un nom
+ */
+struct BlocNom
+{
+	bool m_lettres;		// tous les caractères sont des lettres ASCII
+	bool m_nonAscii;	// au moins un octet est supérieur à 0x7F
+};
+
+/**
+ * \brief Vérifie si un bloc d'au plus 16 caractères ne contient que des lettres ASCII
+ * 		  Avec SSE2, le bloc est complété par des 'a' puis vérifié en une seule opération : un
+ * 		  octet est une lettre si, une fois mis en minuscule par OU avec 0x20, il est entre 'a' et 'z'.
+ * \param[in] p_bloc pointe vers les caractères du bloc
+ * \param[in] p_taille est le nombre de caractères du bloc, au plus TAILLE_BLOC_NOM
+ * \return le résultat de la vérification
+ */
+BlocNom verifierBlocNom(const char* p_bloc, std::size_t p_taille)
+{
+	BlocNom resultat;
+#if defined(VALIDATION_FORMAT_SSE2)
+	__m128i octets;
+	if (p_taille == TAILLE_BLOC_NOM)
 	{
-		if(p_numero[10] != '0' || (p_numero[11] - 48) != p_jourNaissance)
-		{
-			valide = false;
-		}
+		octets = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_bloc));
 	}
-	else if(p_jourNaissance < 20)
+	else
 	{
-		if(p_numero[10] != '1' || (p_numero[11] - 48) != p_jourNaissance - 10)
-		{
-			valide = false;
-		}
+		alignas(16) char complet[TAILLE_BLOC_NOM];
+		std::memset(complet, 'a', TAILLE_BLOC_NOM);
+		std::memcpy(complet, p_bloc, p_taille);
+		octets = _mm_load_si128(reinterpret_cast<const __m128i*>(complet));
 	}
-	else if(p_jourNaissance < 30)
+
+	__m128i rang = _mm_sub_epi8(_mm_or_si128(octets, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+	__m128i horsAlphabet = _mm_subs_epu8(rang, _mm_set1_epi8('z' - 'a'));
+	resultat.m_lettres = _mm_movemask_epi8(_mm_cmpeq_epi8(horsAlphabet, _mm_setzero_si128())) == 0xFFFF;
+	resultat.m_nonAscii = _mm_movemask_epi8(octets) != 0;
+#else
+	unsigned int horsAlphabet = 0;
+	unsigned int nonAscii = 0;
+	for (std::size_t i = 0; i < p_taille; i++)
 	{
-		if(p_numero[10] != '2' || (p_numero[11] - 48) != p_jourNaissance - 20)
-		{
-			valide = false;
-		}
+		unsigned char octet = static_cast<unsigned char>(p_bloc[i]);
+		horsAlphabet |= static_cast<unsigned char>((octet | 0x20) - 'a') > 'z' - 'a';
+		nonAscii |= octet >> 7;
 	}
-	else
+	resultat.m_lettres = horsAlphabet == 0;
+	resultat.m_nonAscii = nonAscii != 0;
+#endif
+	return resultat;
+}
+}
+
+namespace util
+{
+/**
+ * \brief Détermine si un numéro de téléphone est valide
+ * \param[in] p_telephone est un string contenant le numéro de téléphone à valider
+ * \return un booléen indiquant si le numéro de téléphone est valide
+ */
+bool validerTelephone(const std::string& p_telephone)
+{
+	return validerTelephone(p_telephone.data(), p_telephone.length());
+}
+
+/**
+ * \brief Détermine si un numéro de téléphone est valide
+ * 		  Le numéro doit avoir exactement le format NNN NNN-NNNN et un code régional accepté.
+ * 		  Aucun caractère n'est lu au-delà de p_longueur.
+ * \param[in] p_telephone pointe vers les caractères du numéro de téléphone à valider
+ * \param[in] p_longueur est le nombre de caractères du numéro
+ * \return un booléen indiquant si le numéro de téléphone est valide
+ */
+bool validerTelephone(const char* p_telephone, std::size_t p_longueur)
+{
+	return p_longueur == LONGUEUR_TELEPHONE && formatTelephoneValide(p_telephone) && codeRegionalValide(p_telephone);
+}
+
+/**
+ * \brief Valide un lot de numéros de téléphone
+ * \param[in] p_telephones pointe vers le premier des numéros à valider
+ * \param[in] p_nbTelephones est le nombre de numéros à valider
+ * \param[out] p_valides reçoit, pour chaque numéro, un booléen indiquant s'il est valide
+ * \return le nombre de numéros valides
+ */
+std::size_t validerTelephones(const std::string* p_telephones, std::size_t p_nbTelephones, bool* p_valides)
+{
+	std::size_t nbValides = 0;
+
+	for (std::size_t i = 0; i < p_nbTelephones; i++)
 	{
-		if(p_numero[10] != '3' || (p_numero[11] - 48) != p_jourNaissance - 30)
-		{
-			valide = false;
-		}
+		p_valides[i] = validerTelephone(p_telephones[i].data(), p_telephones[i].length());
+		nbValides += p_valides[i];
 	}
 
-	return valide;
+	return nbValides;
+}
+
+/**
+ * \brief Détermine si un numéro RAMQ est valide
+ * 		  Les 12 premiers caractères attendus sont calculés à partir du nom, du prénom, de la
+ * 		  date de naissance et du sexe, puis comparés au numéro en deux mots (voir cleRAMQValide()).
+ * 		  Les lettres d'un nom accentué sont celles de sa forme sans accent (voir normaliserNom()).
+ * \param[in] p_numero est un string contenant le numéro RAMQ à valider
+ * \param[in] p_nom est un string contenant le nom associé au numéro RAMQ
+ * \param[in] p_prenom est un string contenant le prenom associé au numéro RAMQ
+ * \param[in] p_jourNaissance est un int contenant le jour de la date de naissance
+ * \param[in] p_moisNaissance est un int contenant le mois de la date de naissance
+ * \param[in] p_anneeNaissance est un int contenant l'annee de la date de naissance
+ * \param[in] p_sex est un char contenant le sexe, doit être 'M' ou 'F'
+ * \return un booléen indiquant si le numéro RAMQ est valide
+ */
+bool validerNumRAMQ(const std::string& p_numero, const std::string& p_nom, const
+std::string& p_prenom, int p_jourNaissance, int p_moisNaissance, int
+p_anneeNaissance, char p_sex)
+{
+	char cle[LONGUEUR_CLE_RAMQ];
+	return p_numero.length() == LONGUEUR_NUM_RAMQ
+		   && construireCleRAMQ(p_nom, p_prenom, p_jourNaissance, p_moisNaissance, p_anneeNaissance, p_sex, cle)
+		   && cleRAMQValide(p_numero.data(), cle);
+}
+
+/**
+ * \brief Valide un lot de numéros RAMQ rangés en colonnes
+ * 		  Chaque numéro est comparé à la clé calculée à partir de la même ligne des autres colonnes,
+ * 		  avec le même résultat que validerNumRAMQ(). Le lot est traité par blocs de
+ * 		  TAILLE_BLOC_RAMQ lignes : toutes les clés d'un bloc sont calculées avant d'être
+ * 		  comparées (voir validerBlocRAMQ()).
+ * \param[in] p_numeros pointe vers la colonne des numéros RAMQ à valider
+ * \param[in] p_noms pointe vers la colonne des noms
+ * \param[in] p_prenoms pointe vers la colonne des prénoms
+ * \param[in] p_datesNaissance pointe vers la colonne des dates de naissance compactées
+ * 		  selon annee << 9 | mois << 5 | jour (voir AnnuaireColonnes::compacterDate())
+ * \param[in] p_sexes pointe vers la colonne des sexes, 'M' ou 'F'
+ * \param[in] p_nbNumeros est le nombre de lignes à valider
+ * \param[out] p_valides reçoit, pour chaque ligne, un booléen indiquant si le numéro est valide
+ * \return le nombre de numéros valides
+ */
+std::size_t validerNumRAMQs(const std::string* p_numeros, const std::string* p_noms, const std::string* p_prenoms,
+							const std::uint32_t* p_datesNaissance, const char* p_sexes, std::size_t p_nbNumeros,
+							bool* p_valides)
+{
+	std::size_t nbValides = 0;
+
+	for (std::size_t debut = 0; debut < p_nbNumeros; debut += TAILLE_BLOC_RAMQ)
+	{
+		std::size_t nbLignes = std::min(TAILLE_BLOC_RAMQ, p_nbNumeros - debut);
+		nbValides += validerBlocRAMQ(p_numeros + debut, p_noms + debut, p_prenoms + debut, p_datesNaissance + debut,
+									 p_sexes + debut, nbLignes, p_valides + debut);
+	}
+
+	return nbValides;
 }
 
 /**
@@ -213,30 +628,135 @@ p_anneeNaissance, char p_sex)
  */
 bool validerFormatNom(const std::string& p_nom)
 {
-	bool valide{true};
+	return validerFormatNom(p_nom.data(), p_nom.length());
+}
 
-	int lenStr = p_nom.length();
-	if (lenStr == 0)
-	{
-		valide = false;
-	}
-	else
+/**
+ * \brief Détermine si un nom ou prénom est valide
+ * 		  Le nom doit être non vide et composé uniquement de lettres : lettres ASCII ou lettres
+ * 		  latines accentuées encodées en UTF-8 (U+00C0 à U+024F, sauf × et ÷). Le résultat ne
+ * 		  dépend pas de la locale. Les blocs de 16 caractères ASCII sont vérifiés en une seule
+ * 		  opération SSE2 ; la vérification UTF-8 n'est faite qu'à partir du premier bloc qui
+ * 		  contient un octet non ASCII.
+ * \param[in] p_nom pointe vers les caractères du nom ou prénom à valider
+ * \param[in] p_longueur est le nombre de caractères du nom
+ * \return un booléen indiquant si le nom ou prénom est valide
+ */
+bool validerFormatNom(const char* p_nom, std::size_t p_longueur)
+{
+	bool valide = p_longueur > 0;
+	bool asciiSeulement = true;
+	std::size_t i = 0;
+
+	while (valide && asciiSeulement && i < p_longueur)
 	{
-		int i = 0;
-		while(i < lenStr && valide)
+		std::size_t taille = std::min(TAILLE_BLOC_NOM, p_longueur - i);
+		BlocNom bloc = verifierBlocNom(p_nom + i, taille);
+		asciiSeulement = !bloc.m_nonAscii;
+		valide = !asciiSeulement || bloc.m_lettres;
+		if (asciiSeulement)
 		{
-			if(!isalpha(p_nom[i]))
-			{
-				valide = false;
-			}
-			i++;
+			i += taille;
 		}
 	}
 
+	while (valide && i < p_longueur)
+	{
+		std::size_t taille = tailleLettre(p_nom + i, p_longueur - i);
+		valide = taille != 0;
+		i += taille;
+	}
+
 	return valide;
 }
+
+/**
+ * \brief Valide un lot de noms ou de prénoms
+ * \param[in] p_noms pointe vers le premier des noms à valider
+ * \param[in] p_nbNoms est le nombre de noms à valider
+ * \param[out] p_valides reçoit, pour chaque nom, un booléen indiquant s'il est valide
+ * \return le nombre de noms valides
+ */
+std::size_t validerFormatNoms(const std::string* p_noms, std::size_t p_nbNoms, bool* p_valides)
+{
+	std::size_t nbValides = 0;
+
+	for (std::size_t i = 0; i < p_nbNoms; i++)
+	{
+		p_valides[i] = validerFormatNom(p_noms[i].data(), p_noms[i].length());
+		nbValides += p_valides[i];
+	}
+
+	return nbValides;
+}
+
+/**
+ * \brief Retourne la forme normalisée d'un nom ou prénom, qui sert à le comparer sans égard à
+ * 		  la casse ni aux accents
+ * 		  Les lettres ASCII sont mises en majuscules et les lettres accentuées de U+00C0 à U+017F
+ * 		  sont remplacées par leur équivalent ASCII majuscule (É et é donnent E, Œ donne OE, ß
+ * 		  donne SS). Les autres caractères, dont les lettres de U+0180 à U+024F, sont gardés
+ * 		  tels quels. Le résultat ne dépend pas de la locale.
+ * \param[in] p_nom est le nom ou prénom à normaliser
+ * \return le nom normalisé
+ */
+std::string normaliserNom(const std::string& p_nom)
+{
+	std::string cle;
+	cle.reserve(p_nom.length());
+	LecteurNom lecteur(p_nom);
+	char caractere;
+
+	while (lecteur.lire(caractere))
+	{
+		cle.push_back(caractere);
+	}
+
+	return cle;
 }
 
+/**
+ * \brief Compare la forme normalisée d'un nom à une clé déjà normalisée, sans construire la
+ * 		  forme normalisée du nom
+ * \param[in] p_nom est le nom ou prénom à comparer
+ * \param[in] p_cle est une clé retournée par normaliserNom()
+ * \return un entier négatif, nul ou positif selon que normaliserNom(p_nom) précède, égale ou
+ * 		   suit p_cle dans l'ordre des octets
+ */
+int comparerNomNormalise(const std::string& p_nom, const std::string& p_cle)
+{
+	LecteurNom lecteur(p_nom);
+	std::string::size_type i = 0;
+	char caractere;
+	int difference = 0;
 
+	while (difference == 0 && lecteur.lire(caractere))
+	{
+		difference = i < p_cle.length() ?
+				static_cast<unsigned char>(caractere) - static_cast<unsigned char>(p_cle[i]) : 1;
+		i++;
+	}
 
+	return difference != 0 || i == p_cle.length() ? difference : -1;
+}
 
+/**
+ * \brief Détermine si la forme normalisée d'un nom commence par un préfixe déjà normalisé
+ * \param[in] p_nom est le nom ou prénom à vérifier
+ * \param[in] p_prefixe est un préfixe retourné par normaliserNom(), vide pour tous les noms
+ * \return un booléen indiquant si normaliserNom(p_nom) commence par p_prefixe
+ */
+bool nomCommencePar(const std::string& p_nom, const std::string& p_prefixe)
+{
+	LecteurNom lecteur(p_nom);
+	std::string::size_type i = 0;
+	char caractere;
+
+	while (i < p_prefixe.length() && lecteur.lire(caractere) && caractere == p_prefixe[i])
+	{
+		i++;
+	}
+
+	return i == p_prefixe.length();
+}
+}
@@ -6,6 +6,13 @@
  * \date 23 février 2019
  */
 
+#ifndef VALIDATIONFORMAT_H_
+#define VALIDATIONFORMAT_H_
+
+#include <string>
+#include <cstddef>
+#include <cstdint>
+
 /**
  * \namespace util
  * \brief Ce namespace contient des méthodes et des classes utilitaires
@@ -14,9 +21,21 @@ namespace util
 {
 
 bool validerTelephone(const std::string& p_telephone);
+bool validerTelephone(const char* p_telephone, std::size_t p_longueur);
+std::size_t validerTelephones(const std::string* p_telephones, std::size_t p_nbTelephones, bool* p_valides);
 bool validerNumRAMQ(const std::string& p_numero, const std::string& p_nom, const
 std::string& p_prenom, int p_jourNaissance, int p_moisNaissance, int
 p_anneeNaissance, char p_sex);
+std::size_t validerNumRAMQs(const std::string* p_numeros, const std::string* p_noms, const std::string* p_prenoms,
+							const std::uint32_t* p_datesNaissance, const char* p_sexes, std::size_t p_nbNumeros,
+							bool* p_valides);
 bool validerFormatNom(const std::string& p_nom);
+bool validerFormatNom(const char* p_nom, std::size_t p_longueur);
+std::size_t validerFormatNoms(const std::string* p_noms, std::size_t p_nbNoms, bool* p_valides);
+std::string normaliserNom(const std::string& p_nom);
+int comparerNomNormalise(const std::string& p_nom, const std::string& p_cle);
+bool nomCommencePar(const std::string& p_nom, const std::string& p_prefixe);
 
 }
+
+#endif